@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Editor/Core/SymbolExportMacros.h>
+#include <Engine/Core/Assertions.h>
 
 #include <fmt/format.h>
 
@@ -18,8 +19,22 @@ EDITOR_API std::ostream& operator<<(std::ostream& os, const ConfigurationMode& c
 
 } // namespace Editor
 
+// Inline so that the Launcher can format modes without linking the Editor, which it loads itself when hot reloading
 template <>
-struct EDITOR_API fmt::formatter<::Editor::ConfigurationMode> : formatter<string_view>
+struct fmt::formatter<::Editor::ConfigurationMode> : formatter<string_view>
 {
-    auto format(::Editor::ConfigurationMode configMode, format_context& ctx) const -> format_context::iterator;
+    auto format(::Editor::ConfigurationMode configMode, format_context& ctx) const -> format_context::iterator
+    {
+        string_view name = "undefined";
+
+        switch (configMode)
+        {
+        case ::Editor::ConfigurationMode::Debug: name = "Debug"; break;
+        case ::Editor::ConfigurationMode::Dev: name = "Dev"; break;
+        case ::Editor::ConfigurationMode::Release: name = "Release"; break;
+        default: Assert_NoEntry();
+        }
+
+        return formatter<string_view>::format(name, ctx);
+    }
 };
@@ -2,6 +2,12 @@
 
 #include <Editor/Core/EditorConfigurationMode.h>
 #include <Editor/Core/SymbolExportMacros.h>
+#include <Engine/Core/FrameAllocator.h>
+#include <Engine/Core/FrameScheduler.h>
+#include <Engine/Core/Memory.h>
+
+#include <chrono>
+#include <vector>
 
 namespace Editor
 {
@@ -12,6 +18,21 @@ public:
     ConfigurationMode currentConfigMode = ConfigurationMode::Release;
     bool isDeveloperMode                = false;
 
+    /// Closes the Editor as soon as its window is up, so that startup can be timed on its own.
+    bool isQuitAfterStartupRequested = false;
+
+    /// How long startup took, from the Launcher's main() until the main window was up.
+    std::chrono::nanoseconds startupTime = {};
+
+    /// Picked up by the main loop at the start of every frame.
+    Engine::FramePacingMode framePacingMode = Engine::FramePacingMode::BlockingIdle;
+    double targetFrameRate                  = 60.0;
+
+    /// Written by the main loop at the end of every frame.
+    Engine::FrameTimingStats frameTimingStats;
+    Engine::FrameMemoryStats frameMemoryStats;
+    std::vector<Engine::Memory::HeapStats> heapMemoryStats;
+
     static const EditorState& GetInstance();
 
     EditorState()  = default;
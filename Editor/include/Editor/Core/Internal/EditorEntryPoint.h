@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Editor/Core/EditorConfigurationMode.h>
+#include <Editor/Core/EditorState.h>
 #include <Editor/Core/SymbolExportMacros.h>
 
 namespace Editor
@@ -14,4 +15,19 @@ struct ReloadOption
 
 EDITOR_API ReloadOption EditorMain(int argc, char* argv[]);
 
+/// What the Launcher binds when it loads the Editor library itself, to hot reload it. See the extern "C" functions
+/// below for what each one is.
+struct EditorEntryPoints
+{
+    void (*editorMain)(int argc, char* argv[], ReloadOption* reloadOption) = nullptr;
+    EditorState* (*getMutableEditorState)()                                = nullptr;
+};
+
 } // namespace Editor
+
+// Unmangled, so that they can be looked up by name
+extern "C"
+{
+EDITOR_API void AdHocEditorMain(int argc, char* argv[], Editor::ReloadOption* reloadOption);
+EDITOR_API Editor::EditorState* AdHocGetMutableEditorState();
+}
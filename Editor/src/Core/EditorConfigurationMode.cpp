@@ -2,10 +2,6 @@
 
 #include <Engine/Core/Assertions.h>
 
-#include <fmt/format.h>
-
-#include <string_view>
-
 namespace Editor
 {
 
@@ -23,19 +19,3 @@ EDITOR_API std::ostream& operator<<(std::ostream& os, const ConfigurationMode& c
 }
 
 } // namespace Editor
-
-auto fmt::formatter<::Editor::ConfigurationMode>::format(::Editor::ConfigurationMode configMode,
-                                                         format_context& ctx) const -> format_context::iterator
-{
-    std::string_view name = "undefined";
-
-    switch (configMode)
-    {
-    case ::Editor::ConfigurationMode::Debug: name = "Debug"; break;
-    case ::Editor::ConfigurationMode::Dev: name = "Dev"; break;
-    case ::Editor::ConfigurationMode::Release: name = "Release"; break;
-    default: Assert_NoEntry();
-    }
-
-    return formatter<string_view>::format(name, ctx);
-}
@@ -1,5 +1,7 @@
 #include <Editor/Core/EditorState.h>
 
+#include <Engine/Core/HotReload.h>
+
 namespace Editor
 {
 
@@ -15,4 +17,27 @@ EditorState& GetMutableEditorState()
     return instance;
 }
 
+static void SaveEditorState(std::vector<std::byte>& data)
+{
+    const auto& editorState = EditorState::GetInstance();
+    Engine::WriteReloadValue(data, editorState.currentConfigMode);
+    Engine::WriteReloadValue(data, editorState.isDeveloperMode);
+    Engine::WriteReloadValue(data, editorState.framePacingMode);
+    Engine::WriteReloadValue(data, editorState.targetFrameRate);
+}
+
+static bool RestoreEditorState(std::span<const std::byte> data)
+{
+    auto& editorState = GetMutableEditorState();
+    return Engine::ReadReloadValue(data, editorState.currentConfigMode) &&
+           Engine::ReadReloadValue(data, editorState.isDeveloperMode) &&
+           Engine::ReadReloadValue(data, editorState.framePacingMode) &&
+           Engine::ReadReloadValue(data, editorState.targetFrameRate);
+}
+
+static const auto editorStateReloadHook = Engine::ScopedReloadHook({.name    = "EditorState",
+                                                                    .version = 2,
+                                                                    .save    = SaveEditorState,
+                                                                    .restore = RestoreEditorState});
+
 } // namespace Editor
@@ -2,7 +2,16 @@
 
 #include <Engine/Core/BacktraceSymbolHandler.h>
 #include <Engine/Core/Console.h>
+#include <Engine/Core/CrashHandler.h>
+#include <Engine/Core/FrameAllocator.h>
+#include <Engine/Core/FrameScheduler.h>
+#include <Engine/Core/HotReload.h>
+#include <Engine/Core/Jobs.h>
+#include <Engine/Core/Memory.h>
 #include <Engine/Core/PlatformData.h>
+#include <Engine/Core/StartupTrace.h>
+
+#include <optional>
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
@@ -14,25 +23,79 @@ namespace Console = Engine::Console;
 namespace Editor
 {
 
+static constexpr double reloadCheckIntervalSeconds = 0.05;
+
 static void OnGlfwError(int error, const char* description)
 {
     Console::LogError("GLFW error {}: {}", error, description);
 }
 
+#if ADHOC_HOT_RELOAD
+/// Set from the key callback, for the main loop to return to the Launcher with.
+static auto requestedConfigMode = std::optional<ConfigurationMode>();
+
+static void OnKey(GLFWwindow*, int key, int, int action, int)
+{
+    if (action != GLFW_PRESS)
+        return;
+
+    // TODO: Move into a menu once there is one
+    switch (key)
+    {
+    case GLFW_KEY_F5: requestedConfigMode = ConfigurationMode::Debug; break;
+    case GLFW_KEY_F6: requestedConfigMode = ConfigurationMode::Dev; break;
+    case GLFW_KEY_F7: requestedConfigMode = ConfigurationMode::Release; break;
+    default: break;
+    }
+}
+#endif
+
 ReloadOption EditorMain(int argc, char* argv[])
 {
-    Engine::InitializePlatformData();
-    auto symbolHandler = Engine::BacktraceSymbolHandler{};
+#if !ADHOC_HOT_RELOAD
+    // Otherwise the Launcher has done this once for every Editor it loads
+    {
+        STARTUP_TRACE_SCOPE("Initialize platform data");
+        Engine::InitializePlatformData();
+    }
 
-    // TODO: Reimplement the recompile watch thread
+    auto symbolHandler = std::optional<Engine::BacktraceSymbolHandler>();
+    {
+        STARTUP_TRACE_SCOPE("Start symbol handler");
+        symbolHandler.emplace();
+    }
+
+    {
+        STARTUP_TRACE_SCOPE("Install crash handler");
+        Engine::InstallCrashHandler();
+    }
+
+    // Before the job system, which allocates its jobs from the Jobs heap
+    {
+        STARTUP_TRACE_SCOPE("Create subsystem heaps");
+        Engine::Memory::Initialize();
+    }
+
+    {
+        STARTUP_TRACE_SCOPE("Start job system");
+        Engine::Jobs::Initialize();
+    }
+#endif
 
     glfwSetErrorCallback(OnGlfwError);
 
-    if (!glfwInit())
-        Console::LogFatal("glfwInit() failure!");
+    {
+        STARTUP_TRACE_SCOPE("glfwInit");
+        if (!glfwInit())
+            Console::LogFatal("glfwInit() failure!");
+    }
 
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-    GLFWwindow* mainWindowPtr = glfwCreateWindow(1024, 768, "Window Title", nullptr, nullptr);
+    GLFWwindow* mainWindowPtr = nullptr;
+    {
+        STARTUP_TRACE_SCOPE("Create main window");
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+        mainWindowPtr = glfwCreateWindow(1024, 768, "Window Title", nullptr, nullptr);
+    }
 
     if (!mainWindowPtr)
     {
@@ -40,18 +103,87 @@ ReloadOption EditorMain(int argc, char* argv[])
         Console::LogFatal("glfwCreateWindow() failure!");
     }
 
+#if ADHOC_HOT_RELOAD
+    glfwSetKeyCallback(mainWindowPtr, OnKey);
+#endif
+
+    // Hot reloads run this again, but only the first run is part of startup
+    if (Engine::IsTracingStartup())
+        GetMutableEditorState().startupTime = Engine::EndStartupTrace();
+
+    if (EditorState::GetInstance().isQuitAfterStartupRequested)
+        glfwSetWindowShouldClose(mainWindowPtr, GLFW_TRUE);
+
+    auto reloadOption   = ReloadOption{.configToLoad = EditorState::GetInstance().currentConfigMode};
+    auto frameScheduler = Engine::FrameScheduler();
+    auto frameAllocator = Engine::FrameAllocator();
+
     while (!glfwWindowShouldClose(mainWindowPtr))
     {
-        glfwWaitEvents();
+        auto& editorState = GetMutableEditorState();
+        frameScheduler.SetPacingMode(editorState.framePacingMode);
+        frameScheduler.SetTargetFrameRate(editorState.targetFrameRate);
+
+        // Wakes up now and then even without any events, so that a reload requested by the Launcher's file watcher
+        // isn't held up until the next one
+        const auto isIdle = frameScheduler.GetPacingMode() == Engine::FramePacingMode::BlockingIdle;
+        if (isIdle)
+            glfwWaitEventsTimeout(reloadCheckIntervalSeconds);
+
+        frameScheduler.BeginFrame();
+        frameAllocator.BeginFrame();
+        Engine::Memory::BeginFrame();
+
+        // Polled once the frame is due, so that it starts with the latest input
+        if (!isIdle)
+            glfwPollEvents();
+
+        while (frameScheduler.StepSimulation())
+        {
+            // TODO: Simulation and live previews
+        }
 
         // TODO: Actual editor stuff
 
-        // TODO: Check recompile watch thread
+        editorState.frameTimingStats = frameScheduler.GetTimingStats();
+        editorState.frameMemoryStats = frameAllocator.GetStats();
+        Engine::Memory::GetHeapStats(editorState.heapMemoryStats);
+
+#if ADHOC_HOT_RELOAD
+        if (requestedConfigMode && *requestedConfigMode != reloadOption.configToLoad)
+        {
+            reloadOption.configToLoad = *requestedConfigMode;
+            Engine::RequestReload();
+        }
+        requestedConfigMode.reset();
+#endif
+
+        if (Engine::IsReloadRequested())
+        {
+            reloadOption.isReloadRequested = true;
+            break;
+        }
     }
 
     glfwTerminate();
 
-    return ReloadOption{.isReloadRequested = false};
+#if !ADHOC_HOT_RELOAD
+    Engine::Jobs::Shutdown();
+    Engine::Memory::Shutdown();
+    Engine::UninstallCrashHandler();
+#endif
+
+    return reloadOption;
 }
 
 } // namespace Editor
+
+void AdHocEditorMain(int argc, char* argv[], Editor::ReloadOption* reloadOption)
+{
+    *reloadOption = Editor::EditorMain(argc, argv);
+}
+
+Editor::EditorState* AdHocGetMutableEditorState()
+{
+    return &Editor::GetMutableEditorState();
+}
@@ -6,7 +6,11 @@
 #include <Engine/Core/Misc.h>
 #include <Engine/Core/SymbolExportMacros.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <source_location>
+#include <string>
 #include <string_view>
 
 #if ADHOC_DEBUG
@@ -16,7 +20,10 @@
 
 #if ADHOC_DEV
     #define ADHOC_ASSERTIONS_ON 1
-    #define ADHOC_SLOW_ASSERTIONS_ON 0
+    // Can be turned on from the build, usually along with a sample rate so the checks fit in a Dev frame budget
+    #ifndef ADHOC_SLOW_ASSERTIONS_ON
+        #define ADHOC_SLOW_ASSERTIONS_ON 0
+    #endif
 #endif
 
 #if ADHOC_RELEASE
@@ -47,23 +54,170 @@ ENGINE_API void LogAssertionTrap(const bool isFatal,
                                  const std::string_view fmtMessage,
                                  const std::source_location location);
 
-ENGINE_API void TriggerFatalErrorResponse();
+[[noreturn]] ENGINE_API void TriggerFatalErrorResponse();
+
+/// Everything about an assertion that's known at compile time. Each call site keeps one in static storage, so the only
+/// thing a failing assertion has to pass along to describe itself is a reference to it.
+struct AssertionSite
+{
+    constexpr AssertionSite(bool isFatal, std::string_view expression, std::source_location location)
+        : isFatal(isFatal), expression(expression), location(location)
+    {}
+
+    constexpr AssertionSite(bool isFatal,
+                            std::string_view expression,
+                            std::string_view leftExpression,
+                            std::string_view rightExpression,
+                            std::string_view operation,
+                            std::source_location location)
+        : isFatal(isFatal), expression(expression), leftExpression(leftExpression), rightExpression(rightExpression),
+          operation(operation), location(location)
+    {}
+
+    bool isFatal;
+    /// The whole condition, or the error message for Assert_NoEntry() style assertions.
+    std::string_view expression;
+    std::string_view leftExpression;
+    std::string_view rightExpression;
+    std::string_view operation;
+    std::source_location location;
+};
+
+/// Runtime statistics for an assertion site, see Engine::GetAssertionStatsJson(). Owned by the Engine rather than the
+/// module the site is compiled into, so that they're still there once that module has been unloaded, and picked up
+/// again by the same site when it's reloaded.
+struct AssertionStats
+{
+    std::atomic<uint64_t> hitCount     = 0;
+    std::atomic<uint64_t> failureCount = 0;
+    /// Failures that weren't logged because of rate limiting since the last one that was.
+    std::atomic<uint64_t> unreportedFailureCount = 0;
+
+    /// Milliseconds since the Unix epoch, zero until the assertion first fails.
+    std::atomic<int64_t> firstFailureTimeMs = 0;
+    std::atomic<int64_t> lastFailureTimeMs  = 0;
+    /// steady_clock nanoseconds of the last failure that was logged.
+    std::atomic<int64_t> lastReportTime = 0;
+};
+
+struct AssertionRecord;
+
+/// Finds or creates the stats for the record's site, copying what describes the site, and returns them.
+ENGINE_API NOINLINE COLD AssertionStats& RegisterAssertionRecord(AssertionRecord& record);
+
+/// Each call site keeps one in static storage next to its AssertionSite, and looks up its stats the first time it's
+/// reached.
+struct AssertionRecord
+{
+    constexpr explicit AssertionRecord(const AssertionSite& site) : site(site) {}
+
+    void CountHit()
+    {
+        auto* currentStats = stats.load(std::memory_order_acquire);
+        if (!currentStats) [[unlikely]]
+            currentStats = &RegisterAssertionRecord(*this);
+
+        // Deliberately not an atomic increment: hits from different threads can occasionally overwrite each other,
+        // which is fine for a hit rate and keeps passing assertions off the locked instructions
+        const auto previousHitCount = currentStats->hitCount.load(std::memory_order_relaxed);
+        currentStats->hitCount.store(previousHitCount + 1, std::memory_order_relaxed);
+    }
+
+    const AssertionSite& site;
+    std::atomic<AssertionStats*> stats = nullptr;
+};
+
+/// Updates the failure statistics and returns whether the failure should be logged. Fatal assertions always are, the
+/// others at most once per report interval (see Engine::SetAssertionReportInterval()).
+ENGINE_API bool RecordAssertionFailure(AssertionRecord& record);
+
+/// Return whether the failure was logged, so the call site knows whether to break into the debugger.
+ENGINE_API NOINLINE COLD bool ReportBooleanAssertionFailure(AssertionRecord& record,
+                                                            const bool expectedResult,
+                                                            const bool actualResult,
+                                                            const std::string_view fmtMessage);
+
+ENGINE_API NOINLINE COLD bool ReportAssertionTrap(AssertionRecord& record, const std::string_view fmtMessage);
+
+ENGINE_API uint32_t GetSlowAssertionSampleRate();
+
+/// Each slow assertion call site keeps one of these to only check one in every N times it's reached (see
+/// Engine::SetSlowAssertionSampleRate()). The first time is always checked.
+struct SlowAssertionSampler
+{
+    bool ShouldCheck()
+    {
+        // Same as the hit counts, racing threads can make a site check a little more or less often than it should
+        const auto skipsLeft = remainingSkips.load(std::memory_order_relaxed);
+        if (skipsLeft > 0)
+        {
+            remainingSkips.store(skipsLeft - 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        remainingSkips.store(GetSlowAssertionSampleRate() - 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::atomic<uint32_t> remainingSkips = 0;
+};
+
+/// Operands are only stringified once a binary assertion has failed, so passing assertions never format anything.
+template <typename L, typename R>
+NOINLINE COLD bool FormatAndReportBinaryAssertionFailure(AssertionRecord& record,
+                                                         const L& leftResult,
+                                                         const R& rightResult,
+                                                         const std::string_view fmtMessage)
+{
+    if (!RecordAssertionFailure(record))
+        return false;
+
+    const auto& site = record.site;
+    LogBinaryAssertionFailure(site.isFatal,
+                              site.leftExpression,
+                              fmt::format("{}", leftResult),
+                              site.rightExpression,
+                              fmt::format("{}", rightResult),
+                              site.operation,
+                              fmtMessage,
+                              site.location);
+    return true;
+}
 
 } // namespace Engine::Internal
 
+namespace Engine
+{
+
+/// Failing non-fatal assertions are logged at most once per interval per call site, so one firing in a hot loop doesn't
+/// flood the console. The failures in between are still counted. Defaults to one second, zero logs every failure.
+ENGINE_API void SetAssertionReportInterval(std::chrono::milliseconds interval);
+
+/// Slow assertions only check one in every sampleRate times each call site is reached, to bound what they cost when
+/// they're turned on in Dev builds. The Eval versions still evaluate their expressions every time. Sites that are part
+/// way through skipping only pick up a new rate once they next check. Defaults to 1, which checks every time.
+ENGINE_API void SetSlowAssertionSampleRate(uint32_t sampleRate);
+
+/// Every assertion site reached so far with its hit and failure counts, as a JSON document.
+ENGINE_API std::string GetAssertionStatsJson();
+
+} // namespace Engine
+
 #define ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(isFatal, expression, expected, fmtMessage)                                 \
     {                                                                                                                  \
+        static constexpr auto AdHocAssertionSite =                                                                     \
+            ::Engine::Internal::AssertionSite(isFatal, STRINGIFY(expression), std::source_location::current());        \
+        static constinit auto AdHocAssertionRecord = ::Engine::Internal::AssertionRecord(AdHocAssertionSite);          \
+        AdHocAssertionRecord.CountHit();                                                                               \
+                                                                                                                       \
         decltype(expression) expressionResult = expression;                                                            \
-        if (expressionResult != expected)                                                                              \
+        if (expressionResult != expected) [[unlikely]]                                                                 \
         {                                                                                                              \
-            ::Engine::Internal::LogBooleanAssertionFailure(isFatal,                                                    \
-                                                           STRINGIFY(expression),                                      \
-                                                           expected,                                                   \
-                                                           expressionResult,                                           \
-                                                           fmtMessage,                                                 \
-                                                           std::source_location::current());                           \
-                                                                                                                       \
-            DEBUG_BREAK();                                                                                             \
+            if (::Engine::Internal::ReportBooleanAssertionFailure(                                                     \
+                    AdHocAssertionRecord, expected, expressionResult, fmtMessage))                                     \
+            {                                                                                                          \
+                DEBUG_BREAK();                                                                                         \
+            }                                                                                                          \
                                                                                                                        \
             if (isFatal)                                                                                               \
                 ::Engine::Internal::TriggerFatalErrorResponse();                                                       \
@@ -72,24 +226,26 @@ ENGINE_API void TriggerFatalErrorResponse();
 
 #define ADHOC_ASSERT_IMPLEMENTATION_BINARY(isFatal, leftExpression, rightExpression, operation, fmtMessage)            \
     {                                                                                                                  \
-        decltype(leftExpression) leftExpressionResult   = leftExpression;                                              \
-        decltype(rightExpression) rightExpressionResult = rightExpression;                                             \
+        static constexpr auto AdHocAssertionSite = ::Engine::Internal::AssertionSite(                                  \
+            isFatal,                                                                                                   \
+            STRINGIFY(leftExpression) " " STRINGIFY(operation) " " STRINGIFY(rightExpression),                         \
+            STRINGIFY(leftExpression),                                                                                 \
+            STRINGIFY(rightExpression),                                                                                \
+            STRINGIFY(operation),                                                                                      \
+            std::source_location::current());                                                                          \
+        static constinit auto AdHocAssertionRecord = ::Engine::Internal::AssertionRecord(AdHocAssertionSite);          \
+        AdHocAssertionRecord.CountHit();                                                                               \
                                                                                                                        \
-        auto leftExpressionResultString  = fmt::format("{}", leftExpressionResult);                                    \
-        auto rightExpressionResultString = fmt::format("{}", rightExpressionResult);                                   \
+        const auto& leftExpressionResult  = leftExpression;                                                            \
+        const auto& rightExpressionResult = rightExpression;                                                           \
                                                                                                                        \
-        if (!(leftExpressionResult operation rightExpressionResult))                                                   \
+        if (!(leftExpressionResult operation rightExpressionResult)) [[unlikely]]                                      \
         {                                                                                                              \
-            ::Engine::Internal::LogBinaryAssertionFailure(isFatal,                                                     \
-                                                          STRINGIFY(leftExpression),                                   \
-                                                          leftExpressionResultString,                                  \
-                                                          STRINGIFY(rightExpression),                                  \
-                                                          rightExpressionResultString,                                 \
-                                                          STRINGIFY(operation),                                        \
-                                                          fmtMessage,                                                  \
-                                                          std::source_location::current());                            \
-                                                                                                                       \
-            DEBUG_BREAK();                                                                                             \
+            if (::Engine::Internal::FormatAndReportBinaryAssertionFailure(                                             \
+                    AdHocAssertionRecord, leftExpressionResult, rightExpressionResult, fmtMessage))                    \
+            {                                                                                                          \
+                DEBUG_BREAK();                                                                                         \
+            }                                                                                                          \
                                                                                                                        \
             if (isFatal)                                                                                               \
                 ::Engine::Internal::TriggerFatalErrorResponse();                                                       \
@@ -98,9 +254,15 @@ ENGINE_API void TriggerFatalErrorResponse();
 
 #define ADHOC_ASSERT_IMPLEMENTATION_NO_ENTRY(isFatal, message, fmtMessage)                                             \
     {                                                                                                                  \
-        ::Engine::Internal::LogAssertionTrap(isFatal, message, fmtMessage, std::source_location::current());           \
+        static constexpr auto AdHocAssertionSite =                                                                     \
+            ::Engine::Internal::AssertionSite(isFatal, message, std::source_location::current());                      \
+        static constinit auto AdHocAssertionRecord = ::Engine::Internal::AssertionRecord(AdHocAssertionSite);          \
+        AdHocAssertionRecord.CountHit();                                                                               \
                                                                                                                        \
-        DEBUG_BREAK();                                                                                                 \
+        if (::Engine::Internal::ReportAssertionTrap(AdHocAssertionRecord, fmtMessage))                                 \
+        {                                                                                                              \
+            DEBUG_BREAK();                                                                                             \
+        }                                                                                                              \
                                                                                                                        \
         if (isFatal)                                                                                                   \
             ::Engine::Internal::TriggerFatalErrorResponse();                                                           \
@@ -116,6 +278,43 @@ ENGINE_API void TriggerFatalErrorResponse();
         CONCATENATE(AdHocAssertNoReentry_HasReachedLine, __LINE__) = true;                                             \
     }
 
+#define ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(isFatal, expression, expected, fmtMessage)                            \
+    {                                                                                                                  \
+        static constinit auto AdHocSlowAssertionSampler = ::Engine::Internal::SlowAssertionSampler();                  \
+        if (AdHocSlowAssertionSampler.ShouldCheck())                                                                   \
+            ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(isFatal, expression, expected, fmtMessage)                             \
+    }
+
+#define ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(isFatal, leftExpression, rightExpression, operation, fmtMessage)       \
+    {                                                                                                                  \
+        static constinit auto AdHocSlowAssertionSampler = ::Engine::Internal::SlowAssertionSampler();                  \
+        if (AdHocSlowAssertionSampler.ShouldCheck())                                                                   \
+            ADHOC_ASSERT_IMPLEMENTATION_BINARY(isFatal, leftExpression, rightExpression, operation, fmtMessage)        \
+    }
+
+// Skipped checks still evaluate the expression, same as when slow assertions are off
+#define ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(isFatal, expression, expected, fmtMessage)                       \
+    {                                                                                                                  \
+        static constinit auto AdHocSlowAssertionSampler = ::Engine::Internal::SlowAssertionSampler();                  \
+        if (AdHocSlowAssertionSampler.ShouldCheck())                                                                   \
+            ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(isFatal, expression, expected, fmtMessage)                             \
+        else                                                                                                           \
+        {                                                                                                              \
+            (void)(expression);                                                                                        \
+        }                                                                                                              \
+    }
+
+#define ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(isFatal, leftExpression, rightExpression, operation, fmtMessage)  \
+    {                                                                                                                  \
+        static constinit auto AdHocSlowAssertionSampler = ::Engine::Internal::SlowAssertionSampler();                  \
+        if (AdHocSlowAssertionSampler.ShouldCheck())                                                                   \
+            ADHOC_ASSERT_IMPLEMENTATION_BINARY(isFatal, leftExpression, rightExpression, operation, fmtMessage)        \
+        else                                                                                                           \
+        {                                                                                                              \
+            (void)(leftExpression);                                                                                    \
+        }                                                                                                              \
+    }
+
 #if ADHOC_ASSERTIONS_ON
 
 // Non-fmt versions
@@ -220,38 +419,37 @@ ENGINE_API void TriggerFatalErrorResponse();
     #define ExpectF_Lt(lhs, rhs, fmtString, ...)                                                                       \
         ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_Le(lhs, rhs, fmtString, ...)                                                                       \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(                                                                            \
-            false, lhs, rhs, <=, fmt::format(fmtString, __VA_ARGS__, fmt::format(fmtString, __VA_ARGS__)))
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <=, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_Gt(lhs, rhs, fmtString, ...)                                                                       \
         ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_Ge(lhs, rhs, fmtString, ...)                                                                       \
         ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >=, fmt::format(fmtString, __VA_ARGS__))
 
     #define AssertEvalF_Eq(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, ==)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, ==, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Ne(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, !=)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, !=, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Lt(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Le(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <=)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <=, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Gt(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Ge(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >=)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >=, fmt::format(fmtString, __VA_ARGS__))
 
     #define ExpectEvalF_Eq(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, ==)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, ==, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Ne(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, !=)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, !=, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Lt(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Le(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <=)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <=, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Gt(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Ge(lhs_evaluated, rhs_discarded, fmtString, ...)                                               \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >=)
+        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >=, fmt::format(fmtString, __VA_ARGS__))
 
     #define AssertF_NoEntry(fmtString, ...)                                                                            \
         ADHOC_ASSERT_IMPLEMENTATION_NO_ENTRY(true, "Call to Assert_NoEntry()", fmt::format(fmtString, __VA_ARGS__))
@@ -379,137 +577,153 @@ ENGINE_API void TriggerFatalErrorResponse();
 
 // Non-fmt versions
 
-    #define Assert_True_Slow(expression) ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, true, "")
-    #define Assert_False_Slow(expression) ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, false, "")
+    #define Assert_True_Slow(expression) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, true, "")
+    #define Assert_False_Slow(expression) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, false, "")
 
-    #define Expect_True_Slow(expression) ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, true, "")
-    #define Expect_False_Slow(expression) ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, false, "")
+    #define Expect_True_Slow(expression) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, true, "")
+    #define Expect_False_Slow(expression) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, false, "")
 
-    #define AssertEval_True_Slow(expression) ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, true, "")
-    #define AssertEval_False_Slow(expression) ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, false, "")
+    #define AssertEval_True_Slow(expression) ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(true, expression, true, "")
+    #define AssertEval_False_Slow(expression) ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(true, expression, false, "")
 
-    #define ExpectEval_True_Slow(expression) ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, true, "")
-    #define ExpectEval_False_Slow(expression) ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, false, "")
+    #define ExpectEval_True_Slow(expression) ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(false, expression, true, "")
+    #define ExpectEval_False_Slow(expression)                                                                          \
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(false, expression, false, "")
 
-    #define Assert_Eq_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, ==, "")
-    #define Assert_Ne_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, !=, "")
-    #define Assert_Lt_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, <, "")
-    #define Assert_Le_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, <=, "")
-    #define Assert_Gt_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, >, "")
-    #define Assert_Ge_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, >=, "")
+    #define Assert_Eq_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, ==, "")
+    #define Assert_Ne_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, !=, "")
+    #define Assert_Lt_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, <, "")
+    #define Assert_Le_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, <=, "")
+    #define Assert_Gt_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, >, "")
+    #define Assert_Ge_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, >=, "")
 
-    #define Expect_Eq_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, ==, "")
-    #define Expect_Ne_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, !=, "")
-    #define Expect_Lt_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <, "")
-    #define Expect_Le_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <=, "")
-    #define Expect_Gt_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >, "")
-    #define Expect_Ge_Slow(lhs, rhs) ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >=, "")
+    #define Expect_Eq_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, ==, "")
+    #define Expect_Ne_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, !=, "")
+    #define Expect_Lt_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <, "")
+    #define Expect_Le_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <=, "")
+    #define Expect_Gt_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >, "")
+    #define Expect_Ge_Slow(lhs, rhs) ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >=, "")
 
     #define AssertEval_Eq_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, ==, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, ==, "")
     #define AssertEval_Ne_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, !=, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, !=, "")
     #define AssertEval_Lt_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <, "")
     #define AssertEval_Le_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <=, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <=, "")
     #define AssertEval_Gt_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >, "")
     #define AssertEval_Ge_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >=, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >=, "")
 
     #define ExpectEval_Eq_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, ==, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, ==, "")
     #define ExpectEval_Ne_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, !=, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, !=, "")
     #define ExpectEval_Lt_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <, "")
     #define ExpectEval_Le_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <=, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <=, "")
     #define ExpectEval_Gt_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >, "")
     #define ExpectEval_Ge_Slow(lhs_evaluated, rhs_discarded)                                                           \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >=, "")
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >=, "")
 
 // Fmt versions
 
     #define AssertF_True_Slow(expression, fmtString, ...)                                                              \
-        ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, true, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, true, fmt::format(fmtString, __VA_ARGS__))
     #define AssertF_False_Slow(expression, fmtString, ...)                                                             \
-        ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, false, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, false, fmt::format(fmtString, __VA_ARGS__))
 
     #define ExpectF_True_Slow(expression, fmtString, ...)                                                              \
-        ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, true, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, true, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_False_Slow(expression, fmtString, ...)                                                             \
-        ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, false, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, false, fmt::format(fmtString, __VA_ARGS__))
 
     #define AssertEvalF_True_Slow(expression, fmtString, ...)                                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, true, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(true, expression, true, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_False_Slow(expression, fmtString, ...)                                                         \
-        ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(true, expression, false, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(true, expression, false, fmt::format(fmtString, __VA_ARGS__))
 
     #define ExpectEvalF_True_Slow(expression, fmtString, ...)                                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, true, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(false, expression, true, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_False_Slow(expression, fmtString, ...)                                                         \
-        ADHOC_ASSERT_IMPLEMENTATION_BOOLEAN(false, expression, false, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BOOLEAN(false, expression, false, fmt::format(fmtString, __VA_ARGS__))
 
     #define AssertF_Eq_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, ==, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, ==, fmt::format(fmtString, __VA_ARGS__))
     #define AssertF_Ne_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, !=, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, !=, fmt::format(fmtString, __VA_ARGS__))
     #define AssertF_Lt_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, <, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, <, fmt::format(fmtString, __VA_ARGS__))
     #define AssertF_Le_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, <=, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, <=, fmt::format(fmtString, __VA_ARGS__))
     #define AssertF_Gt_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, >, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, >, fmt::format(fmtString, __VA_ARGS__))
     #define AssertF_Ge_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, >=, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(true, lhs, rhs, >=, fmt::format(fmtString, __VA_ARGS__))
 
     #define ExpectF_Eq_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, ==, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, ==, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_Ne_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, !=, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, !=, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_Lt_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_Le_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(                                                                            \
-            false, lhs, rhs, <=, fmt::format(fmtString, __VA_ARGS__, fmt::format(fmtString, __VA_ARGS__)))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, <=, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_Gt_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectF_Ge_Slow(lhs, rhs, fmtString, ...)                                                                  \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >=, fmt::format(fmtString, __VA_ARGS__))
+        ADHOC_SLOW_ASSERT_IMPLEMENTATION_BINARY(false, lhs, rhs, >=, fmt::format(fmtString, __VA_ARGS__))
 
     #define AssertEvalF_Eq_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, ==)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            true, lhs_evaluated, rhs_discarded, ==, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Ne_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, !=)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            true, lhs_evaluated, rhs_discarded, !=, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Lt_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            true, lhs_evaluated, rhs_discarded, <, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Le_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, <=)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            true, lhs_evaluated, rhs_discarded, <=, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Gt_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            true, lhs_evaluated, rhs_discarded, >, fmt::format(fmtString, __VA_ARGS__))
     #define AssertEvalF_Ge_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(true, lhs_evaluated, rhs_discarded, >=)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            true, lhs_evaluated, rhs_discarded, >=, fmt::format(fmtString, __VA_ARGS__))
 
     #define ExpectEvalF_Eq_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, ==)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            false, lhs_evaluated, rhs_discarded, ==, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Ne_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, !=)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            false, lhs_evaluated, rhs_discarded, !=, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Lt_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            false, lhs_evaluated, rhs_discarded, <, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Le_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, <=)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            false, lhs_evaluated, rhs_discarded, <=, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Gt_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            false, lhs_evaluated, rhs_discarded, >, fmt::format(fmtString, __VA_ARGS__))
     #define ExpectEvalF_Ge_Slow(lhs_evaluated, rhs_discarded, fmtString, ...)                                          \
-        ADHOC_ASSERT_IMPLEMENTATION_BINARY(false, lhs_evaluated, rhs_discarded, >=)
+        ADHOC_SLOW_ASSERT_EVAL_IMPLEMENTATION_BINARY(                                                                  \
+            false, lhs_evaluated, rhs_discarded, >=, fmt::format(fmtString, __VA_ARGS__))
 
     #define Assert_Code_Slow(code)                                                                                     \
         do                                                                                                             \
         {                                                                                                              \
-            code                                                                                                       \
+            static constinit auto AdHocSlowAssertionSampler = ::Engine::Internal::SlowAssertionSampler();              \
+            if (AdHocSlowAssertionSampler.ShouldCheck())                                                               \
+            {                                                                                                          \
+                code                                                                                                   \
+            }                                                                                                          \
         } while (false)
 
 #else
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <fmt/core.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Engine::Console
+{
+
+enum class LogLevel;
+
+namespace Internal
+{
+
+enum class BinaryLogArgumentType : uint8_t
+{
+    Int64,
+    UInt64,
+    Float,
+    Double,
+    Bool,
+    Char,
+    String,
+    Pointer,
+};
+
+struct BinaryLogRecordHeader
+{
+    uint32_t size;
+    uint32_t formatStringId;
+    uint8_t logLevel;
+    uint8_t argumentCount;
+};
+
+template <typename T>
+concept BinaryLogStringArgument = std::is_same_v<T, const char*> || std::is_same_v<T, char*> ||
+                                  std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+template <typename T>
+concept BinaryLogArgument = std::is_arithmetic_v<T> || std::is_same_v<T, const void*> || std::is_same_v<T, void*> ||
+                            BinaryLogStringArgument<T>;
+
+/// True if every argument can be captured as raw bytes, so the message can be formatted later.
+template <typename... T>
+concept DeferrableLogArguments = (BinaryLogArgument<std::decay_t<T>> && ...);
+
+template <typename T>
+std::string_view AsBinaryLogString(const T& argument)
+{
+    if constexpr (std::is_pointer_v<T>)
+        return argument ? std::string_view(argument) : std::string_view("(null)");
+    else
+        return std::string_view(argument);
+}
+
+template <typename T>
+size_t GetBinaryLogArgumentSize(const T& argument)
+{
+    if constexpr (BinaryLogStringArgument<T>)
+        return 1 + sizeof(uint32_t) + AsBinaryLogString(argument).size();
+    else if constexpr (std::is_same_v<T, float>)
+        return 1 + sizeof(float);
+    else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>)
+        return 1 + 1;
+    else
+        return 1 + sizeof(uint64_t);
+}
+
+template <typename T>
+std::byte* EncodeBinaryLogArgument(std::byte* out, const T& argument)
+{
+    const auto write = [&out](BinaryLogArgumentType type, const void* data, size_t size)
+    {
+        *out++ = static_cast<std::byte>(type);
+        std::memcpy(out, data, size);
+        out += size;
+    };
+
+    if constexpr (BinaryLogStringArgument<T>)
+    {
+        const auto string = AsBinaryLogString(argument);
+        const auto length = static_cast<uint32_t>(string.size());
+        write(BinaryLogArgumentType::String, &length, sizeof(length));
+        std::memcpy(out, string.data(), length);
+        out += length;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+        write(BinaryLogArgumentType::Bool, &argument, 1);
+    else if constexpr (std::is_same_v<T, char>)
+        write(BinaryLogArgumentType::Char, &argument, 1);
+    else if constexpr (std::is_same_v<T, float>)
+        write(BinaryLogArgumentType::Float, &argument, sizeof(float));
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        const auto value = static_cast<double>(argument);
+        write(BinaryLogArgumentType::Double, &value, sizeof(value));
+    }
+    else if constexpr (std::is_pointer_v<T>)
+    {
+        const auto value = reinterpret_cast<uint64_t>(argument);
+        write(BinaryLogArgumentType::Pointer, &value, sizeof(value));
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        const auto value = static_cast<int64_t>(argument);
+        write(BinaryLogArgumentType::Int64, &value, sizeof(value));
+    }
+    else
+    {
+        const auto value = static_cast<uint64_t>(argument);
+        write(BinaryLogArgumentType::UInt64, &value, sizeof(value));
+    }
+
+    return out;
+}
+
+ENGINE_API extern std::atomic<bool> isDeferredLoggingEnabled;
+
+/// Copies the format string the first time it's seen at each address, see ForgetFormatStringAddresses().
+ENGINE_API uint32_t GetFormatStringId(std::string_view formatString);
+
+/// Reserves space in the calling thread's deferred log buffer, or returns nullptr if the record doesn't fit.
+ENGINE_API std::byte* BeginDeferredRecord(size_t size);
+ENGINE_API void EndDeferredRecord();
+
+/// Captures a log record without formatting it. Returns false if it couldn't be captured, in which case the caller
+/// should format it immediately instead.
+template <typename... T>
+bool LogDeferred(LogLevel logLevel, fmt::string_view formatString, const T&... arguments)
+{
+    const auto argumentsSize = (GetBinaryLogArgumentSize<std::decay_t<const T>>(arguments) + ... + 0);
+    const auto size          = sizeof(BinaryLogRecordHeader) + argumentsSize;
+
+    auto* out = BeginDeferredRecord(size);
+    if (!out)
+        return false;
+
+    const auto header = BinaryLogRecordHeader{
+        .size           = static_cast<uint32_t>(size),
+        .formatStringId = GetFormatStringId(std::string_view(formatString.data(), formatString.size())),
+        .logLevel       = static_cast<uint8_t>(logLevel),
+        .argumentCount  = static_cast<uint8_t>(sizeof...(T)),
+    };
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+
+    ((out = EncodeBinaryLogArgument<std::decay_t<const T>>(out, arguments)), ...);
+
+    EndDeferredRecord();
+    return true;
+}
+
+} // namespace Internal
+
+} // namespace Engine::Console
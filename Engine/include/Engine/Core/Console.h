@@ -1,34 +1,77 @@
 #pragma once
 
+#include <Engine/Core/BinaryLogEncoding.h>
 #include <Engine/Core/SymbolExportMacros.h>
 
 #include <fmt/format.h>
 
+#include <atomic>
+#include <cstddef>
+#include <chrono>
 #include <cstdlib>
+#include <filesystem>
 #include <functional>
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+
+#define ADHOC_LOG_LEVEL_FATAL 0
+#define ADHOC_LOG_LEVEL_ERROR 1
+#define ADHOC_LOG_LEVEL_WARNING 2
+#define ADHOC_LOG_LEVEL_LOG 3
+#define ADHOC_LOG_LEVEL_TRACE 4
+
+// The most verbose level that gets compiled in at all. Calls above it compile to nothing (their arguments are still
+// evaluated).
+#ifndef ADHOC_MIN_LOG_LEVEL
+    #if ADHOC_RELEASE
+        #define ADHOC_MIN_LOG_LEVEL ADHOC_LOG_LEVEL_WARNING
+    #else
+        #define ADHOC_MIN_LOG_LEVEL ADHOC_LOG_LEVEL_TRACE
+    #endif
+#endif
 
 namespace Engine::Console
 {
 
 enum class LogLevel
 {
-    Fatal,
-    Error,
-    Warning,
-    Log,
-    Trace,
+    Fatal   = ADHOC_LOG_LEVEL_FATAL,
+    Error   = ADHOC_LOG_LEVEL_ERROR,
+    Warning = ADHOC_LOG_LEVEL_WARNING,
+    Log     = ADHOC_LOG_LEVEL_LOG,
+    Trace   = ADHOC_LOG_LEVEL_TRACE,
 };
 
+typedef std::function<void(const LogLevel logLevel, std::string_view message)> LogEventViewCallback;
+
+/// Older listener signature. Still accepted by LogStream, at the cost of a std::string copy of every message.
 typedef std::function<void(const LogLevel logLevel, const std::string& message)> LogEventCallback;
 
+template <typename T>
+concept LegacyLogEventCallable = std::is_invocable_v<T, LogLevel, const std::string&> &&
+                                 !std::is_invocable_v<T, LogLevel, std::string_view>;
+
 class ENGINE_API LogStream
 {
 public:
-    LogStream(LogEventCallback callback) : LogStream(LogLevel::Log, callback) {}
-    LogStream(LogLevel verbosity, LogEventCallback callback);
+    LogStream(LogEventViewCallback callback) : LogStream(LogLevel::Log, std::move(callback)) {}
+    LogStream(LogLevel verbosity, LogEventViewCallback callback);
+
+    template <LegacyLogEventCallable T>
+    LogStream(T&& callback) : LogStream(LogLevel::Log, std::forward<T>(callback))
+    {}
+
+    template <LegacyLogEventCallable T>
+    LogStream(LogLevel verbosity, T&& callback)
+        : LogStream(verbosity,
+                    LogEventViewCallback(
+                        [callback = LogEventCallback(std::forward<T>(callback))](LogLevel logLevel,
+                                                                                 std::string_view message)
+                        { callback(logLevel, std::string(message)); }))
+    {}
 
     LogStream(const LogStream&)            = delete;
     LogStream& operator=(const LogStream&) = delete;
@@ -36,51 +79,141 @@ public:
     ~LogStream();
 
 private:
-    LogEventCallback callback;
+    LogEventViewCallback callback;
     unsigned int id;
 };
 
+enum class LogOverflowPolicy
+{
+    Block,
+    DropNewest,
+    DropOldest,
+};
+
+struct AsyncLogOptions
+{
+    size_t queueCapacity             = 8192;
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block;
+};
+
+/// Hand log messages to a dedicated logging thread instead of invoking LogStreams on the calling thread.
+ENGINE_API void EnableAsyncLogging(const AsyncLogOptions& options = AsyncLogOptions{});
+/// Deliver any queued messages and go back to invoking LogStreams on the calling thread.
+ENGINE_API void DisableAsyncLogging();
+ENGINE_API bool IsAsyncLoggingEnabled();
+
+struct DeferredLogOptions
+{
+    /// Raw records are appended here for offline decoding (see LogDecoder). Leave empty to only feed LogStreams.
+    std::filesystem::path binaryLogPath;
+    LogLevel binaryLogVerbosity = LogLevel::Trace;
+
+    size_t threadBufferSize                 = 64 * 1024;
+    std::chrono::milliseconds drainInterval = std::chrono::milliseconds(5);
+};
+
+/// Make Log() and LogTrace() capture their format string and raw arguments instead of formatting on the calling
+/// thread. Messages are formatted later, and only if a LogStream wants them. They still reach LogStreams ahead of
+/// anything the same thread logs directly afterwards, like a warning or a message too big to defer.
+ENGINE_API void EnableDeferredLogging(const DeferredLogOptions& options = DeferredLogOptions{});
+ENGINE_API void DisableDeferredLogging();
+ENGINE_API bool IsDeferredLoggingEnabled();
+/// Call before unloading a module that logs, since the next one loaded could put different format strings at the same
+/// addresses. Records that were already captured are unaffected.
+ENGINE_API void ForgetFormatStringAddresses();
+
+/// Read a binary log written by deferred logging, rendering each record as text.
+ENGINE_API bool DecodeBinaryLog(const std::filesystem::path& binaryLogPath, const LogEventViewCallback& callback);
+
+/// Block until every message logged so far has been delivered to the LogStreams.
+ENGINE_API void Flush();
+
 namespace Internal
 {
 
-ENGINE_API void LogImplementation(LogLevel logLevel, const std::string& formattedMessage);
+/// The most verbose level any registered LogStream or the binary log accepts, or -1 if nothing is listening.
+ENGINE_API extern std::atomic<int> maxAcceptedLogLevel;
 
+inline bool IsLogLevelAccepted(LogLevel logLevel)
+{
+    return static_cast<int>(logLevel) <= maxAcceptedLogLevel.load(std::memory_order_relaxed);
 }
 
+ENGINE_API void LogImplementation(LogLevel logLevel, std::string_view formattedMessage);
+
+/// Formats into a stack buffer, so messages shorter than fmt::inline_buffer_size are logged without allocating.
+ENGINE_API void FormatAndLog(LogLevel logLevel, fmt::string_view message, fmt::format_args fmtArgs);
+
+} // namespace Internal
+
 template <typename... T>
 void LogFatal(fmt::format_string<T...> message, T&&... fmtArgs)
 {
-    const auto& formattedMessage = fmt::format(message, std::forward<T&&>(fmtArgs)...);
-    Internal::LogImplementation(LogLevel::Fatal, formattedMessage);
+    Internal::FormatAndLog(LogLevel::Fatal, message, fmt::make_format_args(fmtArgs...));
+    Flush();
     std::abort();
 }
 
 template <typename... T>
 void LogError(fmt::format_string<T...> message, T&&... fmtArgs)
 {
-    const auto& formattedMessage = fmt::format(message, std::forward<T&&>(fmtArgs)...);
-    Internal::LogImplementation(LogLevel::Error, formattedMessage);
+    if constexpr (ADHOC_MIN_LOG_LEVEL >= ADHOC_LOG_LEVEL_ERROR)
+    {
+        if (!Internal::IsLogLevelAccepted(LogLevel::Error))
+            return;
+
+        Internal::FormatAndLog(LogLevel::Error, message, fmt::make_format_args(fmtArgs...));
+    }
 }
 
 template <typename... T>
 void LogWarning(fmt::format_string<T...> message, T&&... fmtArgs)
 {
-    const auto& formattedMessage = fmt::format(message, std::forward<T&&>(fmtArgs)...);
-    Internal::LogImplementation(LogLevel::Warning, formattedMessage);
+    if constexpr (ADHOC_MIN_LOG_LEVEL >= ADHOC_LOG_LEVEL_WARNING)
+    {
+        if (!Internal::IsLogLevelAccepted(LogLevel::Warning))
+            return;
+
+        Internal::FormatAndLog(LogLevel::Warning, message, fmt::make_format_args(fmtArgs...));
+    }
 }
 
 template <typename... T>
 void Log(fmt::format_string<T...> message, T&&... fmtArgs)
 {
-    const auto& formattedMessage = fmt::format(message, std::forward<T&&>(fmtArgs)...);
-    Internal::LogImplementation(LogLevel::Log, formattedMessage);
+    if constexpr (ADHOC_MIN_LOG_LEVEL >= ADHOC_LOG_LEVEL_LOG)
+    {
+        if (!Internal::IsLogLevelAccepted(LogLevel::Log))
+            return;
+
+        if constexpr (Internal::DeferrableLogArguments<T...>)
+        {
+            if (Internal::isDeferredLoggingEnabled.load(std::memory_order_relaxed) &&
+                Internal::LogDeferred(LogLevel::Log, message, fmtArgs...))
+                return;
+        }
+
+        Internal::FormatAndLog(LogLevel::Log, message, fmt::make_format_args(fmtArgs...));
+    }
 }
 
 template <typename... T>
 void LogTrace(fmt::format_string<T...> message, T&&... fmtArgs)
 {
-    const auto& formattedMessage = fmt::format(message, std::forward<T&&>(fmtArgs)...);
-    Internal::LogImplementation(LogLevel::Trace, formattedMessage);
+    if constexpr (ADHOC_MIN_LOG_LEVEL >= ADHOC_LOG_LEVEL_TRACE)
+    {
+        if (!Internal::IsLogLevelAccepted(LogLevel::Trace))
+            return;
+
+        if constexpr (Internal::DeferrableLogArguments<T...>)
+        {
+            if (Internal::isDeferredLoggingEnabled.load(std::memory_order_relaxed) &&
+                Internal::LogDeferred(LogLevel::Trace, message, fmtArgs...))
+                return;
+        }
+
+        Internal::FormatAndLog(LogLevel::Trace, message, fmt::make_format_args(fmtArgs...));
+    }
 }
 
 ENGINE_API std::ostream& operator<<(std::ostream& os, const LogLevel& logLevel);
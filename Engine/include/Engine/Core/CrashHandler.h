@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Engine/Core/StackTrace.h>
+#include <Engine/Core/SymbolExportMacros.h>
+
+namespace Engine
+{
+
+/// Runs inside the crash handler, after the crashing stack has been printed. Only async-signal-safe work is allowed,
+/// e.g. writing the addresses somewhere to be symbolized later.
+typedef void (*CrashCallback)(int signalNumber, const StackTrace& stackTrace);
+
+/// Catch SIGSEGV, SIGABRT and the other fatal signals (unhandled SEH exceptions on Windows), print the raw stack of
+/// the crashing thread to stderr and then let the process die the way it would have anyway.
+ENGINE_API void InstallCrashHandler(CrashCallback callback = nullptr);
+ENGINE_API void UninstallCrashHandler();
+
+} // namespace Engine
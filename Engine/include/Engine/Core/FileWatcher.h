@@ -0,0 +1,4 @@
+#pragma once
+
+#include <Engine/Core/PlatformAbstraction.h>
+#include PLATFORM_HEADER(FileWatcher.h)
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Engine/Core/SymbolExportMacros.h>
+#include <Engine/Core/VirtualMemory.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace Engine
+{
+
+/// How much of a FrameAllocator's memory frames have used, counted in whole thread blocks.
+struct FrameMemoryStats
+{
+    size_t previousFrameBytesUsed = 0;
+    /// The most any one frame has used so far.
+    size_t highWaterMark  = 0;
+    size_t committedBytes = 0;
+    size_t reservedBytes  = 0;
+};
+
+/// Memory for the rest of the frame, and the one after it:
+///
+///     frameAllocator.BeginFrame();
+///     auto vertices = frameAllocator.AllocateArray<Vertex>(vertexCount);
+///
+/// Each frame in flight bump-allocates from an address range of its own, reserved up front and committed as it's first
+/// used, so what was allocated during one frame stays valid through the next, e.g. for another thread to consume,
+/// and is released all at once when its range comes around again. Nothing allocated from it is destroyed.
+///
+/// Any thread can allocate. Each one claims a block of the frame's range at a time with a single atomic add, then
+/// allocates from that block without synchronizing with any other thread. A thread only keeps one block, so
+/// allocating from several FrameAllocators in turn wastes the rest of each one.
+class ENGINE_API FrameAllocator
+{
+public:
+    static constexpr uint32_t framesInFlight = 2;
+
+    static constexpr size_t defaultReservedSizePerFrame = 256 * 1024 * 1024;
+    /// How much of the frame's range a thread claims at a time.
+    static constexpr size_t threadBlockSize = 64 * 1024;
+
+    explicit FrameAllocator(size_t reservedSizePerFrame = defaultReservedSizePerFrame);
+
+    FrameAllocator(const FrameAllocator&)            = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    bool IsValid() const { return isValid; }
+
+    /// Start the next frame, releasing what was allocated the last time its range was used. Nothing can be allocating
+    /// from this while it runs, and nothing allocated framesInFlight frames ago can still be in use.
+    void BeginFrame();
+
+    /// Returns null once the frame's range is used up.
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T, typename... Args>
+    T* New(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Nothing allocated from a FrameAllocator is destroyed");
+
+        void* memory = Allocate(sizeof(T), alignof(T));
+        return memory ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /// Default-initialized, so trivial types are left uninitialized.
+    template <typename T>
+    std::span<T> AllocateArray(size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Nothing allocated from a FrameAllocator is destroyed");
+
+        auto* items = static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        if (!items)
+            return {};
+
+        std::uninitialized_default_construct_n(items, count);
+        return std::span<T>(items, count);
+    }
+
+    /// Only up to date between frames.
+    size_t GetCurrentFrameBytesUsed() const;
+    FrameMemoryStats GetStats() const;
+
+private:
+    struct FrameMemory
+    {
+        VirtualMemory memory;
+        /// How much of the range threads have claimed this frame.
+        std::atomic<size_t> claimedSize = 0;
+        /// So that threads can check whether their block is committed without taking commitMutex.
+        std::atomic<size_t> committedSize = 0;
+    };
+
+    std::array<FrameMemory, framesInFlight> frames;
+    uint32_t currentFrameIndex = 0;
+    /// Unique across every FrameAllocator and every frame, so that threads can tell their block is from a past frame.
+    uint64_t frameId = 0;
+    bool isValid     = false;
+    /// So that a frame that runs out of range logs that once rather than on every allocation after it.
+    std::atomic<bool> hasReportedOverflow = false;
+
+    /// Only taken to commit more of a frame's range.
+    std::mutex commitMutex;
+
+    size_t previousFrameBytesUsed = 0;
+    size_t highWaterMark          = 0;
+
+    /// Claim a new block of at least minimumSize bytes of the current frame's range for the calling thread.
+    std::byte* ClaimBlock(size_t minimumSize, size_t& blockSize);
+};
+
+} // namespace Engine
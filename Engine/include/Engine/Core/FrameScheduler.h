@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace Engine
+{
+
+enum class FramePacingMode : uint8_t
+{
+    /// The caller blocks until something happens, e.g. in glfwWaitEventsTimeout(). Nothing is simulated while idle.
+    BlockingIdle,
+    /// Frames start at a fixed rate, however long each one takes to run.
+    FixedRate,
+    /// The next frame starts as soon as the previous one is done.
+    Uncapped,
+};
+
+/// Frame times, from the start of one frame to the start of the next, over the last frameTimeHistorySize frames.
+struct FrameTimingStats
+{
+    double minFrameMilliseconds     = 0.0;
+    double averageFrameMilliseconds = 0.0;
+    double p99FrameMilliseconds     = 0.0;
+    double maxFrameMilliseconds     = 0.0;
+    uint64_t frameCount             = 0;
+};
+
+/// Paces a main loop and keeps a fixed timestep simulation in step with it:
+///
+///     frameScheduler.BeginFrame();
+///     while (frameScheduler.StepSimulation())
+///         Simulate(frameScheduler.GetFixedTimestep());
+///     Render(frameScheduler.GetInterpolationAlpha());
+class ENGINE_API FrameScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr uint32_t frameTimeHistorySize = 256;
+    /// Past this, the simulation falls behind rather than taking ever longer frames to catch up.
+    static constexpr uint32_t maxFixedStepsPerFrame = 8;
+
+    FramePacingMode GetPacingMode() const { return pacingMode; }
+    void SetPacingMode(FramePacingMode mode);
+
+    /// Only used in FramePacingMode::FixedRate.
+    void SetTargetFrameRate(double framesPerSecond);
+    Clock::duration GetTargetFrameTime() const { return targetFrameTime; }
+
+    void SetFixedTimestep(Clock::duration timestep);
+    Clock::duration GetFixedTimestep() const { return fixedTimestep; }
+
+    /// Wait until the next frame is due, then start it.
+    void BeginFrame();
+
+    /// Start a frame at frameStartTime without waiting. BeginFrame() calls this once it's done waiting.
+    void RecordFrameStart(Clock::time_point frameStartTime);
+
+    /// Returns true, and consumes one fixed timestep, while the simulation is behind the current frame.
+    bool StepSimulation();
+
+    /// How far the simulation's remaining time is into the next fixed step, between 0 and 1.
+    double GetInterpolationAlpha() const;
+
+    /// How long the previous frame took, from its start to the start of this one.
+    Clock::duration GetDeltaTime() const { return deltaTime; }
+
+    FrameTimingStats GetTimingStats() const;
+
+    /// Sleep for most of the time left until deadline, then spin through the rest. Operating system sleeps overshoot
+    /// by anything from tens of microseconds to a whole scheduler tick, so how much is left to spin adapts to how far
+    /// they've been overshooting.
+    void PreciseSleepUntil(Clock::time_point deadline);
+
+private:
+    FramePacingMode pacingMode      = FramePacingMode::BlockingIdle;
+    Clock::duration targetFrameTime = std::chrono::microseconds(16667);
+    Clock::duration fixedTimestep   = std::chrono::microseconds(16667);
+
+    Clock::time_point frameStartTime;
+    Clock::time_point nextFrameTime;
+    Clock::duration deltaTime      = Clock::duration::zero();
+    Clock::duration simulationDebt = Clock::duration::zero();
+    uint64_t frameCount            = 0;
+
+    std::array<Clock::duration, frameTimeHistorySize> frameTimeHistory = {};
+
+    /// Running estimate of how long a short sleep really takes, as a mean and variance in nanoseconds.
+    double sleepEstimateMean     = 0.0;
+    double sleepEstimateVariance = 0.0;
+    uint64_t sleepSampleCount    = 0;
+};
+
+} // namespace Engine
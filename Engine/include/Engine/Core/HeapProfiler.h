@@ -0,0 +1,107 @@
+#pragma once
+
+#include <Engine/Core/StackTrace.h>
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// Tracks what's allocated through operator new, by tag and by call site:
+///
+///     static const auto assetsTag = HeapProfiler::RegisterTag("Assets");
+///     auto tagScope = HeapProfiler::TagScope(assetsTag);
+///     ...
+///     const auto before = HeapProfiler::TakeSnapshot();
+///     ...
+///     const auto growth = HeapProfiler::DiffSnapshots(before, HeapProfiler::TakeSnapshot());
+///     Console::Log("{}", HeapProfiler::FormatSnapshot(growth));
+///
+/// Only sees allocations made through the operators in HeapProfilerNewDelete.h, or an override that forwards to
+/// Allocate() and Free() the same way, and only those made while it's running. Every one of those is counted towards
+/// the tag that was current on the allocating thread. Only one in every stackSampleInterval also has its call stack
+/// captured, so per call site numbers are estimates, scaled up by the interval.
+namespace Engine::HeapProfiler
+{
+
+using TagId = uint16_t;
+
+inline constexpr TagId untaggedTag  = 0;
+inline constexpr size_t maxTagCount = 256;
+
+struct HeapProfilerOptions
+{
+    /// Capture the call stack of one in every this many allocations on each thread. 1 captures every one of them.
+    uint32_t stackSampleInterval = 64;
+};
+
+/// Registering a name again returns the same tag. Once maxTagCount tags are taken, further names get untaggedTag.
+ENGINE_API TagId RegisterTag(const char* name);
+ENGINE_API const char* GetTagName(TagId tag);
+
+/// Tags what the calling thread allocates until it's destroyed, on top of any outer scope. Tags belong to the thread,
+/// so a scope shouldn't be held across a job system WaitFor(), after which the job may continue on another thread.
+class ENGINE_API TagScope
+{
+public:
+    explicit TagScope(TagId tag);
+    ~TagScope();
+
+    TagScope(const TagScope&)            = delete;
+    TagScope& operator=(const TagScope&) = delete;
+
+private:
+    TagId previousTag;
+};
+
+/// Starting again forgets everything counted before, including allocations that are still live.
+ENGINE_API void Start(const HeapProfilerOptions& options = HeapProfilerOptions());
+ENGINE_API void Stop();
+ENGINE_API bool IsRunning();
+
+struct HeapUsage
+{
+    /// Signed, so that snapshot diffs can show memory going away.
+    int64_t liveBytes = 0;
+    int64_t liveCount = 0;
+    /// The most liveBytes has been since the profiler was started, as of the last sampled allocation or snapshot, so
+    /// a spike in between the two can be missed.
+    int64_t peakBytes = 0;
+};
+
+struct TagHeapUsage
+{
+    TagId tag = untaggedTag;
+    HeapUsage usage;
+};
+
+struct CallSiteHeapUsage
+{
+    StackTrace stackTrace;
+    TagId tag = untaggedTag;
+    /// Estimated from the sampled allocations.
+    HeapUsage usage;
+};
+
+/// Sorted by liveBytes, largest first.
+struct HeapSnapshot
+{
+    std::vector<TagHeapUsage> tags;
+    std::vector<CallSiteHeapUsage> callSites;
+    uint32_t stackSampleInterval = 0;
+};
+
+ENGINE_API HeapSnapshot TakeSnapshot();
+/// What changed from before to after. Peaks are after's, since they can't be told apart between the two.
+ENGINE_API HeapSnapshot DiffSnapshots(const HeapSnapshot& before, const HeapSnapshot& after);
+/// A table of the snapshot's tags and its maxCallSites biggest call sites, symbolized if there's a
+/// BacktraceSymbolHandler.
+ENGINE_API std::string FormatSnapshot(const HeapSnapshot& snapshot, size_t maxCallSites = 10);
+
+/// For operator new and delete overrides. Free() accepts anything Allocate() returned, whether or not the profiler was
+/// running at the time, and nothing else.
+ENGINE_API void* Allocate(size_t size, size_t alignment);
+ENGINE_API void Free(void* memory) noexcept;
+
+} // namespace Engine::HeapProfiler
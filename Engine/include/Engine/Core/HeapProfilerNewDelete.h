@@ -0,0 +1,124 @@
+#pragma once
+
+#include <Engine/Core/HeapProfiler.h>
+
+#include <cstddef>
+#include <new>
+
+// Replaces the global operator new and delete with ones that allocate through HeapProfiler::Allocate() and Free().
+// Include this in exactly one source file of each module, in Debug and Dev builds. Release builds use
+// mimalloc-new-delete.h instead. Every module in a process has to agree on the operators, since a block allocated
+// through one set can't be freed through the other, which the Launcher ensures by only loading Editors built in its own
+// configuration.
+
+#if ADHOC_RELEASE
+static_assert(false, "Release builds override new/delete with mimalloc-new-delete.h");
+#endif
+
+void* operator new(std::size_t size)
+{
+    void* memory = Engine::HeapProfiler::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    if (!memory)
+        throw std::bad_alloc();
+
+    return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Engine::HeapProfiler::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Engine::HeapProfiler::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    void* memory = Engine::HeapProfiler::Allocate(size, static_cast<std::size_t>(alignment));
+    if (!memory)
+        throw std::bad_alloc();
+
+    return memory;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Engine::HeapProfiler::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Engine::HeapProfiler::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Engine::HeapProfiler::Free(memory);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Engine
+{
+
+/// Saves and restores one subsystem's state across a hot reload of the module that owns it. Bump version whenever the
+/// layout of what save() writes changes: a section saved by another version is dropped on restore, and the subsystem
+/// keeps its defaults instead of misreading it.
+struct ReloadHook
+{
+    std::string_view name;
+    uint32_t version = 0;
+    void (*save)(std::vector<std::byte>& data);
+    /// Returns false if data couldn't be read.
+    bool (*restore)(std::span<const std::byte> data);
+};
+
+/// The saved state of every hook, which outlives the module that saved it.
+struct ReloadStateSection
+{
+    std::string name;
+    uint32_t version = 0;
+    std::vector<std::byte> data;
+};
+
+typedef std::vector<ReloadStateSection> ReloadState;
+
+/// A hook's functions live in the module that registered it, so it has to be unregistered before that module is
+/// unloaded. Registering a name again replaces the hook.
+ENGINE_API void RegisterReloadHook(const ReloadHook& hook);
+ENGINE_API void UnregisterReloadHook(std::string_view name);
+
+/// Registers a hook for as long as it's alive, e.g. as a static in the module the hook belongs to, so that it's
+/// unregistered again when the module is unloaded.
+class ScopedReloadHook
+{
+public:
+    explicit ScopedReloadHook(const ReloadHook& hook) : name(hook.name) { RegisterReloadHook(hook); }
+    ~ScopedReloadHook() { UnregisterReloadHook(name); }
+
+    ScopedReloadHook(const ScopedReloadHook&)            = delete;
+    ScopedReloadHook& operator=(const ScopedReloadHook&) = delete;
+
+private:
+    std::string name;
+};
+
+ENGINE_API ReloadState SaveReloadState();
+/// Hand every section to the registered hook of the same name and version. Returns how many were restored.
+ENGINE_API size_t RestoreReloadState(const ReloadState& state);
+
+/// Ask the running module to return to the Launcher so that it can be reloaded. Safe to call from any thread.
+ENGINE_API void RequestReload();
+ENGINE_API bool IsReloadRequested();
+ENGINE_API void ClearReloadRequest();
+
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+void WriteReloadValue(std::vector<std::byte>& data, const T& value)
+{
+    const auto offset = data.size();
+    data.resize(offset + sizeof(T));
+    std::memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+/// Read the next value, advancing data past it. Returns false if there isn't enough data left.
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+bool ReadReloadValue(std::span<const std::byte>& data, T& value)
+{
+    if (data.size() < sizeof(T))
+        return false;
+
+    std::memcpy(&value, data.data(), sizeof(T));
+    data = data.subspan(sizeof(T));
+    return true;
+}
+
+} // namespace Engine
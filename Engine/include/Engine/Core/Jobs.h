@@ -0,0 +1,138 @@
+#pragma once
+
+#include <Engine/Core/Fiber.h>
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Engine::Jobs
+{
+
+typedef void (*JobFunction)(void* data);
+
+/// data has to stay alive until the job has run.
+struct JobDeclaration
+{
+    JobFunction function = nullptr;
+    void* data           = nullptr;
+};
+
+struct Job;
+class JobSystem;
+
+/// Counts a batch of jobs that haven't finished yet, so that they can be waited on or depended on together. Has to
+/// outlive every job it counts.
+class ENGINE_API JobCounter
+{
+public:
+    JobCounter() = default;
+    ~JobCounter();
+
+    JobCounter(const JobCounter&)            = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return pendingCount.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> pendingCount = 0;
+
+    /// Jobs waiting for this counter to reach zero.
+    std::mutex continuationMutex;
+    std::vector<Job*> continuations;
+};
+
+/// One fewer than there are hardware threads, since the thread that starts the job system runs jobs too when it
+/// waits for them.
+ENGINE_API uint32_t GetDefaultWorkerThreadCount();
+
+struct JobSystemOptions
+{
+    uint32_t workerThreadCount = GetDefaultWorkerThreadCount();
+
+    /// Run jobs on fibers, so that a job waiting in WaitFor() is parked and its thread goes on to other jobs, instead
+    /// of running them on top of the waiting job's stack. Costs two fiber switches per job.
+    bool runJobsOnFibers = false;
+    /// Jobs waiting in WaitFor() each hold on to a fiber. Once every fiber is taken, new jobs run on the thread's own
+    /// stack instead and wait the way they would without fibers.
+    uint32_t fiberCount   = 128;
+    size_t fiberStackSize = Fiber::defaultStackSize;
+};
+
+/// Start the worker threads. The calling thread becomes the job system's main thread, which has a queue of its own and
+/// runs jobs in WaitFor(). Jobs are allocated from the Jobs heap if Memory has been initialized.
+ENGINE_API void Initialize(uint32_t workerThreadCount = GetDefaultWorkerThreadCount());
+ENGINE_API void Initialize(const JobSystemOptions& options);
+/// Waits for the worker threads to finish what they're running. Nothing can still be queued.
+ENGINE_API void Shutdown();
+ENGINE_API bool IsInitialized();
+ENGINE_API uint32_t GetWorkerThreadCount();
+
+/// Queue jobs, adding them to counter if there is one. Jobs queued from a worker go to the front of that worker's
+/// queue, where they're likely to run on the same core as what queued them, unless another worker with nothing to do
+/// steals them. Without a job system, jobs run immediately on the calling thread.
+ENGINE_API void Run(std::span<const JobDeclaration> jobs, JobCounter* counter = nullptr);
+ENGINE_API void Run(const JobDeclaration& job, JobCounter* counter = nullptr);
+
+/// Queue jobs once every job counted by dependency is done, e.g. to gather the results of a fan-out. Only the jobs
+/// already counted are waited for, so queue the jobs it depends on first.
+ENGINE_API void RunAfter(JobCounter& dependency, std::span<const JobDeclaration> jobs, JobCounter* counter = nullptr);
+
+/// Run queued jobs on the calling thread until every job counted by counter is done. A job running on a fiber is parked
+/// instead, and picked back up by whichever thread is free once counter is done.
+ENGINE_API void WaitFor(JobCounter& counter);
+
+namespace Internal
+{
+
+template <typename F>
+struct ParallelForBatch
+{
+    F* body;
+    size_t begin;
+    size_t end;
+
+    static void Run(void* data)
+    {
+        const auto& batch = *static_cast<ParallelForBatch*>(data);
+        (*batch.body)(batch.begin, batch.end);
+    }
+};
+
+} // namespace Internal
+
+/// Call body(begin, end) for consecutive ranges of batchSize indices out of [0, count) across every worker, and wait
+/// for all of them.
+template <typename F>
+void ParallelFor(size_t count, size_t batchSize, F&& body)
+{
+    using Batch = Internal::ParallelForBatch<std::remove_reference_t<F>>;
+
+    if (count == 0)
+        return;
+
+    batchSize             = std::max(batchSize, size_t(1));
+    const auto batchCount = (count + batchSize - 1) / batchSize;
+
+    auto batches = std::vector<Batch>(batchCount);
+    auto jobs    = std::vector<JobDeclaration>(batchCount);
+    for (size_t i = 0; i < batchCount; ++i)
+    {
+        batches[i] = {.body = &body, .begin = i * batchSize, .end = std::min(count, (i + 1) * batchSize)};
+        jobs[i]    = {.function = Batch::Run, .data = &batches[i]};
+    }
+
+    auto counter = JobCounter();
+    Run(jobs, &counter);
+    WaitFor(counter);
+}
+
+} // namespace Engine::Jobs
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Engine/Core/Console.h>
+#include <Engine/Core/MappedFile.h>
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace Engine::Console
+{
+
+struct LogFileOptions
+{
+    std::filesystem::path directory;
+    /// Segments are named <baseName>.<index>.log, carrying on from the highest index already in the directory.
+    std::string baseName = "AdHoc";
+
+    /// Each segment is preallocated to this size, and a new one is started once it's full.
+    size_t segmentSize = 4 * 1024 * 1024;
+    /// Start a new segment after this long even if the current one isn't full. Zero disables time based rotation.
+    std::chrono::milliseconds rotationInterval = std::chrono::milliseconds(0);
+    /// The oldest segments are deleted to keep at most this many. Zero keeps all of them.
+    size_t maxSegmentCount = 8;
+};
+
+/// Writes log lines into a memory mapped, preallocated log file. Writing a line is just a copy into the mapping, and
+/// since the OS owns the mapped pages everything written survives the process crashing, except possibly the line
+/// being written at the time.
+class ENGINE_API LogFileSink
+{
+public:
+    LogFileSink(LogLevel verbosity, const LogFileOptions& options);
+    ~LogFileSink();
+
+    LogFileSink(const LogFileSink&)            = delete;
+    LogFileSink& operator=(const LogFileSink&) = delete;
+
+    bool IsValid();
+    std::filesystem::path GetSegmentPath();
+
+private:
+    const LogFileOptions options;
+    const size_t segmentSize;
+
+    std::mutex segmentMutex;
+    MappedFile segment;
+    std::filesystem::path segmentPath;
+    size_t segmentWritePosition = 0;
+    std::chrono::steady_clock::time_point segmentStartTime;
+    size_t nextSegmentIndex = 0;
+    std::deque<std::filesystem::path> segmentPaths;
+
+    // Declared last so it's unregistered before the segment is destroyed
+    LogStream logStream;
+
+    void Write(LogLevel logLevel, std::string_view message);
+    bool OpenNextSegment();
+    void CloseSegment();
+};
+
+/// Shrink a segment left behind by a crash down to the lines that were completely written.
+ENGINE_API bool RecoverLogFile(const std::filesystem::path& logFilePath);
+
+} // namespace Engine::Console
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/// Heaps of their own for the engine's subsystems, each with a byte budget, and which can be torn down in one go:
+///
+///     auto& assetHeap = Memory::GetSubsystemHeap(Memory::Subsystem::Assets);
+///     auto* mesh      = assetHeap.New<Mesh>(...);
+///     ...
+///     assetHeap.DestroyAll();
+///
+/// Each thread that allocates from a heap gets a part of it of its own: a mimalloc heap in Windows editor builds, and a
+/// list of the blocks it got from the C heap elsewhere. Only what's asked of a heap directly, or through a
+/// HeapAllocator, goes into it; operator new doesn't.
+namespace Engine::Memory
+{
+
+enum class BudgetLimit
+{
+    Soft,
+    Hard,
+};
+
+/// 0 means no limit.
+struct HeapBudget
+{
+    /// Allocations can go over it, but each time the heap does it's reported.
+    size_t softLimitBytes = 0;
+    /// Allocations that would go over it fail, and the first one each frame is reported.
+    size_t hardLimitBytes = 0;
+};
+
+struct BudgetExceededEvent
+{
+    const char* heapName = nullptr;
+    BudgetLimit limit    = BudgetLimit::Soft;
+    size_t limitBytes    = 0;
+    /// Including the allocation that went over a soft limit, and not the one that would have gone over a hard limit.
+    size_t liveBytes      = 0;
+    size_t requestedBytes = 0;
+};
+
+typedef std::function<void(const BudgetExceededEvent& event)> BudgetCallback;
+
+struct HeapOptions
+{
+    /// Names the heap in stats and budget warnings.
+    const char* name = "Heap";
+    HeapBudget budget;
+    /// Called on the allocating thread. Logs a warning if it's empty.
+    BudgetCallback onBudgetExceeded;
+};
+
+struct HeapStats
+{
+    const char* name = nullptr;
+    /// What the heap handed out, which mimalloc can round up from what was asked for.
+    size_t liveBytes = 0;
+    size_t liveCount = 0;
+    size_t peakBytes = 0;
+
+    /// Since the heap's last BeginFrame().
+    size_t frameAllocatedBytes  = 0;
+    size_t frameAllocationCount = 0;
+    size_t frameFreedBytes      = 0;
+    /// Allocations refused for going over the hard limit.
+    size_t frameRejectedCount = 0;
+
+    HeapBudget budget;
+};
+
+struct UnderlyingHeap;
+struct ThreadHeap;
+struct ThreadHeapTable;
+
+/// A heap that keeps count of what's allocated from it against its budget. Any thread can allocate from it, and free
+/// what any other thread allocated.
+class ENGINE_API Heap
+{
+public:
+    /// No more than 64 heaps can exist at once.
+    explicit Heap(const HeapOptions& options = HeapOptions());
+    /// Frees whatever is still allocated from it, like DestroyAll().
+    ~Heap();
+
+    Heap(const Heap&)            = delete;
+    Heap& operator=(const Heap&) = delete;
+
+    /// Returns null if the allocation would take the heap over its hard limit, or there's no memory left.
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void Free(void* memory);
+
+    template <typename T, typename... Args>
+    T* New(Args&&... args)
+    {
+        void* memory = Allocate(sizeof(T), alignof(T));
+        return memory ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    template <typename T>
+    void Delete(T* object)
+    {
+        if (!object)
+            return;
+
+        object->~T();
+        Free(object);
+    }
+
+    /// Frees everything allocated from the heap at once, without destroying any of it, and leaves the heap empty and
+    /// ready to allocate from again. Nothing allocated from it can still be in use, or be freed later, and no other
+    /// thread can be allocating from it at the same time.
+    void DestroyAll();
+
+    /// Starts counting the frame stats over.
+    void BeginFrame();
+    /// Live counts are only exact while no other thread is allocating or freeing.
+    HeapStats GetStats() const;
+
+    void SetBudget(const HeapBudget& budget);
+    const char* GetName() const { return options.name; }
+
+private:
+    friend struct ThreadHeapTable;
+
+    HeapOptions options;
+    /// Which slot of each thread's table holds that thread's part of the heap.
+    uint32_t slotIndex = 0;
+    /// Changes each time the heap is emptied, which leaves every thread's part of it behind.
+    std::atomic<uint64_t> generation;
+    /// Every thread's part of the heap, which only changes under the heap registry's lock.
+    ThreadHeap* threadHeaps = nullptr;
+
+    std::atomic<size_t> softLimitBytes;
+    std::atomic<size_t> hardLimitBytes;
+
+    std::atomic<size_t> liveBytes = 0;
+    std::atomic<size_t> liveCount = 0;
+    std::atomic<size_t> peakBytes = 0;
+
+    /// Running totals, which the frame stats are the difference of.
+    std::atomic<size_t> allocatedBytes      = 0;
+    std::atomic<size_t> allocationCount     = 0;
+    std::atomic<size_t> freedBytes          = 0;
+    std::atomic<size_t> rejectedCount       = 0;
+    std::atomic<size_t> frameStartAllocated = 0;
+    std::atomic<size_t> frameStartCount     = 0;
+    std::atomic<size_t> frameStartFreed     = 0;
+    std::atomic<size_t> frameStartRejected  = 0;
+
+    std::atomic<bool> isOverSoftLimit     = false;
+    std::atomic<bool> isHardLimitReported = false;
+
+    UnderlyingHeap& GetThreadUnderlyingHeap();
+    ThreadHeap* AddThreadHeap();
+    void ReportBudgetExceeded(BudgetLimit limit, size_t limitBytes, size_t live, size_t requestedBytes);
+    void CountFree(size_t size);
+};
+
+/// Makes heap the one that default-constructed HeapAllocators on the calling thread allocate from until it's
+/// destroyed, on top of any outer scope. Don't keep one open across Jobs::WaitFor() on a fiber, which can pick the job
+/// back up on another thread.
+class ENGINE_API HeapScope
+{
+public:
+    explicit HeapScope(Heap& heap);
+    ~HeapScope();
+
+    HeapScope(const HeapScope&)            = delete;
+    HeapScope& operator=(const HeapScope&) = delete;
+
+private:
+    Heap* previousHeap;
+};
+
+/// The heap of the calling thread's innermost HeapScope, or null outside of any.
+ENGINE_API Heap* GetCurrentHeap();
+
+/// Lets standard containers allocate from a Heap, which has to outlive them, or from operator new without one.
+template <typename T>
+class HeapAllocator
+{
+public:
+    typedef T value_type;
+
+    /// Allocates from the calling thread's current heap, if there is one.
+    HeapAllocator() : heap(GetCurrentHeap()) {}
+    explicit HeapAllocator(Heap& heap) : heap(&heap) {}
+
+    template <typename U>
+    HeapAllocator(const HeapAllocator<U>& other) : heap(other.heap)
+    {
+    }
+
+    T* allocate(size_t count)
+    {
+        if (!heap)
+            return std::allocator<T>().allocate(count);
+
+        auto* items = static_cast<T*>(heap->Allocate(count * sizeof(T), alignof(T)));
+        if (!items)
+            throw std::bad_alloc();
+        return items;
+    }
+
+    void deallocate(T* items, size_t count)
+    {
+        if (heap)
+            heap->Free(items);
+        else
+            std::allocator<T>().deallocate(items, count);
+    }
+
+    template <typename U>
+    bool operator==(const HeapAllocator<U>& other) const
+    {
+        return heap == other.heap;
+    }
+
+    Heap* GetHeap() const { return heap; }
+
+private:
+    template <typename U>
+    friend class HeapAllocator;
+
+    Heap* heap;
+};
+
+template <typename T>
+using HeapVector = std::vector<T, HeapAllocator<T>>;
+
+/// Every heap that exists. Meant to be called once a frame, before the frame's allocations.
+ENGINE_API void BeginFrame();
+/// Replaces stats with those of every heap that exists, reusing its memory.
+ENGINE_API void GetHeapStats(std::vector<HeapStats>& stats);
+
+enum class Subsystem : uint8_t
+{
+    Logging,
+    EditorState,
+    Assets,
+    Jobs,
+    Count,
+};
+
+struct MemoryOptions
+{
+    std::array<HeapBudget, static_cast<size_t>(Subsystem::Count)> budgets = {};
+};
+
+/// Creates a heap for each subsystem. Call it before initializing the subsystems, which pick up their heaps when
+/// they're initialized, like Jobs::Initialize() does.
+ENGINE_API void Initialize(const MemoryOptions& options = MemoryOptions());
+/// Destroys the subsystem heaps along with everything still allocated from them, so only once the subsystems have been
+/// shut down.
+ENGINE_API void Shutdown();
+ENGINE_API bool IsInitialized();
+
+/// Only while initialized.
+ENGINE_API Heap& GetSubsystemHeap(Subsystem subsystem);
+ENGINE_API const char* GetSubsystemName(Subsystem subsystem);
+
+} // namespace Engine::Memory
@@ -2,4 +2,5 @@
 
 #include "MiscMacros.h"
 #include "PlatformAbstraction.h"
+#include "StackTrace.h"
 #include PLATFORM_HEADER(Misc.h)
@@ -2,7 +2,9 @@
 
 // clang-format off
 
-#define CONCATENATE(left, right) left ## right
+// Expanded in two steps so that arguments like __LINE__ are expanded before they're pasted
+#define CONCATENATE_IMPLEMENTATION(left, right) left ## right
+#define CONCATENATE(left, right) CONCATENATE_IMPLEMENTATION(left, right)
 
 // clang-format on
 
@@ -11,3 +13,19 @@
 
 /// Create a bit field with the nth bit set
 #define BIT(n) (1ull << (n))
+
+// clang-format off
+
+#if ADHOC_WINDOWS
+    /// Keep a function out of line, e.g. so rarely taken paths don't bloat their callers.
+    #define NOINLINE __declspec(noinline)
+    /// Hint that a function is rarely called, so it's optimized for size and placed away from hot code.
+    #define COLD
+#else
+    /// Keep a function out of line, e.g. so rarely taken paths don't bloat their callers.
+    #define NOINLINE __attribute__((noinline))
+    /// Hint that a function is rarely called, so it's optimized for size and placed away from hot code.
+    #define COLD __attribute__((cold))
+#endif
+
+// clang-format on
@@ -8,6 +8,8 @@
     #define PLATFORM_HEADER(relativePath) STRINGIFY(CONCATENATE(_platform/Windows/Windows, relativePath))
 #elif ADHOC_MACOS
     #define PLATFORM_HEADER(relativePath) STRINGIFY(CONCATENATE(_platform/Mac/Mac, relativePath))
+#elif ADHOC_LINUX
+    #define PLATFORM_HEADER(relativePath) STRINGIFY(CONCATENATE(_platform/Linux/Linux, relativePath))
 #else
 static_assert(false);
 #endif
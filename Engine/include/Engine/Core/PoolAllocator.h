@@ -0,0 +1,126 @@
+#pragma once
+
+#include <Engine/Core/StackTrace.h>
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+
+namespace Memory
+{
+class Heap;
+}
+
+struct PoolOptions
+{
+    /// Names the pool in leak reports.
+    const char* name = "Pool";
+    size_t slabSize  = 64 * 1024;
+    /// Where the slabs come from, which has to outlive the pool. Operator new if it's null.
+    Memory::Heap* heap = nullptr;
+
+    /// Give each thread a cache of free objects, so that most allocations and frees don't touch the shared free list.
+    /// Only so many pools can have thread caches at once; the rest go without.
+    bool useThreadCaches = true;
+    /// How many objects a thread cache takes from, or gives back to, the shared free list at a time.
+    uint32_t threadCacheBatchSize = 32;
+};
+
+struct PoolFreeNode;
+
+/// Fixed-size objects carved out of cache line aligned slabs, which are only returned when the allocator is destroyed.
+/// Freed objects go on a free list to be reused, either the shared one or, in batches, a thread cache's.
+///
+/// Objects still allocated when it's destroyed are reported as leaks, along with where they were allocated in Debug.
+class ENGINE_API SlabAllocator
+{
+public:
+    static constexpr size_t slabAlignment = 64;
+
+    SlabAllocator(size_t elementSize, size_t elementAlignment, const PoolOptions& options = PoolOptions());
+    ~SlabAllocator();
+
+    SlabAllocator(const SlabAllocator&)            = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    void* Allocate();
+    /// Any thread can free an object, whichever thread allocated it.
+    void Free(void* element);
+
+    /// Objects allocated and not yet freed. Only exact while no other thread is allocating or freeing.
+    size_t GetLiveCount() const;
+    size_t GetSlabCount() const;
+    size_t GetElementStride() const { return elementStride; }
+    bool HasThreadCaches() const { return threadCacheSlot != noThreadCacheSlot; }
+
+private:
+    friend struct PoolThreadCaches;
+
+    static constexpr uint32_t noThreadCacheSlot = ~0u;
+
+    const PoolOptions options;
+    const size_t elementStride;
+    const size_t elementsPerSlab;
+    /// Never reused, so that a thread cache can tell when the allocator it was filled from is gone.
+    const uint64_t id;
+    uint32_t threadCacheSlot = noThreadCacheSlot;
+
+    mutable std::mutex mutex;
+    PoolFreeNode* freeList = nullptr;
+    std::vector<void*> slabs;
+    /// Objects taken off the shared free list and not put back, whether they're allocated or in a thread cache.
+    size_t outstandingCount = 0;
+
+#if ADHOC_DEBUG
+    std::unordered_map<void*, StackTrace> liveAllocations;
+#endif
+
+    /// Call with mutex locked. Returns up to count objects from the shared free list as a chain.
+    PoolFreeNode* TakeFromFreeList(uint32_t count, uint32_t& takenCount);
+    /// Call with mutex locked.
+    void ReturnToFreeList(PoolFreeNode* first, PoolFreeNode* last, uint32_t count);
+
+    void TrackAllocation(void* element);
+    void TrackFree(void* element);
+
+    void ReportLeaks(size_t leakCount);
+};
+
+/// A pool of Ts, which are constructed and destroyed in place in a SlabAllocator's slabs.
+template <typename T>
+class Pool
+{
+public:
+    explicit Pool(const PoolOptions& options = PoolOptions()) : allocator(sizeof(T), alignof(T), options) {}
+
+    template <typename... Args>
+    T* New(Args&&... args)
+    {
+        return new (allocator.Allocate()) T(std::forward<Args>(args)...);
+    }
+
+    void Delete(T* object)
+    {
+        if (!object)
+            return;
+
+        object->~T();
+        allocator.Free(object);
+    }
+
+    size_t GetLiveCount() const { return allocator.GetLiveCount(); }
+    const SlabAllocator& GetAllocator() const { return allocator; }
+
+private:
+    SlabAllocator allocator;
+};
+
+} // namespace Engine
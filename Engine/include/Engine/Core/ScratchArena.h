@@ -0,0 +1,107 @@
+#pragma once
+
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Engine
+{
+
+/// How much scratch memory each thread reserves, the first time it opens a ScratchScope.
+inline constexpr size_t scratchArenaSize = 256 * 1024;
+
+#if ADHOC_DEBUG
+/// Scratch memory is filled with these in Debug, so that reading memory that wasn't written, or that belongs to a scope
+/// that has ended, shows up.
+inline constexpr std::byte scratchAllocatedPattern = std::byte(0xCD);
+inline constexpr std::byte scratchReleasedPattern  = std::byte(0xDD);
+#endif
+
+struct ScratchArena;
+
+/// Temporary memory for the rest of a scope, bump-allocated from the calling thread's scratch arena and all released
+/// together when the scope ends, e.g. for formatting buffers and lists of addresses. Whatever doesn't fit in the arena
+/// comes from the heap instead, and is freed when the scope ends too.
+///
+/// Scopes nest like the stack they stand in for: only the innermost scope on a thread can allocate. Nothing allocated
+/// from a scope is destroyed, so it's for trivially destructible types, or ones that only hold on to scratch memory.
+/// Don't keep a scope open across Jobs::WaitFor() on a fiber, which can pick the job back up on another thread.
+class ENGINE_API ScratchScope
+{
+public:
+    ScratchScope();
+    ~ScratchScope();
+
+    ScratchScope(const ScratchScope&)            = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /// Default-initialized, so trivial types are left uninitialized.
+    template <typename T>
+    std::span<T> AllocateArray(size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Nothing allocated from a ScratchScope is destroyed");
+
+        auto* items = static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        std::uninitialized_default_construct_n(items, count);
+        return std::span<T>(items, count);
+    }
+
+    /// How much this scope has taken from the arena, and from the heap after the arena ran out.
+    size_t GetArenaBytesUsed() const;
+    size_t GetHeapBytesUsed() const { return heapBytesUsed; }
+
+private:
+    struct HeapBlock;
+
+    /// Null once the thread's arena has been destroyed, while the thread exits.
+    ScratchArena* arena      = nullptr;
+    ScratchScope* outerScope = nullptr;
+    size_t startOffset       = 0;
+
+    HeapBlock* heapBlocks = nullptr;
+    size_t heapBytesUsed  = 0;
+
+    void* AllocateFromHeap(size_t size, size_t alignment);
+};
+
+/// Lets standard containers allocate from a ScratchScope, which has to outlive them. Deallocating does nothing; the
+/// memory comes back when the scope ends.
+template <typename T>
+class ScratchAllocator
+{
+public:
+    typedef T value_type;
+
+    explicit ScratchAllocator(ScratchScope& scope) : scope(&scope) {}
+
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U>& other) : scope(other.scope)
+    {
+    }
+
+    T* allocate(size_t count) { return static_cast<T*>(scope->Allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T*, size_t) {}
+
+    template <typename U>
+    bool operator==(const ScratchAllocator<U>& other) const
+    {
+        return scope == other.scope;
+    }
+
+private:
+    template <typename U>
+    friend class ScratchAllocator;
+
+    ScratchScope* scope;
+};
+
+template <typename T>
+using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
+} // namespace Engine
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace Engine
+{
+
+/// The raw return addresses of a call stack, innermost first. Capturing one doesn't allocate or symbolize anything,
+/// so it's cheap enough to take on hot paths and resolve later with BacktraceSymbolHandler::Symbolize().
+struct ENGINE_API StackTrace
+{
+public:
+    /// CaptureStackBackTrace() can't capture more than this on every version of Windows.
+    static constexpr size_t maxFrames = 62;
+
+    void* frames[maxFrames];
+    uint32_t frameCount = 0;
+
+    /// Capture the calling thread's stack, starting at the caller and leaving out its framesToSkip innermost frames.
+    /// This walks frame pointers where it can, so it costs tens of nanoseconds rather than microseconds.
+    static StackTrace Capture(uint32_t framesToSkip = 0);
+
+    std::span<void* const> GetFrames() const { return std::span(frames, frameCount); }
+
+    /// FNV-1a over the frame addresses, so identical stacks can be deduplicated without comparing them.
+    uint64_t GetHash() const
+    {
+        auto hash = uint64_t(14695981039346656037ull);
+        for (const auto* frame : GetFrames())
+        {
+            hash ^= reinterpret_cast<uintptr_t>(frame);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    bool operator==(const StackTrace& other) const
+    {
+        if (frameCount != other.frameCount)
+            return false;
+
+        for (uint32_t i = 0; i < frameCount; ++i)
+        {
+            if (frames[i] != other.frames[i])
+                return false;
+        }
+        return true;
+    }
+};
+
+/// Print the current call stack.
+ENGINE_API std::string GetBacktrace();
+
+} // namespace Engine
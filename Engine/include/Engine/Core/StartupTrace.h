@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Engine/Core/MiscMacros.h>
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+
+/// How long it may take from the Launcher's main() until the Editor is ready. EndStartupTrace() warns when it's over.
+static constexpr auto startupBudget = std::chrono::milliseconds(500);
+
+struct StartupTraceEvent
+{
+    std::string name;
+    /// Small per-thread index, 0 being the thread that called BeginStartupTrace().
+    uint32_t threadIndex = 0;
+    /// How many scopes this one is nested in, on its thread.
+    uint32_t depth = 0;
+    /// Since BeginStartupTrace().
+    std::chrono::nanoseconds start;
+    std::chrono::nanoseconds duration;
+};
+
+/// Records how long the enclosing scope took, as long as startup is still being traced. Use STARTUP_TRACE_SCOPE.
+class ENGINE_API StartupTraceScope
+{
+public:
+    explicit StartupTraceScope(const char* name);
+    ~StartupTraceScope();
+
+    StartupTraceScope(const StartupTraceScope&)            = delete;
+    StartupTraceScope& operator=(const StartupTraceScope&) = delete;
+
+private:
+    const char* name;
+    std::chrono::steady_clock::time_point startTime;
+    bool isRecording;
+};
+
+#define STARTUP_TRACE_SCOPE(name)                                                                                      \
+    const auto CONCATENATE(startupTraceScope, __LINE__) = ::Engine::StartupTraceScope(name)
+
+/// Start tracing from now, dropping anything recorded so far. Tracing is on from when the process starts, so this is
+/// only needed to move the start, e.g. to the top of main().
+ENGINE_API void BeginStartupTrace();
+
+/// Stop tracing, log a summary of where the time went and, if SetStartupTracePath() was given a path, write the trace
+/// there in the Chrome trace event format, for chrome://tracing or Perfetto. Returns the total startup time.
+ENGINE_API std::chrono::nanoseconds EndStartupTrace();
+
+/// False once EndStartupTrace() has been called, e.g. for code that runs again on every hot reload.
+ENGINE_API bool IsTracingStartup();
+
+ENGINE_API void SetStartupTracePath(const std::filesystem::path& path);
+
+/// Everything recorded so far, in the order the scopes ended.
+ENGINE_API std::vector<StartupTraceEvent> GetStartupTraceEvents();
+
+} // namespace Engine
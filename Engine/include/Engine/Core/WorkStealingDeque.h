@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace Engine
+{
+
+/// Chase-Lev work-stealing deque, with the memory orderings of Lê et al., "Correct and Efficient Work-Stealing for Weak
+/// Memory Models". The thread that owns it pushes and pops at the bottom, like a stack, while any other thread can
+/// steal from the top. Grows as needed; the arrays it outgrows are kept until it's destroyed, since a thief may still
+/// be reading from one.
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T> && std::atomic<T>::is_always_lock_free);
+
+public:
+    explicit WorkStealingDeque(size_t initialCapacity = 1024)
+    {
+        // Capacities are powers of two so that indices can wrap with a mask
+        auto capacity = size_t(1);
+        while (capacity < initialCapacity)
+            capacity *= 2;
+
+        arrays.push_back(std::make_unique<Array>(capacity));
+        array.store(arrays.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&)            = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /// Owner only.
+    void Push(T item)
+    {
+        const auto bottomIndex = bottom.load(std::memory_order_relaxed);
+        const auto topIndex    = top.load(std::memory_order_acquire);
+        auto* currentArray     = array.load(std::memory_order_relaxed);
+
+        if (bottomIndex - topIndex > static_cast<int64_t>(currentArray->capacity) - 1)
+            currentArray = Grow(currentArray, bottomIndex, topIndex);
+
+        // A release store rather than the paper's release fence, which ThreadSanitizer doesn't understand
+        currentArray->Put(bottomIndex, item);
+        bottom.store(bottomIndex + 1, std::memory_order_release);
+    }
+
+    /// Owner only. Takes the most recently pushed item, which is the one most likely to still be in cache.
+    std::optional<T> Pop()
+    {
+        const auto bottomIndex = bottom.load(std::memory_order_relaxed) - 1;
+        auto* currentArray     = array.load(std::memory_order_relaxed);
+        bottom.store(bottomIndex, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto topIndex = top.load(std::memory_order_relaxed);
+
+        if (topIndex > bottomIndex)
+        {
+            bottom.store(bottomIndex + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        auto item = std::optional<T>(currentArray->Get(bottomIndex));
+        if (topIndex == bottomIndex)
+        {
+            // The last item, which a thief may be taking at the same time
+            if (!top.compare_exchange_strong(
+                    topIndex, topIndex + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                item.reset();
+
+            bottom.store(bottomIndex + 1, std::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    /// Any thread. Takes the oldest item. Also returns nothing if another thread took it first, even though there may
+    /// be more left.
+    std::optional<T> Steal()
+    {
+        auto topIndex = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto bottomIndex = bottom.load(std::memory_order_acquire);
+
+        if (topIndex >= bottomIndex)
+            return std::nullopt;
+
+        auto* currentArray = array.load(std::memory_order_acquire);
+        const auto item    = currentArray->Get(topIndex);
+        if (!top.compare_exchange_strong(topIndex, topIndex + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return std::nullopt;
+
+        return item;
+    }
+
+    /// Only a snapshot, since other threads may be stealing.
+    bool IsEmpty() const
+    {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Array
+    {
+        explicit Array(size_t capacity) : capacity(capacity), mask(capacity - 1), items(new std::atomic<T>[capacity])
+        {
+        }
+
+        T Get(int64_t index) const { return items[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed); }
+
+        void Put(int64_t index, T item)
+        {
+            items[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+        }
+
+        const size_t capacity;
+        const size_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+    Array* Grow(Array* currentArray, int64_t bottomIndex, int64_t topIndex)
+    {
+        arrays.push_back(std::make_unique<Array>(currentArray->capacity * 2));
+        auto* grownArray = arrays.back().get();
+
+        for (auto index = topIndex; index < bottomIndex; ++index)
+            grownArray->Put(index, currentArray->Get(index));
+
+        array.store(grownArray, std::memory_order_release);
+        return grownArray;
+    }
+
+    // Thieves hammer top while the owner works on bottom, so they get a cache line each
+    alignas(64) std::atomic<int64_t> top    = 0;
+    alignas(64) std::atomic<int64_t> bottom = 0;
+    alignas(64) std::atomic<Array*> array   = nullptr;
+
+    /// Owner only.
+    std::vector<std::unique_ptr<Array>> arrays;
+};
+
+} // namespace Engine
@@ -1,19 +1,78 @@
 #pragma once
 
+#include <Engine/Core/StackTrace.h>
 #include <Engine/Core/SymbolExportMacros.h>
 
+#include <cstdint>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace Engine
 {
 
+/// Everything known about the code at one return address. Fields that couldn't be resolved are left empty.
+struct SymbolInfo
+{
+    std::string module;
+    std::string function;
+    /// Distance from the start of function, when there's no line information to point at instead.
+    uintptr_t offset = 0;
+    std::string file;
+    uint32_t line = 0;
+};
+
+/// Turns captured StackTraces into text. Symbols go into a cache shared by the whole process, so each return address
+/// is only looked up once however many handlers come and go. The most recently constructed handler is the one
+/// GetBacktrace() uses.
+///
+/// Whatever a platform has to load before it can look anything up is loaded on a background thread, so constructing a
+/// handler during startup doesn't wait for it. The first lookup does, if it's not done yet.
 class ENGINE_API BaseBacktraceSymbolHandler
 {
 public:
-    BaseBacktraceSymbolHandler() = default;
+    static BaseBacktraceSymbolHandler* GetInstance();
+
+    BaseBacktraceSymbolHandler();
 
     BaseBacktraceSymbolHandler(const BaseBacktraceSymbolHandler& other)            = delete;
     BaseBacktraceSymbolHandler& operator=(const BaseBacktraceSymbolHandler& other) = delete;
 
-    virtual ~BaseBacktraceSymbolHandler(){};
+    virtual ~BaseBacktraceSymbolHandler();
+
+    /// One line per frame, innermost first.
+    std::string Symbolize(const StackTrace& stackTrace);
+
+    /// Symbolize() every stack trace at once, e.g. a whole profiling session. Identical stacks are only formatted once,
+    /// and all the addresses that aren't cached yet are looked up together in address order.
+    std::vector<std::string> Symbolize(std::span<const StackTrace> stackTraces);
+
+    /// The returned reference stays valid until ClearSymbolCache() is called.
+    const SymbolInfo& ResolveSymbol(void* address);
+
+    /// Forget every resolved symbol, e.g. after unloading a library whose addresses may be reused by the next one.
+    static void ClearSymbolCache();
+
+protected:
+    /// Start running LoadSymbols() on a background thread. Call it at the end of the derived constructor.
+    void StartLoadingSymbols();
+
+    /// Block until LoadSymbols() is done. Derived destructors must call it before tearing down what it uses.
+    void WaitForSymbols();
+
+    /// Whatever has to be done before LookupSymbol() can be called, like loading debug info.
+    virtual void LoadSymbols() {}
+
+    /// Look up the symbol containing a return address. Only called for addresses that aren't cached yet, and never
+    /// from two threads at once.
+    virtual SymbolInfo LookupSymbol(void* address) = 0;
+
+private:
+    /// Make sure every address is in the cache, looking up the missing ones in one batch.
+    void ResolveSymbols(std::span<void* const> addresses);
+
+    std::thread symbolLoadingThread;
 };
 
 } // namespace Engine
@@ -2,26 +2,110 @@
 
 #include <filesystem>
 #include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 class BaseDynamicLibrary
 {
 public:
+    /// One entry point of a bind table, see BindFunctions().
+    struct FunctionBinding
+    {
+        std::string_view functionName;
+        void* functionPtrAddress;
+        void (*assign)(void* functionPtrAddress, void* symbol);
+    };
+
     virtual bool IsValid() = 0;
 
+    /// Unloads whatever was loaded before, so pointers into it dangle afterwards.
+    virtual void Load(const std::filesystem::path& path) = 0;
+    /// Every pointer previously returned for this library dangles afterwards.
+    virtual void Unload() = 0;
+
+    /// Calls through the returned pointer are plain indirect calls, so this is what anything called every frame should
+    /// hold on to. Returns nullptr if the library doesn't export the function.
+    template <typename T>
+    T* GetFunctionPtr(std::string_view functionName)
+    {
+        return reinterpret_cast<T*>(GetSymbol(functionName));
+    }
+
+    /// Convenience wrapper around GetFunctionPtr(). std::function adds a second indirect call to every call, so prefer
+    /// the raw pointer on hot paths.
     template <typename T>
-    std::function<T> GetFunction(const std::string& functionName)
+    std::function<T> GetFunction(std::string_view functionName)
+    {
+        return std::function<T>(GetFunctionPtr<T>(functionName));
+    }
+
+    /// Describe one member of a bind table, e.g. Bind("Update", entryPoints.update).
+    template <typename T>
+    static FunctionBinding Bind(std::string_view functionName, T*& functionPtr)
+    {
+        return {.functionName       = functionName,
+                .functionPtrAddress = &functionPtr,
+                .assign = [](void* functionPtrAddress, void* symbol)
+                { *static_cast<T**>(functionPtrAddress) = reinterpret_cast<T*>(symbol); }};
+    }
+
+    /// Resolve a whole table of entry points in one pass, typically right after loading the library so that nothing
+    /// has to be looked up by name afterwards. Every binding is assigned, with nullptr for the ones that are missing.
+    /// Returns false if any of them were.
+    bool BindFunctions(std::span<const FunctionBinding> bindings)
     {
-        void* functionPtr = GetRawFunctionPtr(functionName);
-        return std::function<T>(reinterpret_cast<T*>(functionPtr));
+        auto allFound = true;
+        for (const auto& binding : bindings)
+        {
+            void* symbol = GetSymbol(binding.functionName);
+            binding.assign(binding.functionPtrAddress, symbol);
+            allFound &= symbol != nullptr;
+        }
+
+        return allFound;
+    }
+
+    bool BindFunctions(std::initializer_list<FunctionBinding> bindings)
+    {
+        return BindFunctions(std::span(bindings.begin(), bindings.size()));
     }
 
 protected:
     void* libraryHandle = nullptr;
     std::filesystem::path libraryPath;
 
-    virtual void Load(const std::filesystem::path& path) = 0;
-    virtual void Unload()                                = 0;
+    /// dlsym() and GetProcAddress() hash and compare the name against the library's export tables on every call, so
+    /// each symbol is only looked up once per load. Lookups by string_view don't need to build a std::string to hit.
+    struct SymbolNameHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view functionName) const { return std::hash<std::string_view>()(functionName); }
+    };
+    std::unordered_map<std::string, void*, SymbolNameHash, std::equal_to<>> symbolCache;
 
     virtual void* GetRawFunctionPtr(const std::string& functionName) = 0;
+
+    void* GetSymbol(std::string_view functionName)
+    {
+        if (!IsValid())
+        {
+            std::cerr << "Attempted to load symbol " << functionName << " on an invalid DynamicLibrary!\n";
+            return nullptr;
+        }
+
+        if (const auto cachedSymbol = symbolCache.find(functionName); cachedSymbol != symbolCache.end())
+            return cachedSymbol->second;
+
+        auto name         = std::string(functionName);
+        void* functionPtr = GetRawFunctionPtr(name);
+        if (functionPtr)
+            symbolCache.emplace(std::move(name), functionPtr);
+
+        return functionPtr;
+    }
 };
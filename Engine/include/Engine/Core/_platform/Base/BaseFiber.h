@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+/// An execution context with a stack of its own, which threads switch to and from explicitly. A thread has to be
+/// converted into a fiber with ConvertCurrentThread() before it can switch to any other fiber.
+///
+/// Fiber stacks don't grow, so their size is picked when they're created, and overflowing one hits a guard page rather
+/// than whatever is allocated below it.
+class BaseFiber
+{
+public:
+    typedef void (*FiberFunction)(void* data);
+
+    static constexpr size_t defaultStackSize = 256 * 1024;
+
+    virtual bool IsValid() = 0;
+
+    /// Create a fiber that calls function(data) the first time it's switched to. function must never return: switch
+    /// away from the fiber for the last time instead.
+    virtual bool Create(FiberFunction function, void* data, size_t stackSize = defaultStackSize) = 0;
+
+    /// Make the calling thread's own stack a fiber that other fibers can switch back to.
+    virtual bool ConvertCurrentThread() = 0;
+    /// Only for a fiber made by ConvertCurrentThread(), on the same thread, once it's done switching.
+    virtual void ConvertBackToThread() = 0;
+
+    size_t GetStackSize() const { return stackSize; }
+
+protected:
+    FiberFunction function = nullptr;
+    void* data             = nullptr;
+    size_t stackSize       = 0;
+};
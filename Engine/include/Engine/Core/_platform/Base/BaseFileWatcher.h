@@ -0,0 +1,29 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+
+class BaseFileWatcher
+{
+public:
+    typedef std::function<void()> ChangeCallback;
+
+    /// How long a file has to be left alone after it changed before the callback runs, so that it isn't called part
+    /// way through e.g. the linker writing out a library.
+    static constexpr auto settleTime = std::chrono::milliseconds(100);
+
+    virtual bool IsValid() = 0;
+
+    /// Call onChanged from a background thread each time the file at path is written, replaced or created. The file
+    /// doesn't have to exist yet.
+    virtual bool Start(const std::filesystem::path& path, ChangeCallback onChanged) = 0;
+    /// Stop watching, waiting for a callback that's already running to return.
+    virtual void Stop() = 0;
+
+    const std::filesystem::path& GetPath() const { return watchedPath; }
+
+protected:
+    std::filesystem::path watchedPath;
+    ChangeCallback onChanged;
+};
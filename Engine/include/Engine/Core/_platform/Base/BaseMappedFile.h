@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+
+class BaseMappedFile
+{
+public:
+    virtual bool IsValid() = 0;
+
+    /// Create (or replace) the file at path, preallocate it to size zeroed bytes and map it for reading and writing.
+    virtual bool Create(const std::filesystem::path& path, size_t size) = 0;
+    /// Unmap the file, shrinking it to finalSize bytes.
+    virtual void Close(size_t finalSize) = 0;
+
+    std::byte* GetData() const { return data; }
+    size_t GetSize() const { return size; }
+
+protected:
+    std::byte* data = nullptr;
+    size_t size     = 0;
+};
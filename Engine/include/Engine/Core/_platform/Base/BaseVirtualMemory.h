@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+
+/// A range of address space reserved up front, with memory committed behind it only as it's needed, so that
+/// allocators can grow in place without knowing how far they'll grow.
+class BaseVirtualMemory
+{
+public:
+    virtual bool IsValid() = 0;
+
+    /// Reserve size bytes of address space, rounded up to whole pages, without committing any of it.
+    virtual bool Reserve(size_t size) = 0;
+    /// Commit the first size bytes of the range, rounded up to whole pages. Newly committed memory is zeroed.
+    virtual bool Commit(size_t size) = 0;
+    /// Give back everything past the first size bytes to the operating system, keeping the address space reserved.
+    virtual void Decommit(size_t size) = 0;
+    virtual void Release() = 0;
+
+    std::byte* GetData() const { return data; }
+    size_t GetReservedSize() const { return reservedSize; }
+    size_t GetCommittedSize() const { return committedSize; }
+
+protected:
+    std::byte* data      = nullptr;
+    size_t reservedSize  = 0;
+    size_t committedSize = 0;
+};
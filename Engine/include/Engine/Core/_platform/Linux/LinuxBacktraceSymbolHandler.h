@@ -0,0 +1,26 @@
+#pragma once
+
+#include "../Base/BaseBacktraceSymbolHandler.h"
+#include <Engine/Core/SymbolExportMacros.h>
+
+namespace Engine
+{
+
+class ENGINE_API LinuxBacktraceSymbolHandler : public BaseBacktraceSymbolHandler
+{
+public:
+    LinuxBacktraceSymbolHandler();
+
+    LinuxBacktraceSymbolHandler(const LinuxBacktraceSymbolHandler&)            = delete;
+    LinuxBacktraceSymbolHandler& operator=(const LinuxBacktraceSymbolHandler&) = delete;
+
+    ~LinuxBacktraceSymbolHandler() override;
+
+protected:
+    void LoadSymbols() override;
+    SymbolInfo LookupSymbol(void* address) override;
+};
+
+typedef LinuxBacktraceSymbolHandler BacktraceSymbolHandler;
+
+} // namespace Engine
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../Base/BaseDynamicLibrary.h"
+
+class LinuxDynamicLibrary : public BaseDynamicLibrary
+{
+public:
+    bool IsValid() override final { return libraryHandle != nullptr; }
+
+    LinuxDynamicLibrary() = default;
+
+    explicit LinuxDynamicLibrary(const std::filesystem::path& libraryPath) { Load(libraryPath); }
+
+    LinuxDynamicLibrary(const LinuxDynamicLibrary& other) { Load(other.libraryPath); }
+
+    LinuxDynamicLibrary& operator=(const LinuxDynamicLibrary& other)
+    {
+        if (this == &other)
+            return *this;
+
+        Load(other.libraryPath);
+        return *this;
+    }
+
+    void Load(const std::filesystem::path& libraryPath) override final;
+    void Unload() override final;
+
+private:
+    void* libraryHandle = nullptr;
+
+    void* GetRawFunctionPtr(const std::string& functionName) override final;
+};
+
+typedef LinuxDynamicLibrary DynamicLibrary;
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../Base/BaseFiber.h"
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <ucontext.h>
+
+class ENGINE_API LinuxFiber : public BaseFiber
+{
+public:
+    bool IsValid() override final { return isValid; }
+
+    LinuxFiber() = default;
+    ~LinuxFiber();
+
+    LinuxFiber(const LinuxFiber&)            = delete;
+    LinuxFiber& operator=(const LinuxFiber&) = delete;
+
+    bool Create(FiberFunction function, void* data, size_t stackSize = defaultStackSize) override final;
+    bool ConvertCurrentThread() override final;
+    void ConvertBackToThread() override final;
+
+    /// Switch the calling thread from currentFiber, which has to be the fiber it's running, to this one.
+    void SwitchFrom(LinuxFiber& currentFiber);
+
+private:
+    ucontext_t context = {};
+    /// The mapping the stack lives in, which starts with the guard page.
+    void* stackMapping      = nullptr;
+    size_t stackMappingSize = 0;
+    bool isValid            = false;
+
+    /// ThreadSanitizer's own record of the fiber, when it's enabled.
+    void* sanitizerFiber = nullptr;
+
+    /// Unmap the stack, if this has one, along with anything else Create() set up for it.
+    void ReleaseStack();
+
+    static void Start(unsigned int dataHigh, unsigned int dataLow);
+};
+
+typedef LinuxFiber Fiber;
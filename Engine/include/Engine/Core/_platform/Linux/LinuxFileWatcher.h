@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../Base/BaseFileWatcher.h"
+
+#include <thread>
+
+class LinuxFileWatcher : public BaseFileWatcher
+{
+public:
+    bool IsValid() override final { return watchThread.joinable(); }
+
+    LinuxFileWatcher() = default;
+    ~LinuxFileWatcher() { Stop(); }
+
+    LinuxFileWatcher(const LinuxFileWatcher&)            = delete;
+    LinuxFileWatcher& operator=(const LinuxFileWatcher&) = delete;
+
+    bool Start(const std::filesystem::path& path, ChangeCallback onChanged) override final;
+    void Stop() override final;
+
+private:
+    int inotifyDescriptor = -1;
+    /// An eventfd that wakes the watch thread up to stop it.
+    int stopDescriptor = -1;
+    std::thread watchThread;
+
+    void WatchForChanges();
+};
+
+typedef LinuxFileWatcher FileWatcher;
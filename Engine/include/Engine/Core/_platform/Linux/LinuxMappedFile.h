@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../Base/BaseMappedFile.h"
+
+class LinuxMappedFile : public BaseMappedFile
+{
+public:
+    bool IsValid() override final { return data != nullptr; }
+
+    LinuxMappedFile() = default;
+    ~LinuxMappedFile() { Close(size); }
+
+    LinuxMappedFile(const LinuxMappedFile&)            = delete;
+    LinuxMappedFile& operator=(const LinuxMappedFile&) = delete;
+
+    bool Create(const std::filesystem::path& path, size_t size) override final;
+    void Close(size_t finalSize) override final;
+
+private:
+    int fileDescriptor = -1;
+};
+
+typedef LinuxMappedFile MappedFile;
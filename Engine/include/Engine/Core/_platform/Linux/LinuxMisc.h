@@ -0,0 +1,21 @@
+#pragma once
+
+#include <csignal>
+
+namespace Engine
+{
+
+#if !ADHOC_RELEASE
+    #if defined(__x86_64__) || defined(__i386__)
+        /// Portably trigger a breakpoint in the debugger.
+        #define DEBUG_BREAK() __asm__("int $3")
+    #else
+        /// Portably trigger a breakpoint in the debugger.
+        #define DEBUG_BREAK() std::raise(SIGTRAP)
+    #endif
+#else
+    /// Portably trigger a breakpoint in the debugger.
+    #define DEBUG_BREAK()
+#endif
+
+} // namespace Engine
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <time.h>
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+namespace Engine
+{
+
+struct ENGINE_API LinuxPlatformData
+{
+public:
+    /// ReadTimestampCounter() ticks per second, zero until InitializePlatformData() has calibrated it.
+    uint64_t timestampCounterFrequency = 0;
+    /// Whether the timestamp counter ticks at a constant rate across cores and power states. If it doesn't, it's
+    /// only good for rough measurements and GetMonotonicRawNanoseconds() should be used instead.
+    bool isTimestampCounterInvariant = false;
+
+    static const LinuxPlatformData& GetInstance();
+
+    LinuxPlatformData()  = default;
+    ~LinuxPlatformData() = default;
+
+    LinuxPlatformData(const LinuxPlatformData&)            = delete;
+    LinuxPlatformData& operator=(const LinuxPlatformData&) = delete;
+};
+
+#if ADHOC_INTERNAL
+ENGINE_API LinuxPlatformData& GetMutablePlatformData();
+ENGINE_API void InitializePlatformData();
+#endif
+
+typedef LinuxPlatformData PlatformData;
+
+/// Nanoseconds on CLOCK_MONOTONIC_RAW, which unlike CLOCK_MONOTONIC is never slewed by NTP, so short intervals are
+/// measured at the hardware's rate.
+inline uint64_t GetMonotonicRawNanoseconds()
+{
+    auto time = timespec();
+    clock_gettime(CLOCK_MONOTONIC_RAW, &time);
+    return static_cast<uint64_t>(time.tv_sec) * 1000000000ull + static_cast<uint64_t>(time.tv_nsec);
+}
+
+/// The cheapest available timestamp, for timing short spans. Convert ticks with PlatformData's
+/// timestampCounterFrequency.
+inline uint64_t ReadTimestampCounter()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return GetMonotonicRawNanoseconds();
+#endif
+}
+
+} // namespace Engine
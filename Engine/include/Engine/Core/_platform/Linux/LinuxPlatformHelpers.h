@@ -0,0 +1,8 @@
+#pragma once
+
+namespace Engine::Linux
+{
+
+// Unused
+
+}
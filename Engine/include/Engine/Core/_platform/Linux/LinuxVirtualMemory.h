@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../Base/BaseVirtualMemory.h"
+#include <Engine/Core/SymbolExportMacros.h>
+
+class ENGINE_API LinuxVirtualMemory : public BaseVirtualMemory
+{
+public:
+    bool IsValid() override final { return data != nullptr; }
+
+    LinuxVirtualMemory() = default;
+    ~LinuxVirtualMemory() { Release(); }
+
+    LinuxVirtualMemory(const LinuxVirtualMemory&)            = delete;
+    LinuxVirtualMemory& operator=(const LinuxVirtualMemory&) = delete;
+
+    bool Reserve(size_t size) override final;
+    bool Commit(size_t size) override final;
+    void Decommit(size_t size) override final;
+    void Release() override final;
+};
+
+typedef LinuxVirtualMemory VirtualMemory;
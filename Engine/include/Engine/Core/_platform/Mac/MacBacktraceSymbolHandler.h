@@ -1,10 +1,25 @@
 #pragma once
 
 #include "../Base/BaseBacktraceSymbolHandler.h"
+#include <Engine/Core/SymbolExportMacros.h>
 
 namespace Engine
 {
 
-typedef BaseBacktraceSymbolHandler BacktraceSymbolHandler;
+class ENGINE_API MacBacktraceSymbolHandler : public BaseBacktraceSymbolHandler
+{
+public:
+    MacBacktraceSymbolHandler() = default;
+
+    MacBacktraceSymbolHandler(const MacBacktraceSymbolHandler&)            = delete;
+    MacBacktraceSymbolHandler& operator=(const MacBacktraceSymbolHandler&) = delete;
+
+    ~MacBacktraceSymbolHandler() override = default;
+
+protected:
+    SymbolInfo LookupSymbol(void* address) override;
+};
+
+typedef MacBacktraceSymbolHandler BacktraceSymbolHandler;
 
-}
+} // namespace Engine
@@ -18,16 +18,16 @@ public:
         if (this == &other)
             return *this;
 
-        Unload();
         Load(other.libraryPath);
         return *this;
     }
 
+    void Load(const std::filesystem::path& libraryPath) override final;
+    void Unload() override final;
+
 private:
     void* libraryHandle = nullptr;
 
-    void Load(const std::filesystem::path& libraryPath) override final;
-    void Unload() override final;
     void* GetRawFunctionPtr(const std::string& functionName) override final;
 };
 
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../Base/BaseFiber.h"
+#include <Engine/Core/SymbolExportMacros.h>
+
+#include <memory>
+
+/// ucontext_t needs _XOPEN_SOURCE, which can't be defined this late in whatever includes this.
+struct MacFiberContext;
+
+class ENGINE_API MacFiber : public BaseFiber
+{
+public:
+    bool IsValid() override final { return isValid; }
+
+    MacFiber();
+    ~MacFiber();
+
+    MacFiber(const MacFiber&)            = delete;
+    MacFiber& operator=(const MacFiber&) = delete;
+
+    bool Create(FiberFunction function, void* data, size_t stackSize = defaultStackSize) override final;
+    bool ConvertCurrentThread() override final;
+    void ConvertBackToThread() override final;
+
+    /// Switch the calling thread from currentFiber, which has to be the fiber it's running, to this one.
+    void SwitchFrom(MacFiber& currentFiber);
+
+private:
+    std::unique_ptr<MacFiberContext> context;
+    /// The mapping the stack lives in, which starts with the guard page.
+    void* stackMapping      = nullptr;
+    size_t stackMappingSize = 0;
+    bool isValid            = false;
+
+    /// Unmap the stack, if this has one, along with anything else Create() set up for it.
+    void ReleaseStack();
+
+    static void Start(unsigned int dataHigh, unsigned int dataLow);
+};
+
+typedef MacFiber Fiber;
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../Base/BaseFileWatcher.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+class MacFileWatcher : public BaseFileWatcher
+{
+public:
+    bool IsValid() override final { return watchThread.joinable(); }
+
+    MacFileWatcher() = default;
+    ~MacFileWatcher() { Stop(); }
+
+    MacFileWatcher(const MacFileWatcher&)            = delete;
+    MacFileWatcher& operator=(const MacFileWatcher&) = delete;
+
+    bool Start(const std::filesystem::path& path, ChangeCallback onChanged) override final;
+    void Stop() override final;
+
+private:
+    std::mutex stopMutex;
+    std::condition_variable stopCondition;
+    bool isStopRequested = false;
+    std::thread watchThread;
+
+    void WatchForChanges();
+};
+
+typedef MacFileWatcher FileWatcher;
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../Base/BaseMappedFile.h"
+
+class MacMappedFile : public BaseMappedFile
+{
+public:
+    bool IsValid() override final { return data != nullptr; }
+
+    MacMappedFile() = default;
+    ~MacMappedFile() { Close(size); }
+
+    MacMappedFile(const MacMappedFile&)            = delete;
+    MacMappedFile& operator=(const MacMappedFile&) = delete;
+
+    bool Create(const std::filesystem::path& path, size_t size) override final;
+    void Close(size_t finalSize) override final;
+
+private:
+    int fileDescriptor = -1;
+};
+
+typedef MacMappedFile MappedFile;
@@ -1,9 +1,5 @@
 #pragma once
 
-#include <alloca.h>
-
-#include <string>
-
 namespace Engine
 {
 
@@ -20,13 +16,4 @@ namespace Engine
     #define DEBUG_BREAK()
 #endif
 
-/// Portably allocate on the extended stack.
-inline void* StackAlloc(size_t size)
-{
-    return alloca(size);
-}
-
-/// Print the current call stack.
-std::string GetBacktrace();
-
 } // namespace Engine
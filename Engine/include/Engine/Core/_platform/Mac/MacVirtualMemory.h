@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../Base/BaseVirtualMemory.h"
+#include <Engine/Core/SymbolExportMacros.h>
+
+class ENGINE_API MacVirtualMemory : public BaseVirtualMemory
+{
+public:
+    bool IsValid() override final { return data != nullptr; }
+
+    MacVirtualMemory() = default;
+    ~MacVirtualMemory() { Release(); }
+
+    MacVirtualMemory(const MacVirtualMemory&)            = delete;
+    MacVirtualMemory& operator=(const MacVirtualMemory&) = delete;
+
+    bool Reserve(size_t size) override final;
+    bool Commit(size_t size) override final;
+    void Decommit(size_t size) override final;
+    void Release() override final;
+};
+
+typedef MacVirtualMemory VirtualMemory;
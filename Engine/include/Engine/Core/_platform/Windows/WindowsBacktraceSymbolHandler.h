@@ -18,6 +18,10 @@ public:
 
     ~WindowsBacktraceSymbolHandler() override;
 
+protected:
+    void LoadSymbols() override;
+    SymbolInfo LookupSymbol(void* address) override;
+
 private:
     bool isValid = false;
 };
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "../Base/BaseFiber.h"
+#include <Engine/Core/SymbolExportMacros.h>
+
+class ENGINE_API WindowsFiber : public BaseFiber
+{
+public:
+    bool IsValid() override final { return fiberHandle != nullptr; }
+
+    WindowsFiber() = default;
+    ~WindowsFiber();
+
+    WindowsFiber(const WindowsFiber&)            = delete;
+    WindowsFiber& operator=(const WindowsFiber&) = delete;
+
+    bool Create(FiberFunction function, void* data, size_t stackSize = defaultStackSize) override final;
+    bool ConvertCurrentThread() override final;
+    void ConvertBackToThread() override final;
+
+    /// Switch the calling thread from currentFiber, which has to be the fiber it's running, to this one.
+    void SwitchFrom(WindowsFiber& currentFiber);
+
+private:
+    void* fiberHandle      = nullptr;
+    bool isConvertedThread = false;
+
+    static void __stdcall Start(void* fiber);
+};
+
+typedef WindowsFiber Fiber;
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../Base/BaseFileWatcher.h"
+
+#include <windows.h>
+
+#include <thread>
+
+#if !ADHOC_WINDOWS
+static_assert(false);
+#endif
+
+class WindowsFileWatcher : public BaseFileWatcher
+{
+public:
+    bool IsValid() override final { return watchThread.joinable(); }
+
+    WindowsFileWatcher() = default;
+    ~WindowsFileWatcher() { Stop(); }
+
+    WindowsFileWatcher(const WindowsFileWatcher&)            = delete;
+    WindowsFileWatcher& operator=(const WindowsFileWatcher&) = delete;
+
+    bool Start(const std::filesystem::path& path, ChangeCallback onChanged) override final;
+    void Stop() override final;
+
+private:
+    HANDLE changeNotification = INVALID_HANDLE_VALUE;
+    HANDLE stopEvent          = NULL;
+    std::thread watchThread;
+
+    void WatchForChanges();
+};
+
+typedef WindowsFileWatcher FileWatcher;
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../Base/BaseMappedFile.h"
+
+#include <windows.h>
+
+#if !ADHOC_WINDOWS
+static_assert(false);
+#endif
+
+class WindowsMappedFile : public BaseMappedFile
+{
+public:
+    bool IsValid() override final { return data != nullptr; }
+
+    WindowsMappedFile() = default;
+    ~WindowsMappedFile() { Close(size); }
+
+    WindowsMappedFile(const WindowsMappedFile&)            = delete;
+    WindowsMappedFile& operator=(const WindowsMappedFile&) = delete;
+
+    bool Create(const std::filesystem::path& path, size_t size) override final;
+    void Close(size_t finalSize) override final;
+
+private:
+    HANDLE fileHandle    = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = NULL;
+};
+
+typedef WindowsMappedFile MappedFile;
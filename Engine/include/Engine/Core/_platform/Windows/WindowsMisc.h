@@ -2,10 +2,6 @@
 
 #include <Engine/Core/SymbolExportMacros.h>
 
-#include <malloc.h>
-
-#include <string>
-
 namespace Engine
 {
 
@@ -17,13 +13,4 @@ namespace Engine
     #define DEBUG_BREAK()
 #endif
 
-/// Portably allocate on the extended stack.
-inline void* StackAlloc(size_t size)
-{
-    return _malloca(size);
-}
-
-/// Print the current call stack.
-ENGINE_API std::string GetBacktrace();
-
 } // namespace Engine
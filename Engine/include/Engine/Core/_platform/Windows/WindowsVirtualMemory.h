@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../Base/BaseVirtualMemory.h"
+#include <Engine/Core/SymbolExportMacros.h>
+
+class ENGINE_API WindowsVirtualMemory : public BaseVirtualMemory
+{
+public:
+    bool IsValid() override final { return data != nullptr; }
+
+    WindowsVirtualMemory() = default;
+    ~WindowsVirtualMemory() { Release(); }
+
+    WindowsVirtualMemory(const WindowsVirtualMemory&)            = delete;
+    WindowsVirtualMemory& operator=(const WindowsVirtualMemory&) = delete;
+
+    bool Reserve(size_t size) override final;
+    bool Commit(size_t size) override final;
+    void Decommit(size_t size) override final;
+    void Release() override final;
+};
+
+typedef WindowsVirtualMemory VirtualMemory;
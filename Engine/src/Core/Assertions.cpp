@@ -2,7 +2,11 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <cstdlib>
+#include <iterator>
+#include <mutex>
+#include <new>
 #include <source_location>
 
 using Engine::Console::LogLevel;
@@ -85,10 +89,241 @@ void LogAssertionTrap(const bool isFatal,
     Console::Internal::LogImplementation(isFatal ? LogLevel::Fatal : LogLevel::Error, formattedMessage);
 }
 
+/// A copy of what describes a site, along with its stats, which stays behind when the module the site was compiled into
+/// is unloaded. The strings are stored right after it.
+struct RegisteredAssertion
+{
+    AssertionStats stats;
+
+    std::string_view file;
+    std::string_view function;
+    std::string_view expression;
+    uint32_t line;
+    uint32_t column;
+    bool isFatal;
+
+    RegisteredAssertion* next;
+};
+
+// Sites are only ever pushed onto the front, and never removed, so reading them needs no lock
+static std::atomic<RegisteredAssertion*> registeredAssertions = nullptr;
+static std::mutex registrationMutex;
+
+static std::atomic<int64_t> assertionReportIntervalNanoseconds =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::seconds(1)).count();
+
+static std::atomic<uint32_t> slowAssertionSampleRate = 1;
+
+static bool IsSameSite(const RegisteredAssertion& assertion, const AssertionSite& site)
+{
+    return assertion.line == site.location.line() && assertion.column == site.location.column() &&
+           assertion.expression == site.expression && assertion.file == site.location.file_name() &&
+           assertion.function == site.location.function_name();
+}
+
+AssertionStats& RegisterAssertionRecord(AssertionRecord& record)
+{
+    const auto& site = record.site;
+    auto lock        = std::scoped_lock(registrationMutex);
+
+    // The first hit can race, so another thread may have got here first
+    if (auto* stats = record.stats.load(std::memory_order_acquire))
+        return *stats;
+
+    // A site that's reached again after its module has been reloaded carries on with the stats it had. Registering
+    // only happens once for each site, so a search through all of them is fine.
+    auto* assertion = registeredAssertions.load(std::memory_order_relaxed);
+    while (assertion && !IsSameSite(*assertion, site))
+        assertion = assertion->next;
+
+    if (!assertion)
+    {
+        // From the C heap rather than operator new, like the scratch arenas, so a site's first hit doesn't show up as
+        // an allocation by whatever reached it
+        const auto file       = std::string_view(site.location.file_name());
+        const auto function   = std::string_view(site.location.function_name());
+        const auto expression = site.expression;
+        auto* memory          = static_cast<char*>(
+            std::malloc(sizeof(RegisteredAssertion) + file.size() + function.size() + expression.size()));
+        if (!memory)
+            std::abort();
+
+        auto* strings         = memory + sizeof(RegisteredAssertion);
+        const auto copyString = [&strings](std::string_view string)
+        {
+            const auto copy = std::string_view(strings, string.size());
+            strings         = std::copy(string.begin(), string.end(), strings);
+            return copy;
+        };
+
+        assertion = new (memory) RegisteredAssertion{
+            .file       = copyString(file),
+            .function   = copyString(function),
+            .expression = copyString(expression),
+            .line       = site.location.line(),
+            .column     = site.location.column(),
+            .isFatal    = site.isFatal,
+            .next       = registeredAssertions.load(std::memory_order_relaxed),
+        };
+        registeredAssertions.store(assertion, std::memory_order_release);
+    }
+
+    record.stats.store(&assertion->stats, std::memory_order_release);
+    return assertion->stats;
+}
+
+bool RecordAssertionFailure(AssertionRecord& record)
+{
+    auto& stats = *record.stats.load(std::memory_order_relaxed);
+    stats.failureCount.fetch_add(1, std::memory_order_relaxed);
+
+    const auto failureTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::system_clock::now().time_since_epoch())
+                                   .count();
+    auto noFailureTimeMs = int64_t(0);
+    stats.firstFailureTimeMs.compare_exchange_strong(noFailureTimeMs, failureTimeMs, std::memory_order_relaxed);
+    stats.lastFailureTimeMs.store(failureTimeMs, std::memory_order_relaxed);
+
+    if (!record.site.isFatal)
+    {
+        const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count();
+
+        // Only the thread that moves the report time forward gets to log
+        auto lastReportTime = stats.lastReportTime.load(std::memory_order_relaxed);
+        if ((lastReportTime != 0 &&
+             now - lastReportTime < assertionReportIntervalNanoseconds.load(std::memory_order_relaxed)) ||
+            !stats.lastReportTime.compare_exchange_strong(lastReportTime, now, std::memory_order_relaxed))
+        {
+            stats.unreportedFailureCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    if (const auto unreportedFailureCount = stats.unreportedFailureCount.exchange(0, std::memory_order_relaxed))
+    {
+        // Fatal failures are never held back, so these can only be from Expect_* style assertions
+        Console::LogError("Assertion at {}:{} failed {} more time(s) without being logged",
+                          record.site.location.file_name(),
+                          record.site.location.line(),
+                          unreportedFailureCount);
+    }
+
+    return true;
+}
+
+bool ReportBooleanAssertionFailure(AssertionRecord& record,
+                                   const bool expectedResult,
+                                   const bool actualResult,
+                                   const std::string_view fmtMessage)
+{
+    if (!RecordAssertionFailure(record))
+        return false;
+
+    const auto& site = record.site;
+    LogBooleanAssertionFailure(site.isFatal, site.expression, expectedResult, actualResult, fmtMessage, site.location);
+    return true;
+}
+
+bool ReportAssertionTrap(AssertionRecord& record, const std::string_view fmtMessage)
+{
+    if (!RecordAssertionFailure(record))
+        return false;
+
+    const auto& site = record.site;
+    LogAssertionTrap(site.isFatal, site.expression, fmtMessage, site.location);
+    return true;
+}
+
+uint32_t GetSlowAssertionSampleRate()
+{
+    return slowAssertionSampleRate.load(std::memory_order_relaxed);
+}
+
 void TriggerFatalErrorResponse()
 {
     // TODO: Throw exception up to Launcher in editor builds
+    Console::Flush();
     std::abort();
 }
 
 } // namespace Engine::Internal
+
+namespace Engine
+{
+
+static void AppendJsonString(fmt::memory_buffer& json, std::string_view string)
+{
+    json.push_back('"');
+    for (const auto character : string)
+    {
+        switch (character)
+        {
+        case '"':
+            fmt::format_to(std::back_inserter(json), "\\\"");
+            break;
+        case '\\':
+            fmt::format_to(std::back_inserter(json), "\\\\");
+            break;
+        default:
+            if (static_cast<unsigned char>(character) < 0x20)
+                fmt::format_to(std::back_inserter(json), "\\u{:04x}", static_cast<int>(character));
+            else
+                json.push_back(character);
+        }
+    }
+    json.push_back('"');
+}
+
+static void AppendJsonTime(fmt::memory_buffer& json, int64_t timeMs)
+{
+    if (timeMs == 0)
+        fmt::format_to(std::back_inserter(json), "null");
+    else
+        fmt::format_to(std::back_inserter(json), "{}", timeMs);
+}
+
+void SetAssertionReportInterval(std::chrono::milliseconds interval)
+{
+    Internal::assertionReportIntervalNanoseconds.store(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count(), std::memory_order_relaxed);
+}
+
+void SetSlowAssertionSampleRate(uint32_t sampleRate)
+{
+    Internal::slowAssertionSampleRate.store(std::max<uint32_t>(sampleRate, 1), std::memory_order_relaxed);
+}
+
+std::string GetAssertionStatsJson()
+{
+    auto json = fmt::memory_buffer();
+    fmt::format_to(std::back_inserter(json), "[");
+
+    auto* assertion = Internal::registeredAssertions.load(std::memory_order_acquire);
+    for (auto isFirst = true; assertion != nullptr; assertion = assertion->next, isFirst = false)
+    {
+        const auto& stats = assertion->stats;
+
+        fmt::format_to(std::back_inserter(json), "{}\n  {{\"file\": ", isFirst ? "" : ",");
+        AppendJsonString(json, assertion->file);
+        fmt::format_to(std::back_inserter(json), ", \"line\": {}, \"function\": ", assertion->line);
+        AppendJsonString(json, assertion->function);
+        fmt::format_to(std::back_inserter(json), ", \"expression\": ");
+        AppendJsonString(json, assertion->expression);
+        fmt::format_to(std::back_inserter(json),
+                       ", \"isFatal\": {}, \"hitCount\": {}, \"failureCount\": {}, \"firstFailureTimeMs\": ",
+                       assertion->isFatal,
+                       stats.hitCount.load(std::memory_order_relaxed),
+                       stats.failureCount.load(std::memory_order_relaxed));
+        AppendJsonTime(json, stats.firstFailureTimeMs.load(std::memory_order_relaxed));
+        fmt::format_to(std::back_inserter(json), ", \"lastFailureTimeMs\": ");
+        AppendJsonTime(json, stats.lastFailureTimeMs.load(std::memory_order_relaxed));
+        fmt::format_to(std::back_inserter(json), "}}");
+    }
+
+    fmt::format_to(std::back_inserter(json), "\n]\n");
+    return fmt::to_string(json);
+}
+
+} // namespace Engine
@@ -0,0 +1,238 @@
+#include "AsyncLogger.h"
+
+#include <Engine/Core/Assertions.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <bit>
+#include <thread>
+#include <utility>
+
+namespace Engine::Console::Internal
+{
+
+static thread_local bool isLoggingThread = false;
+
+AsyncLogQueue::AsyncLogQueue(size_t capacity)
+    : slots(std::make_unique<Slot[]>(std::bit_ceil(std::max<size_t>(capacity, 2)))),
+      mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1)
+{
+    for (uint64_t i = 0; i <= mask; ++i)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+bool AsyncLogQueue::TryPush(LogRecord& record)
+{
+    auto position = pushPosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto& slot          = slots[position & mask];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto distance = static_cast<int64_t>(sequence - position);
+
+        if (distance == 0)
+        {
+            if (pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot.record = std::move(record);
+                slot.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (distance < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = pushPosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLogQueue::TryPop(LogRecord& record)
+{
+    auto position = popPosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto& slot          = slots[position & mask];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto distance = static_cast<int64_t>(sequence - (position + 1));
+
+        if (distance == 0)
+        {
+            if (popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                record = std::move(slot.record);
+                slot.sequence.store(position + mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (distance < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = popPosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLogQueue::IsEmpty() const
+{
+    return popPosition.load(std::memory_order_seq_cst) >= pushPosition.load(std::memory_order_seq_cst);
+}
+
+AsyncLogger::AsyncLogger(const AsyncLogOptions& options, LogDispatchFunction dispatch)
+    : queue(options.queueCapacity), overflowPolicy(options.overflowPolicy), dispatch(dispatch)
+{
+    loggingThread = std::thread(&AsyncLogger::LoggingThreadMain, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    isStopRequested.store(true, std::memory_order_seq_cst);
+    wakeSignal.fetch_add(1, std::memory_order_release);
+    wakeSignal.notify_one();
+
+    if (loggingThread.joinable())
+        loggingThread.join();
+
+    // Anything pushed after the logging thread's final pass is delivered here
+    Drain();
+}
+
+void AsyncLogger::Push(LogLevel logLevel, std::string_view message)
+{
+    auto record = LogRecord{logLevel, std::string(message)};
+
+    while (!queue.TryPush(record))
+    {
+        switch (overflowPolicy)
+        {
+        case LogOverflowPolicy::Block:
+            WakeLoggingThread();
+            std::this_thread::yield();
+            break;
+        case LogOverflowPolicy::DropNewest:
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            WakeLoggingThread();
+            return;
+        case LogOverflowPolicy::DropOldest:
+        {
+            auto evictedRecord = LogRecord{};
+            if (queue.TryPop(evictedRecord))
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        default: Assert_NoEntry(); return;
+        }
+    }
+
+    WakeLoggingThread();
+}
+
+void AsyncLogger::Flush()
+{
+    if (IsLoggingThread())
+    {
+        Drain();
+        return;
+    }
+
+    const auto ticket = flushRequestCount.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+    wakeSignal.fetch_add(1, std::memory_order_release);
+    wakeSignal.notify_one();
+
+    auto completed = flushCompleteCount.load(std::memory_order_acquire);
+    while (completed < ticket)
+    {
+        flushCompleteCount.wait(completed, std::memory_order_acquire);
+        completed = flushCompleteCount.load(std::memory_order_acquire);
+    }
+}
+
+bool AsyncLogger::IsLoggingThread()
+{
+    return isLoggingThread;
+}
+
+void AsyncLogger::LoggingThreadMain()
+{
+    isLoggingThread = true;
+
+    while (true)
+    {
+        const auto observedSignal = wakeSignal.load(std::memory_order_acquire);
+        const auto isStopping     = isStopRequested.load(std::memory_order_acquire);
+        const auto flushTicket    = flushRequestCount.load(std::memory_order_seq_cst);
+
+        Drain();
+
+        if (flushTicket != flushCompleteCount.load(std::memory_order_relaxed))
+        {
+            flushCompleteCount.store(flushTicket, std::memory_order_release);
+            flushCompleteCount.notify_all();
+        }
+
+        if (isStopping)
+            break;
+
+        isThreadIdle.store(true, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (queue.IsEmpty() && !isStopRequested.load(std::memory_order_seq_cst))
+            wakeSignal.wait(observedSignal, std::memory_order_acquire);
+
+        isThreadIdle.store(false, std::memory_order_relaxed);
+    }
+}
+
+void AsyncLogger::Drain()
+{
+    auto record = LogRecord{};
+
+    while (true)
+    {
+        if (queue.TryPop(record))
+        {
+            dispatch(record.logLevel, record.message);
+            continue;
+        }
+
+        if (queue.IsEmpty())
+            break;
+
+        // A producer has claimed a slot but hasn't finished writing to it yet
+        std::this_thread::yield();
+    }
+
+    ReportDroppedRecords();
+}
+
+void AsyncLogger::WakeLoggingThread()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (isThreadIdle.load(std::memory_order_relaxed))
+    {
+        wakeSignal.fetch_add(1, std::memory_order_release);
+        wakeSignal.notify_one();
+    }
+}
+
+void AsyncLogger::ReportDroppedRecords()
+{
+    const auto dropped = droppedCount.exchange(0, std::memory_order_relaxed);
+    if (dropped == 0)
+        return;
+
+    dispatch(LogLevel::Warning, fmt::format("Async log queue overflowed! {} message(s) were dropped", dropped));
+}
+
+} // namespace Engine::Console::Internal
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <Engine/Core/Console.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace Engine::Console::Internal
+{
+
+struct LogRecord
+{
+    LogLevel logLevel = LogLevel::Log;
+    std::string message;
+};
+
+/// Bounded lock-free ring buffer of log records (Vyukov-style sequenced slots).
+/// Any number of threads may push. Popping is normally done by the logging thread, but producers may also pop to
+/// evict the oldest record, so pops are safe from any thread as well.
+class AsyncLogQueue
+{
+public:
+    explicit AsyncLogQueue(size_t capacity);
+
+    AsyncLogQueue(const AsyncLogQueue&)            = delete;
+    AsyncLogQueue& operator=(const AsyncLogQueue&) = delete;
+
+    bool TryPush(LogRecord& record);
+    bool TryPop(LogRecord& record);
+
+    bool IsEmpty() const;
+
+private:
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> sequence;
+        LogRecord record;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    const uint64_t mask;
+
+    alignas(64) std::atomic<uint64_t> pushPosition = 0;
+    alignas(64) std::atomic<uint64_t> popPosition  = 0;
+};
+
+typedef void (*LogDispatchFunction)(LogLevel logLevel, std::string_view message);
+
+/// Owns the queue and the thread that drains it into the registered LogStreams.
+class AsyncLogger
+{
+public:
+    AsyncLogger(const AsyncLogOptions& options, LogDispatchFunction dispatch);
+    ~AsyncLogger();
+
+    AsyncLogger(const AsyncLogger&)            = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    void Push(LogLevel logLevel, std::string_view message);
+    void Flush();
+
+    static bool IsLoggingThread();
+
+private:
+    AsyncLogQueue queue;
+    const LogOverflowPolicy overflowPolicy;
+    const LogDispatchFunction dispatch;
+
+    std::atomic<uint64_t> droppedCount       = 0;
+    std::atomic<uint64_t> flushRequestCount  = 0;
+    std::atomic<uint64_t> flushCompleteCount = 0;
+    std::atomic<uint32_t> wakeSignal         = 0;
+    std::atomic<bool> isThreadIdle           = false;
+    std::atomic<bool> isStopRequested        = false;
+
+    std::thread loggingThread;
+
+    void LoggingThreadMain();
+    void Drain();
+    void WakeLoggingThread();
+    void ReportDroppedRecords();
+};
+
+} // namespace Engine::Console::Internal
@@ -0,0 +1,221 @@
+#include <Engine/Core/BacktraceSymbolHandler.h>
+
+#include <Engine/Core/ScratchArena.h>
+#include <Engine/Core/StartupTrace.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Engine
+{
+
+static std::atomic<BaseBacktraceSymbolHandler*> activeSymbolHandler = nullptr;
+
+// Filled on demand and only emptied by ClearSymbolCache(), so references into it stay valid until then. Lookups are
+// serialized separately, since neither DbgHelp nor the cache's writers can run concurrently, but cache hits shouldn't
+// have to wait on them.
+static std::shared_mutex symbolCacheMutex;
+static std::unordered_map<void*, SymbolInfo> symbolCache;
+static std::mutex symbolLookupMutex;
+
+BaseBacktraceSymbolHandler* BaseBacktraceSymbolHandler::GetInstance()
+{
+    return activeSymbolHandler.load(std::memory_order_acquire);
+}
+
+BaseBacktraceSymbolHandler::BaseBacktraceSymbolHandler()
+{
+    activeSymbolHandler.store(this, std::memory_order_release);
+}
+
+BaseBacktraceSymbolHandler::~BaseBacktraceSymbolHandler()
+{
+    WaitForSymbols();
+
+    auto* expected = this;
+    activeSymbolHandler.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+}
+
+void BaseBacktraceSymbolHandler::StartLoadingSymbols()
+{
+    symbolLoadingThread = std::thread(
+        [this]
+        {
+            STARTUP_TRACE_SCOPE("Load symbols");
+            LoadSymbols();
+        });
+}
+
+void BaseBacktraceSymbolHandler::WaitForSymbols()
+{
+    if (symbolLoadingThread.joinable())
+        symbolLoadingThread.join();
+}
+
+static void FormatFrame(std::string& output, uint32_t index, void* address, const SymbolInfo& symbol)
+{
+    auto outputIterator = std::back_inserter(output);
+
+    fmt::format_to(outputIterator, "[{}] ({}) ", index, address);
+
+    if (symbol.function.empty())
+    {
+        if (symbol.module.empty())
+            output += "???";
+        else
+            fmt::format_to(outputIterator, "{}+{:#x}", symbol.module, symbol.offset);
+    }
+    else
+    {
+        if (!symbol.module.empty())
+            fmt::format_to(outputIterator, "{}!", symbol.module);
+
+        if (symbol.file.empty())
+            fmt::format_to(outputIterator, "{}+{:#x}", symbol.function, symbol.offset);
+        else
+            fmt::format_to(outputIterator, "{} ({}:{})", symbol.function, symbol.file, symbol.line);
+    }
+
+    output += '\n';
+}
+
+void BaseBacktraceSymbolHandler::ResolveSymbols(std::span<void* const> addresses)
+{
+    auto scratch          = ScratchScope();
+    auto missingAddresses = ScratchVector<void*>(ScratchAllocator<void*>(scratch));
+    missingAddresses.reserve(addresses.size());
+    {
+        const auto lock = std::shared_lock(symbolCacheMutex);
+        for (void* address : addresses)
+        {
+            if (!symbolCache.contains(address))
+                missingAddresses.push_back(address);
+        }
+    }
+
+    if (missingAddresses.empty())
+        return;
+
+    // In address order, consecutive lookups mostly land in the same module and compilation unit
+    std::sort(missingAddresses.begin(), missingAddresses.end());
+    missingAddresses.erase(std::unique(missingAddresses.begin(), missingAddresses.end()), missingAddresses.end());
+
+    const auto lookupLock = std::lock_guard(symbolLookupMutex);
+    WaitForSymbols();
+
+    auto symbols = std::vector<std::pair<void*, SymbolInfo>>();
+    symbols.reserve(missingAddresses.size());
+    {
+        // Another thread may have looked some of these up while this one waited
+        const auto lock = std::shared_lock(symbolCacheMutex);
+        for (void* address : missingAddresses)
+        {
+            if (!symbolCache.contains(address))
+                symbols.emplace_back(address, SymbolInfo());
+        }
+    }
+
+    for (auto& [address, symbol] : symbols)
+        symbol = LookupSymbol(address);
+
+    const auto lock = std::unique_lock(symbolCacheMutex);
+    for (auto& [address, symbol] : symbols)
+        symbolCache.emplace(address, std::move(symbol));
+}
+
+const SymbolInfo& BaseBacktraceSymbolHandler::ResolveSymbol(void* address)
+{
+    ResolveSymbols(std::span(&address, 1));
+
+    const auto lock = std::shared_lock(symbolCacheMutex);
+    return symbolCache.find(address)->second;
+}
+
+void BaseBacktraceSymbolHandler::ClearSymbolCache()
+{
+    const auto lookupLock = std::lock_guard(symbolLookupMutex);
+    const auto lock       = std::unique_lock(symbolCacheMutex);
+    symbolCache.clear();
+}
+
+std::string BaseBacktraceSymbolHandler::Symbolize(const StackTrace& stackTrace)
+{
+    return std::move(Symbolize(std::span(&stackTrace, 1)).front());
+}
+
+std::vector<std::string> BaseBacktraceSymbolHandler::Symbolize(std::span<const StackTrace> stackTraces)
+{
+    auto outputs = std::vector<std::string>(stackTraces.size());
+
+    auto scratch = ScratchScope();
+
+    // Index of the first occurrence of each distinct stack, keyed by hash
+    auto uniqueStackTraces  = std::unordered_multimap<uint64_t, size_t>();
+    auto duplicateOf        = scratch.AllocateArray<size_t>(stackTraces.size());
+    auto addressesToResolve = ScratchVector<void*>(ScratchAllocator<void*>(scratch));
+
+    for (size_t i = 0; i < stackTraces.size(); ++i)
+    {
+        const auto& stackTrace = stackTraces[i];
+        const auto hash        = stackTrace.GetHash();
+
+        duplicateOf[i]   = i;
+        const auto range = uniqueStackTraces.equal_range(hash);
+        for (auto candidate = range.first; candidate != range.second; ++candidate)
+        {
+            if (stackTraces[candidate->second] == stackTrace)
+            {
+                duplicateOf[i] = candidate->second;
+                break;
+            }
+        }
+
+        if (duplicateOf[i] != i)
+            continue;
+
+        uniqueStackTraces.emplace(hash, i);
+
+        const auto frames = stackTrace.GetFrames();
+        addressesToResolve.insert(addressesToResolve.end(), frames.begin(), frames.end());
+    }
+
+    ResolveSymbols(addressesToResolve);
+
+    const auto lock = std::shared_lock(symbolCacheMutex);
+    for (size_t i = 0; i < stackTraces.size(); ++i)
+    {
+        if (duplicateOf[i] != i)
+        {
+            outputs[i] = outputs[duplicateOf[i]];
+            continue;
+        }
+
+        const auto& stackTrace = stackTraces[i];
+        for (uint32_t frame = 0; frame < stackTrace.frameCount; ++frame)
+        {
+            void* address = stackTrace.frames[frame];
+            FormatFrame(outputs[i], frame, address, symbolCache.find(address)->second);
+        }
+    }
+
+    return outputs;
+}
+
+std::string GetBacktrace()
+{
+    const auto stackTrace = StackTrace::Capture();
+
+    if (auto* symbolHandler = BacktraceSymbolHandler::GetInstance())
+        return symbolHandler->Symbolize(stackTrace);
+
+    auto symbolHandler = BacktraceSymbolHandler();
+    return symbolHandler.Symbolize(stackTrace);
+}
+
+} // namespace Engine
@@ -1,66 +1,283 @@
 #include <Engine/Core/Console.h>
 
+#include "AsyncLogger.h"
+#include "DeferredLogger.h"
+
 #include <Engine/Core/Assertions.h>
 #include <Engine/Core/Misc.h>
+#include <Engine/Core/ScratchArena.h>
 
 #include <fmt/format.h>
 
 #include <algorithm>
-#include <forward_list>
+#include <atomic>
+#include <iterator>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 namespace Engine::Console
 {
 
 struct LogListenerInfo
 {
-    LogEventCallback callback;
+    LogEventViewCallback callback;
     LogLevel verbosity;
     unsigned int id;
 
-    LogListenerInfo(LogEventCallback callback, LogLevel verbosity, unsigned int id)
+    LogListenerInfo(LogEventViewCallback callback, LogLevel verbosity, unsigned int id)
         : callback(callback), verbosity(verbosity), id(id)
     {}
 };
 
-static std::forward_list<LogListenerInfo> logListenerRegistry;
+typedef std::vector<LogListenerInfo> LogListenerList;
+
+// The registry and the async logger are published through atomic pointers and read without any locking. Readers
+// count themselves into a per-thread shard for the current epoch, and writers (serialized by registryWriteMutex)
+// swap in a new pointer, then flip the epoch twice and wait for the previous epoch's readers to leave before freeing
+// whatever they replaced.
+
+static constexpr size_t registryReaderShardCount = 16;
 
-LogStream::LogStream(LogLevel verbosity, LogEventCallback callback) : callback(callback)
+struct alignas(64) RegistryReaderShard
 {
-    id = 0;
-    while (std::any_of(logListenerRegistry.begin(),
-                       logListenerRegistry.end(),
-                       [this](const LogListenerInfo& info) { return info.id == id; }))
+    std::atomic<uint32_t> readerCounts[2] = {0, 0};
+};
+
+static RegistryReaderShard registryReaderShards[registryReaderShardCount];
+static std::atomic<uint32_t> registryEpoch           = 0;
+static std::atomic<uint32_t> nextRegistryReaderShard = 0;
+
+static thread_local const size_t registryReaderShardIndex =
+    nextRegistryReaderShard.fetch_add(1, std::memory_order_relaxed) % registryReaderShardCount;
+static thread_local uint32_t registryReadDepth = 0;
+
+class RegistryReadSection
+{
+public:
+    RegistryReadSection()
+        : shard(registryReaderShards[registryReaderShardIndex]),
+          parity(registryEpoch.load(std::memory_order_seq_cst) & 1)
+    {
+        shard.readerCounts[parity].fetch_add(1, std::memory_order_seq_cst);
+        ++registryReadDepth;
+    }
+
+    ~RegistryReadSection()
     {
-        ++id;
+        --registryReadDepth;
+        shard.readerCounts[parity].fetch_sub(1, std::memory_order_release);
     }
 
-    logListenerRegistry.emplace_front(callback, verbosity, id);
+    RegistryReadSection(const RegistryReadSection&)            = delete;
+    RegistryReadSection& operator=(const RegistryReadSection&) = delete;
+
+private:
+    RegistryReaderShard& shard;
+    const uint32_t parity;
+};
+
+static std::mutex registryWriteMutex;
+static std::atomic<const LogListenerList*> logListenerRegistry = nullptr;
+static std::atomic<Internal::AsyncLogger*> asyncLogger         = nullptr;
+static std::atomic<Internal::DeferredLogger*> deferredLogger   = nullptr;
+static std::atomic<unsigned int> nextLogStreamId               = 0;
+
+static void WaitForRegistryReaders()
+{
+    // Creating or destroying a LogStream from inside a LogStream callback would wait on itself forever
+    Assert_Eq(registryReadDepth, 0u);
+
+    for (auto flip = 0; flip < 2; ++flip)
+    {
+        const auto previousParity = registryEpoch.fetch_add(1, std::memory_order_seq_cst) & 1;
+
+        for (auto& shard : registryReaderShards)
+        {
+            while (shard.readerCounts[previousParity].load(std::memory_order_acquire) != 0)
+                std::this_thread::yield();
+        }
+    }
 }
 
-LogStream::~LogStream()
+std::atomic<int> Internal::maxAcceptedLogLevel = -1;
+
+// Both only change under registryWriteMutex
+static std::atomic<int> maxLogStreamLevel = -1;
+static int binaryLogLevel                 = -1;
+
+static void PublishLogListeners(const LogListenerList* newListeners)
 {
-    logListenerRegistry.remove_if([this](const LogListenerInfo& info) { return info.id == id; });
+    auto maxLogLevel = -1;
+    for (const auto& listenerInfo : *newListeners)
+        maxLogLevel = std::max(maxLogLevel, static_cast<int>(listenerInfo.verbosity));
+
+    maxLogStreamLevel.store(maxLogLevel, std::memory_order_relaxed);
+    Internal::maxAcceptedLogLevel.store(std::max(maxLogLevel, binaryLogLevel), std::memory_order_relaxed);
+
+    const auto* oldListeners = logListenerRegistry.exchange(newListeners, std::memory_order_seq_cst);
+    WaitForRegistryReaders();
+    delete oldListeners;
 }
 
-namespace Internal
+LogStream::LogStream(LogLevel verbosity, LogEventViewCallback callback)
+    : callback(callback), id(nextLogStreamId.fetch_add(1, std::memory_order_relaxed))
 {
+    const auto lock = std::scoped_lock(registryWriteMutex);
+
+    const auto* currentListeners = logListenerRegistry.load(std::memory_order_relaxed);
+    auto* newListeners           = new LogListenerList();
+    newListeners->reserve((currentListeners ? currentListeners->size() : 0) + 1);
+
+    newListeners->emplace_back(callback, verbosity, id);
+    if (currentListeners)
+        newListeners->insert(newListeners->end(), currentListeners->begin(), currentListeners->end());
 
-void LogImplementation(LogLevel logLevel, const std::string& formattedMessage)
+    PublishLogListeners(newListeners);
+}
+
+LogStream::~LogStream()
+{
+    const auto lock = std::scoped_lock(registryWriteMutex);
+
+    const auto* currentListeners = logListenerRegistry.load(std::memory_order_relaxed);
+    auto* newListeners           = new LogListenerList(*currentListeners);
+    std::erase_if(*newListeners, [this](const LogListenerInfo& info) { return info.id == id; });
+
+    PublishLogListeners(newListeners);
+}
+
+static void DispatchToLogStreams(LogLevel logLevel, std::string_view formattedMessage)
 {
     static_assert(LogLevel::Fatal < LogLevel::Error);
     static_assert(LogLevel::Error < LogLevel::Warning);
     static_assert(LogLevel::Warning < LogLevel::Log);
     static_assert(LogLevel::Log < LogLevel::Trace);
 
-    for (const auto& callbackInfo : logListenerRegistry)
+    const auto readSection = RegistryReadSection();
+
+    const auto* listeners = logListenerRegistry.load(std::memory_order_seq_cst);
+    if (!listeners)
+        return;
+
+    for (const auto& callbackInfo : *listeners)
     {
         if (logLevel <= callbackInfo.verbosity)
             callbackInfo.callback(logLevel, formattedMessage);
     }
 }
 
+void EnableAsyncLogging(const AsyncLogOptions& options)
+{
+    DisableAsyncLogging();
+
+    const auto lock = std::scoped_lock(registryWriteMutex);
+    asyncLogger.store(new Internal::AsyncLogger(options, DispatchToLogStreams), std::memory_order_seq_cst);
+}
+
+void DisableAsyncLogging()
+{
+    const auto lock = std::scoped_lock(registryWriteMutex);
+
+    auto* logger = asyncLogger.exchange(nullptr, std::memory_order_seq_cst);
+    if (!logger)
+        return;
+
+    WaitForRegistryReaders();
+    delete logger;
+}
+
+bool IsAsyncLoggingEnabled()
+{
+    return asyncLogger.load(std::memory_order_acquire) != nullptr;
+}
+
+void EnableDeferredLogging(const DeferredLogOptions& options)
+{
+    DisableDeferredLogging();
+
+    const auto lock = std::scoped_lock(registryWriteMutex);
+
+    binaryLogLevel = options.binaryLogPath.empty() ? -1 : static_cast<int>(options.binaryLogVerbosity);
+    Internal::maxAcceptedLogLevel.store(std::max(maxLogStreamLevel.load(std::memory_order_relaxed), binaryLogLevel),
+                                        std::memory_order_relaxed);
+
+    deferredLogger.store(new Internal::DeferredLogger(options, maxLogStreamLevel), std::memory_order_seq_cst);
+}
+
+void DisableDeferredLogging()
+{
+    const auto lock = std::scoped_lock(registryWriteMutex);
+
+    auto* logger = deferredLogger.exchange(nullptr, std::memory_order_seq_cst);
+    if (!logger)
+        return;
+
+    WaitForRegistryReaders();
+    delete logger;
+
+    binaryLogLevel = -1;
+    Internal::maxAcceptedLogLevel.store(maxLogStreamLevel.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+bool IsDeferredLoggingEnabled()
+{
+    return deferredLogger.load(std::memory_order_acquire) != nullptr;
+}
+
+void Flush()
+{
+    const auto readSection = RegistryReadSection();
+
+    // Deferred records may be formatted into the async queue, so they have to be drained first
+    auto* pendingDeferredLogger = deferredLogger.load(std::memory_order_seq_cst);
+    if (pendingDeferredLogger)
+        pendingDeferredLogger->Drain();
+
+    auto* pendingAsyncLogger = asyncLogger.load(std::memory_order_seq_cst);
+    if (pendingAsyncLogger)
+        pendingAsyncLogger->Flush();
+}
+
+namespace Internal
+{
+
+void LogImplementation(LogLevel logLevel, std::string_view formattedMessage)
+{
+    {
+        const auto readSection = RegistryReadSection();
+
+        // Records this thread deferred earlier come first, since they were logged first
+        auto* pendingDeferredLogger = deferredLogger.load(std::memory_order_seq_cst);
+        if (pendingDeferredLogger)
+            pendingDeferredLogger->DrainCallingThread();
+
+        // Messages logged by LogStreams on the logging thread are delivered immediately so that a full queue can't
+        // deadlock the thread that is supposed to be emptying it
+        auto* logger = asyncLogger.load(std::memory_order_seq_cst);
+        if (logger && !AsyncLogger::IsLoggingThread())
+        {
+            logger->Push(logLevel, formattedMessage);
+            return;
+        }
+    }
+
+    DispatchToLogStreams(logLevel, formattedMessage);
+}
+
+void FormatAndLog(LogLevel logLevel, fmt::string_view message, fmt::format_args fmtArgs)
+{
+    // Messages that outgrow the buffer's inline storage continue in scratch memory rather than on the heap
+    auto scratch = ScratchScope();
+    auto buffer  = fmt::basic_memory_buffer<char, fmt::inline_buffer_size, ScratchAllocator<char>>(
+        ScratchAllocator<char>(scratch));
+    fmt::vformat_to(std::back_inserter(buffer), message, fmtArgs);
+
+    LogImplementation(logLevel, std::string_view(buffer.data(), buffer.size()));
+}
+
 } // namespace Internal
 
 std::ostream& operator<<(std::ostream& os, const LogLevel& logLevel)
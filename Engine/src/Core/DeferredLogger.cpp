@@ -0,0 +1,611 @@
+#include "DeferredLogger.h"
+
+#include <Engine/Core/Assertions.h>
+
+#include <fmt/args.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine::Console
+{
+
+namespace Internal
+{
+
+std::atomic<bool> isDeferredLoggingEnabled = false;
+
+// Binary log file layout: the magic and version, followed by a stream of entries. Each entry is a
+// BinaryLogEntryType byte followed by either a format string definition (id, length, characters) or a record exactly as
+// it was captured (BinaryLogRecordHeader then encoded arguments). A format string is always defined before the first
+// record that uses it.
+static constexpr char binaryLogMagic[8]    = {'A', 'D', 'H', 'O', 'C', 'L', 'O', 'G'};
+static constexpr uint32_t binaryLogVersion = 1;
+
+enum class BinaryLogEntryType : uint8_t
+{
+    FormatString,
+    Record,
+};
+
+// Marks the unused tail of a thread buffer when a record had to wrap around to the start
+static constexpr uint32_t paddingRecordId = UINT32_MAX;
+
+static size_t AlignRecordSize(size_t size)
+{
+    return (size + 7) & ~static_cast<size_t>(7);
+}
+
+// Format strings are copied the first time they're seen, since the module they're compiled into can be unloaded while
+// records still refer to them, and looked up by what they say, so a reloaded module gets the same IDs back
+static std::mutex formatStringTableMutex;
+static std::deque<std::string> formatStrings;
+static std::unordered_map<std::string_view, uint32_t> formatStringIds;
+
+struct CachedFormatStringId
+{
+    const char* address = nullptr;
+    uint32_t id         = 0;
+};
+
+// Each thread remembers the addresses it's already looked up, until a module is unloaded and they could be reused. The
+// ones it logged most recently are kept in a small table indexed by address, so most lookups are a single compare.
+static std::atomic<uint64_t> formatStringAddressGeneration = 0;
+static constexpr size_t threadFormatStringCacheSize        = 256;
+static thread_local std::array<CachedFormatStringId, threadFormatStringCacheSize> threadFormatStringCache;
+static thread_local std::unordered_map<const char*, uint32_t> threadFormatStringIds;
+static thread_local uint64_t threadFormatStringAddressGeneration = 0;
+
+uint32_t GetFormatStringId(std::string_view formatString)
+{
+    const auto addressGeneration = formatStringAddressGeneration.load(std::memory_order_acquire);
+    if (threadFormatStringAddressGeneration != addressGeneration) [[unlikely]]
+    {
+        threadFormatStringCache = {};
+        threadFormatStringIds.clear();
+        threadFormatStringAddressGeneration = addressGeneration;
+    }
+
+    const auto address = reinterpret_cast<uintptr_t>(formatString.data());
+    auto& cached       = threadFormatStringCache[(address ^ (address >> 8)) % threadFormatStringCacheSize];
+    if (cached.address == formatString.data())
+        return cached.id;
+
+    const auto threadIt = threadFormatStringIds.find(formatString.data());
+    if (threadIt != threadFormatStringIds.end())
+    {
+        cached = {.address = formatString.data(), .id = threadIt->second};
+        return threadIt->second;
+    }
+
+    const auto lock = std::scoped_lock(formatStringTableMutex);
+    auto it         = formatStringIds.find(formatString);
+    if (it == formatStringIds.end())
+    {
+        const auto& copy = formatStrings.emplace_back(formatString);
+        it               = formatStringIds.emplace(copy, static_cast<uint32_t>(formatStrings.size() - 1)).first;
+    }
+
+    threadFormatStringIds.emplace(formatString.data(), it->second);
+    cached = {.address = formatString.data(), .id = it->second};
+    return it->second;
+}
+
+static std::string_view GetFormatString(uint32_t formatStringId)
+{
+    const auto lock = std::scoped_lock(formatStringTableMutex);
+    return formatStrings[formatStringId];
+}
+
+// Single producer (the owning thread), single consumer (whoever holds drainMutex)
+struct DeferredLogThreadBuffer
+{
+    explicit DeferredLogThreadBuffer(size_t capacity)
+        : data(std::make_unique_for_overwrite<std::byte[]>(capacity)), capacity(capacity)
+    {}
+
+    const std::unique_ptr<std::byte[]> data;
+    const uint64_t capacity;
+
+    uint64_t pendingWritePosition = 0;
+
+    alignas(64) std::atomic<uint64_t> writePosition = 0;
+    /// Set by the producer for as long as it's between BeginDeferredRecord() and EndDeferredRecord(), so that the
+    /// logger can wait for it before its final drain.
+    std::atomic<bool> isWriting = false;
+
+    alignas(64) std::atomic<uint64_t> readPosition = 0;
+    std::atomic<bool> isOrphaned                   = false;
+};
+
+static std::mutex threadBufferRegistryMutex;
+static std::vector<std::unique_ptr<DeferredLogThreadBuffer>> threadBuffers;
+static std::atomic<size_t> threadBufferCapacity = 64 * 1024;
+
+struct DeferredLogThreadBufferHandle
+{
+    DeferredLogThreadBuffer* buffer = nullptr;
+
+    ~DeferredLogThreadBufferHandle()
+    {
+        // The buffer may still hold records, so it's freed by the next drain rather than here
+        if (buffer)
+            buffer->isOrphaned.store(true, std::memory_order_release);
+    }
+};
+
+static thread_local DeferredLogThreadBufferHandle threadBuffer;
+
+std::byte* BeginDeferredRecord(size_t size)
+{
+    const auto capacity = threadBufferCapacity.load(std::memory_order_relaxed);
+
+    auto* buffer = threadBuffer.buffer;
+    if (!buffer || buffer->capacity != capacity)
+    {
+        // A buffer left over from a previous configuration is retired like one whose thread exited
+        if (buffer)
+            buffer->isOrphaned.store(true, std::memory_order_release);
+
+        auto newBuffer = std::make_unique<DeferredLogThreadBuffer>(capacity);
+        buffer         = newBuffer.get();
+
+        const auto lock = std::scoped_lock(threadBufferRegistryMutex);
+        threadBuffers.push_back(std::move(newBuffer));
+        threadBuffer.buffer = buffer;
+    }
+
+    // Checked again now that the logger can see this thread is writing, since it may have been disabled since the
+    // caller checked. Either the logger waits for this record before its final drain, or the caller logs it directly.
+    buffer->isWriting.store(true, std::memory_order_seq_cst);
+    if (!isDeferredLoggingEnabled.load(std::memory_order_seq_cst))
+    {
+        buffer->isWriting.store(false, std::memory_order_release);
+        return nullptr;
+    }
+
+    const auto alignedSize = AlignRecordSize(size);
+    if (alignedSize > buffer->capacity / 2)
+    {
+        buffer->isWriting.store(false, std::memory_order_release);
+        return nullptr;
+    }
+
+    const auto writePosition = buffer->writePosition.load(std::memory_order_relaxed);
+    const auto readPosition  = buffer->readPosition.load(std::memory_order_acquire);
+    const auto offset        = writePosition % buffer->capacity;
+    const auto padding       = offset + alignedSize > buffer->capacity ? buffer->capacity - offset : 0;
+
+    if (writePosition + padding + alignedSize - readPosition > buffer->capacity)
+    {
+        buffer->isWriting.store(false, std::memory_order_release);
+        return nullptr;
+    }
+
+    if (padding != 0)
+    {
+        const auto paddingSize = static_cast<uint32_t>(padding);
+        std::memcpy(buffer->data.get() + offset, &paddingSize, sizeof(paddingSize));
+        std::memcpy(buffer->data.get() + offset + sizeof(uint32_t), &paddingRecordId, sizeof(paddingRecordId));
+    }
+
+    buffer->pendingWritePosition = writePosition + padding + alignedSize;
+    return buffer->data.get() + (writePosition + padding) % buffer->capacity;
+}
+
+void EndDeferredRecord()
+{
+    auto* buffer = threadBuffer.buffer;
+    buffer->writePosition.store(buffer->pendingWritePosition, std::memory_order_release);
+    buffer->isWriting.store(false, std::memory_order_release);
+}
+
+template <typename F>
+static void DrainThreadBuffer(DeferredLogThreadBuffer& buffer, F&& consumeRecord)
+{
+    auto readPosition        = buffer.readPosition.load(std::memory_order_relaxed);
+    const auto writePosition = buffer.writePosition.load(std::memory_order_acquire);
+
+    while (readPosition < writePosition)
+    {
+        const auto* record = buffer.data.get() + readPosition % buffer.capacity;
+
+        auto recordSize     = uint32_t(0);
+        auto formatStringId = uint32_t(0);
+        std::memcpy(&recordSize, record, sizeof(recordSize));
+        std::memcpy(&formatStringId, record + sizeof(uint32_t), sizeof(formatStringId));
+
+        if (formatStringId == paddingRecordId)
+        {
+            readPosition += recordSize;
+            continue;
+        }
+
+        consumeRecord(record);
+        readPosition += AlignRecordSize(recordSize);
+    }
+
+    buffer.readPosition.store(readPosition, std::memory_order_release);
+}
+
+static bool RenderBinaryLogRecord(std::string_view formatString,
+                                  const std::byte* arguments,
+                                  const std::byte* argumentsEnd,
+                                  uint8_t argumentCount,
+                                  fmt::memory_buffer& out)
+{
+    auto argumentStore = fmt::dynamic_format_arg_store<fmt::format_context>();
+
+    const auto read = [&arguments, argumentsEnd](void* value, size_t size)
+    {
+        if (static_cast<size_t>(argumentsEnd - arguments) < size)
+            return false;
+
+        std::memcpy(value, arguments, size);
+        arguments += size;
+        return true;
+    };
+
+    for (auto i = 0; i < argumentCount; ++i)
+    {
+        auto type = BinaryLogArgumentType::Int64;
+        if (!read(&type, 1))
+            return false;
+
+        switch (type)
+        {
+        case BinaryLogArgumentType::Int64:
+        {
+            auto value = int64_t(0);
+            if (!read(&value, sizeof(value)))
+                return false;
+            argumentStore.push_back(value);
+            break;
+        }
+        case BinaryLogArgumentType::UInt64:
+        {
+            auto value = uint64_t(0);
+            if (!read(&value, sizeof(value)))
+                return false;
+            argumentStore.push_back(value);
+            break;
+        }
+        case BinaryLogArgumentType::Float:
+        {
+            auto value = 0.0f;
+            if (!read(&value, sizeof(value)))
+                return false;
+            argumentStore.push_back(value);
+            break;
+        }
+        case BinaryLogArgumentType::Double:
+        {
+            auto value = 0.0;
+            if (!read(&value, sizeof(value)))
+                return false;
+            argumentStore.push_back(value);
+            break;
+        }
+        case BinaryLogArgumentType::Bool:
+        {
+            auto value = false;
+            if (!read(&value, sizeof(value)))
+                return false;
+            argumentStore.push_back(value);
+            break;
+        }
+        case BinaryLogArgumentType::Char:
+        {
+            auto value = '\0';
+            if (!read(&value, sizeof(value)))
+                return false;
+            argumentStore.push_back(value);
+            break;
+        }
+        case BinaryLogArgumentType::String:
+        {
+            auto length = uint32_t(0);
+            if (!read(&length, sizeof(length)) || static_cast<size_t>(argumentsEnd - arguments) < length)
+                return false;
+            argumentStore.push_back(std::string_view(reinterpret_cast<const char*>(arguments), length));
+            arguments += length;
+            break;
+        }
+        case BinaryLogArgumentType::Pointer:
+        {
+            auto value = uint64_t(0);
+            if (!read(&value, sizeof(value)))
+                return false;
+            argumentStore.push_back(reinterpret_cast<const void*>(value));
+            break;
+        }
+        default: return false;
+        }
+    }
+
+    // Format strings were checked at compile time, so this can only fail on a corrupt binary log
+    try
+    {
+        fmt::vformat_to(std::back_inserter(out), formatString, argumentStore);
+    }
+    catch (const fmt::format_error&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static std::mutex drainMutex;
+static thread_local bool isDraining = false;
+
+DeferredLogger::DeferredLogger(const DeferredLogOptions& options, const std::atomic<int>& maxLogStreamLevel)
+    : maxLogStreamLevel(maxLogStreamLevel), drainInterval(options.drainInterval),
+      binaryLogVerbosity(options.binaryLogVerbosity)
+{
+    if (!options.binaryLogPath.empty())
+    {
+        binaryLogFile.open(options.binaryLogPath, std::ios::binary | std::ios::trunc);
+        if (binaryLogFile.is_open())
+        {
+            binaryLogFile.write(binaryLogMagic, sizeof(binaryLogMagic));
+            binaryLogFile.write(reinterpret_cast<const char*>(&binaryLogVersion), sizeof(binaryLogVersion));
+        }
+        else
+        {
+            LogError("Couldn't open binary log file {}!", options.binaryLogPath.string());
+        }
+    }
+
+    threadBufferCapacity.store(AlignRecordSize(std::max<size_t>(options.threadBufferSize, 1024)),
+                               std::memory_order_relaxed);
+    drainThread = std::thread(&DeferredLogger::DrainThreadMain, this);
+
+    isDeferredLoggingEnabled.store(true, std::memory_order_relaxed);
+}
+
+DeferredLogger::~DeferredLogger()
+{
+    isDeferredLoggingEnabled.store(false, std::memory_order_seq_cst);
+
+    // A thread that saw deferred logging enabled may still be writing a record, which the final drain has to pick up.
+    // Buffers registered after this point are from threads that will see it disabled.
+    {
+        const auto lock = std::scoped_lock(threadBufferRegistryMutex);
+        for (const auto& buffer : threadBuffers)
+        {
+            while (buffer->isWriting.load(std::memory_order_acquire))
+                std::this_thread::yield();
+        }
+    }
+
+    {
+        const auto lock = std::scoped_lock(drainThreadMutex);
+        isStopRequested = true;
+    }
+    drainThreadCondition.notify_one();
+    drainThread.join();
+
+    Drain();
+}
+
+void DeferredLogger::Drain()
+{
+    // A LogStream that flushes from inside its own callback would otherwise deliver the same records twice
+    if (isDraining)
+        return;
+
+    const auto lock = std::scoped_lock(drainMutex);
+    isDraining      = true;
+
+    auto buffers = std::vector<std::pair<DeferredLogThreadBuffer*, bool>>();
+    {
+        const auto registryLock = std::scoped_lock(threadBufferRegistryMutex);
+        for (const auto& buffer : threadBuffers)
+            buffers.emplace_back(buffer.get(), buffer->isOrphaned.load(std::memory_order_acquire));
+    }
+
+    auto hasOrphanedBuffers = false;
+    for (const auto& [buffer, isOrphaned] : buffers)
+    {
+        DrainThreadBuffer(*buffer, [this](const std::byte* record) { ConsumeRecord(record); });
+        hasOrphanedBuffers = hasOrphanedBuffers || isOrphaned;
+    }
+
+    // Only buffers that were orphaned before draining started are known to be empty now
+    if (hasOrphanedBuffers)
+    {
+        const auto registryLock = std::scoped_lock(threadBufferRegistryMutex);
+        for (const auto& [buffer, isOrphaned] : buffers)
+        {
+            if (isOrphaned)
+                std::erase_if(threadBuffers, [buffer](const auto& ownedBuffer) { return ownedBuffer.get() == buffer; });
+        }
+    }
+
+    if (binaryLogFile.is_open())
+        binaryLogFile.flush();
+
+    isDraining = false;
+}
+
+void DeferredLogger::DrainCallingThread()
+{
+    if (isDraining)
+        return;
+
+    auto* buffer = threadBuffer.buffer;
+    if (!buffer)
+        return;
+
+    // Nothing of this thread's is waiting, which is what almost every call finds
+    if (buffer->readPosition.load(std::memory_order_acquire) == buffer->writePosition.load(std::memory_order_relaxed))
+        return;
+
+    // If the drain thread is partway through this buffer, this waits for it to deliver what it's read
+    const auto lock = std::scoped_lock(drainMutex);
+    isDraining      = true;
+    DrainThreadBuffer(*buffer, [this](const std::byte* record) { ConsumeRecord(record); });
+    isDraining = false;
+}
+
+void DeferredLogger::DrainThreadMain()
+{
+    while (true)
+    {
+        {
+            auto lock = std::unique_lock(drainThreadMutex);
+            drainThreadCondition.wait_for(lock, drainInterval, [this] { return isStopRequested; });
+            if (isStopRequested)
+                break;
+        }
+
+        Drain();
+    }
+}
+
+void DeferredLogger::ConsumeRecord(const std::byte* record)
+{
+    auto header = BinaryLogRecordHeader{};
+    std::memcpy(&header, record, sizeof(header));
+
+    const auto logLevel = static_cast<LogLevel>(header.logLevel);
+
+    if (binaryLogFile.is_open() && logLevel <= binaryLogVerbosity)
+    {
+        WriteFormatStrings(header.formatStringId);
+
+        const auto entryType = BinaryLogEntryType::Record;
+        binaryLogFile.write(reinterpret_cast<const char*>(&entryType), sizeof(entryType));
+        binaryLogFile.write(reinterpret_cast<const char*>(record), header.size);
+    }
+
+    if (header.logLevel <= maxLogStreamLevel.load(std::memory_order_relaxed))
+    {
+        auto formattedMessage = fmt::memory_buffer();
+        const auto isRendered = RenderBinaryLogRecord(GetFormatString(header.formatStringId),
+                                                      record + sizeof(header),
+                                                      record + header.size,
+                                                      header.argumentCount,
+                                                      formattedMessage);
+        Assert_True(isRendered);
+
+        LogImplementation(logLevel, std::string_view(formattedMessage.data(), formattedMessage.size()));
+    }
+}
+
+void DeferredLogger::WriteFormatStrings(uint32_t formatStringId)
+{
+    if (formatStringId < writtenFormatStringCount)
+        return;
+
+    const auto lock = std::scoped_lock(formatStringTableMutex);
+
+    for (; writtenFormatStringCount < formatStrings.size(); ++writtenFormatStringCount)
+    {
+        const auto entryType     = BinaryLogEntryType::FormatString;
+        const auto& formatString = formatStrings[writtenFormatStringCount];
+        const auto length        = static_cast<uint32_t>(formatString.size());
+
+        binaryLogFile.write(reinterpret_cast<const char*>(&entryType), sizeof(entryType));
+        binaryLogFile.write(reinterpret_cast<const char*>(&writtenFormatStringCount), sizeof(writtenFormatStringCount));
+        binaryLogFile.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        binaryLogFile.write(formatString.data(), length);
+    }
+}
+
+} // namespace Internal
+
+void ForgetFormatStringAddresses()
+{
+    Internal::formatStringAddressGeneration.fetch_add(1, std::memory_order_release);
+}
+
+bool DecodeBinaryLog(const std::filesystem::path& binaryLogPath, const LogEventViewCallback& callback)
+{
+    using namespace Internal;
+
+    auto file = std::ifstream(binaryLogPath, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    const auto read = [&file](void* value, size_t size)
+    { return static_cast<bool>(file.read(reinterpret_cast<char*>(value), static_cast<std::streamsize>(size))); };
+
+    char magic[sizeof(binaryLogMagic)];
+    auto version = uint32_t(0);
+    if (!read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), std::begin(binaryLogMagic)) ||
+        !read(&version, sizeof(version)) || version != binaryLogVersion)
+    {
+        return false;
+    }
+
+    auto decodedFormatStrings = std::vector<std::string>();
+    auto record               = std::vector<std::byte>();
+    auto formattedMessage     = fmt::memory_buffer();
+
+    auto entryType = BinaryLogEntryType::Record;
+    while (read(&entryType, sizeof(entryType)))
+    {
+        switch (entryType)
+        {
+        case BinaryLogEntryType::FormatString:
+        {
+            auto formatStringId = uint32_t(0);
+            auto length         = uint32_t(0);
+            if (!read(&formatStringId, sizeof(formatStringId)) || !read(&length, sizeof(length)))
+                return false;
+
+            if (formatStringId >= decodedFormatStrings.size())
+                decodedFormatStrings.resize(formatStringId + 1);
+
+            auto& formatString = decodedFormatStrings[formatStringId];
+            formatString.resize(length);
+            if (!read(formatString.data(), length))
+                return false;
+            break;
+        }
+        case BinaryLogEntryType::Record:
+        {
+            auto header = BinaryLogRecordHeader{};
+            if (!read(&header, sizeof(header)) || header.size < sizeof(header) ||
+                header.formatStringId >= decodedFormatStrings.size() ||
+                header.logLevel > static_cast<uint8_t>(LogLevel::Trace))
+            {
+                return false;
+            }
+
+            record.resize(header.size - sizeof(header));
+            if (!read(record.data(), record.size()))
+                return false;
+
+            formattedMessage.clear();
+            if (!RenderBinaryLogRecord(decodedFormatStrings[header.formatStringId],
+                                       record.data(),
+                                       record.data() + record.size(),
+                                       header.argumentCount,
+                                       formattedMessage))
+            {
+                return false;
+            }
+
+            callback(static_cast<LogLevel>(header.logLevel),
+                     std::string_view(formattedMessage.data(), formattedMessage.size()));
+            break;
+        }
+        default: return false;
+        }
+    }
+
+    return file.eof();
+}
+
+} // namespace Engine::Console
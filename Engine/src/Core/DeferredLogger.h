@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Engine/Core/Console.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace Engine::Console::Internal
+{
+
+/// Drains the per-thread deferred log buffers, formatting records for the LogStreams and/or appending them to the
+/// binary log file.
+class DeferredLogger
+{
+public:
+    DeferredLogger(const DeferredLogOptions& options, const std::atomic<int>& maxLogStreamLevel);
+    ~DeferredLogger();
+
+    DeferredLogger(const DeferredLogger&)            = delete;
+    DeferredLogger& operator=(const DeferredLogger&) = delete;
+
+    void Drain();
+    /// Deliver whatever the calling thread has deferred so far, so that a message it logs directly doesn't overtake
+    /// them.
+    void DrainCallingThread();
+
+private:
+    const std::atomic<int>& maxLogStreamLevel;
+    const std::chrono::milliseconds drainInterval;
+    const LogLevel binaryLogVerbosity;
+
+    std::ofstream binaryLogFile;
+    uint32_t writtenFormatStringCount = 0;
+
+    std::mutex drainThreadMutex;
+    std::condition_variable drainThreadCondition;
+    bool isStopRequested = false;
+    std::thread drainThread;
+
+    void DrainThreadMain();
+    void ConsumeRecord(const std::byte* record);
+    void WriteFormatStrings(uint32_t formatStringId);
+};
+
+} // namespace Engine::Console::Internal
@@ -0,0 +1,140 @@
+#include <Engine/Core/FrameAllocator.h>
+
+#include <Engine/Core/Assertions.h>
+#include <Engine/Core/Console.h>
+
+#include <algorithm>
+
+namespace Engine
+{
+
+/// The block the calling thread is allocating from. Only used for as long as frameId matches the allocator's.
+struct ThreadFrameBlock
+{
+    uint64_t frameId  = 0;
+    std::byte* cursor = nullptr;
+    std::byte* end    = nullptr;
+};
+
+static thread_local ThreadFrameBlock threadBlock;
+
+static std::atomic<uint64_t> nextFrameId = 1;
+
+/// Ranges are committed in steps this big, so that the lock is only taken once in a while.
+static constexpr size_t commitGranularity = 1024 * 1024;
+
+static uintptr_t AlignAddress(uintptr_t address, size_t alignment)
+{
+    return (address + alignment - 1) & ~(uintptr_t(alignment) - 1);
+}
+
+FrameAllocator::FrameAllocator(size_t reservedSizePerFrame)
+{
+    isValid = true;
+    for (auto& frame : frames)
+        isValid = isValid && frame.memory.Reserve(reservedSizePerFrame);
+
+    frameId = nextFrameId.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FrameAllocator::BeginFrame()
+{
+    const auto frameBytesUsed = GetCurrentFrameBytesUsed();
+    previousFrameBytesUsed    = frameBytesUsed;
+    highWaterMark             = std::max(highWaterMark, frameBytesUsed);
+
+    currentFrameIndex = (currentFrameIndex + 1) % framesInFlight;
+    frameId           = nextFrameId.fetch_add(1, std::memory_order_relaxed);
+
+    // What's committed stays committed, so that frames after a busy one don't fault its pages back in
+    frames[currentFrameIndex].claimedSize.store(0, std::memory_order_relaxed);
+    hasReportedOverflow.store(false, std::memory_order_relaxed);
+}
+
+void* FrameAllocator::Allocate(size_t size, size_t alignment)
+{
+    Assert_True(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    auto& block = threadBlock;
+    if (block.frameId == frameId)
+    {
+        const auto alignedAddress = AlignAddress(reinterpret_cast<uintptr_t>(block.cursor), alignment);
+        if (alignedAddress + size <= reinterpret_cast<uintptr_t>(block.end) && alignedAddress + size >= alignedAddress)
+        {
+            block.cursor = reinterpret_cast<std::byte*>(alignedAddress + size);
+            return reinterpret_cast<void*>(alignedAddress);
+        }
+    }
+
+    // Whatever is left of the thread's current block is wasted
+    auto blockSize = size_t(0);
+    auto* newBlock = ClaimBlock(size + alignment - 1, blockSize);
+    if (!newBlock)
+        return nullptr;
+
+    const auto alignedAddress = AlignAddress(reinterpret_cast<uintptr_t>(newBlock), alignment);
+    block = {.frameId = frameId,
+             .cursor  = reinterpret_cast<std::byte*>(alignedAddress + size),
+             .end     = newBlock + blockSize};
+    return reinterpret_cast<void*>(alignedAddress);
+}
+
+std::byte* FrameAllocator::ClaimBlock(size_t minimumSize, size_t& blockSize)
+{
+    if (!isValid)
+        return nullptr;
+
+    auto& frame         = frames[currentFrameIndex];
+    blockSize           = std::max(threadBlockSize, minimumSize);
+    const auto offset   = frame.claimedSize.fetch_add(blockSize, std::memory_order_relaxed);
+    const auto blockEnd = offset + blockSize;
+    if (blockEnd > frame.memory.GetReservedSize() || blockEnd < offset)
+    {
+        // Every allocation after the first miss misses too, so only the first one is worth reporting
+        if (!hasReportedOverflow.exchange(true, std::memory_order_relaxed))
+        {
+            Console::LogError("A frame allocated more than the {} MiB reserved for it",
+                              frame.memory.GetReservedSize() / (1024 * 1024));
+        }
+        return nullptr;
+    }
+
+    if (blockEnd > frame.committedSize.load(std::memory_order_acquire))
+    {
+        // Another thread may have committed past this block while this one waited for the lock
+        const auto lock = std::lock_guard(commitMutex);
+        if (blockEnd > frame.memory.GetCommittedSize())
+        {
+            const auto commitSize = (blockEnd + commitGranularity - 1) / commitGranularity * commitGranularity;
+            if (!frame.memory.Commit(std::min(commitSize, frame.memory.GetReservedSize())))
+                return nullptr;
+
+            frame.committedSize.store(frame.memory.GetCommittedSize(), std::memory_order_release);
+        }
+    }
+
+    return frame.memory.GetData() + offset;
+}
+
+size_t FrameAllocator::GetCurrentFrameBytesUsed() const
+{
+    const auto& frame = frames[currentFrameIndex];
+    return std::min(frame.claimedSize.load(std::memory_order_relaxed), frame.memory.GetReservedSize());
+}
+
+FrameMemoryStats FrameAllocator::GetStats() const
+{
+    auto stats                   = FrameMemoryStats();
+    stats.previousFrameBytesUsed = previousFrameBytesUsed;
+    stats.highWaterMark          = std::max(highWaterMark, GetCurrentFrameBytesUsed());
+
+    for (const auto& frame : frames)
+    {
+        stats.committedBytes += frame.committedSize.load(std::memory_order_relaxed);
+        stats.reservedBytes += frame.memory.GetReservedSize();
+    }
+
+    return stats;
+}
+
+} // namespace Engine
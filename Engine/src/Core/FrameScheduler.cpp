@@ -0,0 +1,174 @@
+#include <Engine/Core/FrameScheduler.h>
+
+#include <Engine/Core/Assertions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
+namespace Engine
+{
+
+/// Each sleep is this long, so that the estimate of how much they overshoot applies to all of them.
+static constexpr auto sleepChunk = std::chrono::milliseconds(1);
+
+/// Newer samples weigh at least this much in the sleep estimate, so it follows changes in timer resolution or load.
+static constexpr double minSleepSampleWeight = 1.0 / 64.0;
+
+/// Tell the CPU this is a spin-wait, which saves power and lets a sibling hyperthread run.
+static void SpinPause()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+void FrameScheduler::SetPacingMode(FramePacingMode mode)
+{
+    if (mode == pacingMode)
+        return;
+
+    pacingMode = mode;
+
+    // Otherwise the first paced frame would try to catch up on every frame since the last time it was paced
+    nextFrameTime = Clock::now();
+}
+
+void FrameScheduler::SetTargetFrameRate(double framesPerSecond)
+{
+    Assert_Gt(framesPerSecond, 0.0);
+    targetFrameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / framesPerSecond));
+}
+
+void FrameScheduler::SetFixedTimestep(Clock::duration timestep)
+{
+    Assert_True(timestep > Clock::duration::zero());
+    fixedTimestep = timestep;
+}
+
+void FrameScheduler::BeginFrame()
+{
+    if (pacingMode == FramePacingMode::FixedRate)
+    {
+        nextFrameTime += targetFrameTime;
+
+        // A frame that ran over by more than a whole frame starts the schedule over, rather than having the next few
+        // run back to back to catch up
+        const auto now = Clock::now();
+        if (now - nextFrameTime > targetFrameTime)
+            nextFrameTime = now;
+        else
+            PreciseSleepUntil(nextFrameTime);
+    }
+
+    RecordFrameStart(Clock::now());
+}
+
+void FrameScheduler::RecordFrameStart(Clock::time_point newFrameStartTime)
+{
+    if (frameCount > 0)
+    {
+        deltaTime                                                 = newFrameStartTime - frameStartTime;
+        frameTimeHistory[(frameCount - 1) % frameTimeHistorySize] = deltaTime;
+    }
+    else
+    {
+        nextFrameTime = newFrameStartTime;
+    }
+
+    frameStartTime = newFrameStartTime;
+    ++frameCount;
+
+    // Waking up from an idle wait mustn't simulate the whole time spent waiting
+    if (pacingMode == FramePacingMode::BlockingIdle)
+        simulationDebt = std::min(simulationDebt + deltaTime, fixedTimestep);
+    else
+        simulationDebt = std::min(simulationDebt + deltaTime, fixedTimestep * maxFixedStepsPerFrame);
+}
+
+bool FrameScheduler::StepSimulation()
+{
+    if (simulationDebt < fixedTimestep)
+        return false;
+
+    simulationDebt -= fixedTimestep;
+    return true;
+}
+
+double FrameScheduler::GetInterpolationAlpha() const
+{
+    return std::chrono::duration<double>(simulationDebt) / std::chrono::duration<double>(fixedTimestep);
+}
+
+FrameTimingStats FrameScheduler::GetTimingStats() const
+{
+    auto stats       = FrameTimingStats();
+    stats.frameCount = frameCount;
+
+    // The frame that's running now doesn't have a frame time yet
+    const auto sampleCount =
+        frameCount > 1 ? static_cast<size_t>(std::min<uint64_t>(frameCount - 1, frameTimeHistorySize)) : size_t(0);
+    if (sampleCount == 0)
+        return stats;
+
+    auto frameTimes = frameTimeHistory;
+    const auto end  = frameTimes.begin() + sampleCount;
+
+    auto totalTime = Clock::duration::zero();
+    for (auto frameTime = frameTimes.begin(); frameTime != end; ++frameTime)
+        totalTime += *frameTime;
+
+    const auto [minFrameTime, maxFrameTime] = std::minmax_element(frameTimes.begin(), end);
+
+    const auto ToMilliseconds = [](Clock::duration time)
+    { return std::chrono::duration<double, std::milli>(time).count(); };
+
+    stats.minFrameMilliseconds     = ToMilliseconds(*minFrameTime);
+    stats.maxFrameMilliseconds     = ToMilliseconds(*maxFrameTime);
+    stats.averageFrameMilliseconds = ToMilliseconds(totalTime) / static_cast<double>(sampleCount);
+
+    // The frame time that 99% of frames were at least as fast as
+    const auto p99 = frameTimes.begin() + static_cast<ptrdiff_t>(std::ceil(sampleCount * 0.99)) - 1;
+    std::nth_element(frameTimes.begin(), p99, end);
+    stats.p99FrameMilliseconds = ToMilliseconds(*p99);
+
+    return stats;
+}
+
+void FrameScheduler::PreciseSleepUntil(Clock::time_point deadline)
+{
+    while (true)
+    {
+        const auto remaining = std::chrono::duration<double, std::nano>(deadline - Clock::now()).count();
+
+        // Sleep while even a pessimistic sleep would wake up in time
+        const auto pessimisticSleep =
+            sleepSampleCount > 0 ? sleepEstimateMean + std::sqrt(sleepEstimateVariance)
+                                 : std::chrono::duration<double, std::nano>(sleepChunk).count() * 2.0;
+        if (remaining <= pessimisticSleep)
+            break;
+
+        const auto sleepStart = Clock::now();
+        std::this_thread::sleep_for(sleepChunk);
+        const auto sleepTime = std::chrono::duration<double, std::nano>(Clock::now() - sleepStart).count();
+
+        ++sleepSampleCount;
+        const auto weight = std::max(1.0 / static_cast<double>(sleepSampleCount), minSleepSampleWeight);
+        const auto delta  = sleepTime - sleepEstimateMean;
+        sleepEstimateVariance = (1.0 - weight) * (sleepEstimateVariance + weight * delta * delta);
+        sleepEstimateMean += weight * delta;
+    }
+
+    while (Clock::now() < deadline)
+        SpinPause();
+}
+
+} // namespace Engine
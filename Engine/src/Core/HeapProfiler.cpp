@@ -0,0 +1,635 @@
+#include <Engine/Core/HeapProfiler.h>
+
+#include <Engine/Core/BacktraceSymbolHandler.h>
+#include <Engine/Core/MiscMacros.h>
+
+#if ADHOC_WINDOWS && ADHOC_EDITOR
+    #include <mimalloc.h>
+#endif
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace Engine::HeapProfiler
+{
+
+/// Sits right before every block Allocate() returns.
+struct alignas(16) AllocationHeader
+{
+    uint64_t size : 48;
+    /// Which run of the profiler counted the block, or 0 if none did.
+    uint64_t run : 16;
+    /// From what the underlying allocator returned to the block.
+    uint32_t offset;
+    TagId tag;
+    /// One more than the index of the call site the block was sampled at, or 0 if it wasn't sampled.
+    uint16_t callSite;
+};
+
+static_assert(sizeof(AllocationHeader) == 16);
+
+static constexpr size_t maxCallSiteCount = UINT16_MAX - 1;
+
+struct TagCounters
+{
+    std::array<std::atomic<int64_t>, maxTagCount> liveBytes = {};
+    std::array<std::atomic<int64_t>, maxTagCount> liveCount = {};
+};
+
+/// One thread's share of the per-tag counters, which only that thread updates, so that counting a block doesn't take
+/// an atomic read-modify-write. They're atomic so that snapshots can add them up from other threads. Blocks freed on
+/// another thread than the one that allocated them leave one thread's share negative and another's positive.
+struct ThreadTagCounters
+{
+    TagCounters counters;
+    /// The run the counters are for. Counters from an earlier run are zeroed by the thread before it next counts.
+    std::atomic<uint16_t> run = 0;
+
+    ThreadTagCounters* previous = nullptr;
+    ThreadTagCounters* next     = nullptr;
+
+    ThreadTagCounters();
+    ~ThreadTagCounters();
+};
+
+struct CallSite
+{
+    StackTrace stackTrace;
+    TagId tag = untaggedTag;
+    /// Only the sampled allocations, not scaled up yet.
+    HeapUsage sampledUsage;
+};
+
+struct CallSiteRegistry
+{
+    std::mutex mutex;
+    std::vector<CallSite> callSites;
+    std::unordered_map<uint64_t, uint16_t> callSiteIndices;
+};
+
+// Whatever allocating touches is constant-initialized, or constructed on first use, since allocations come in before
+// any dynamic initialization has run
+
+/// 0 while the profiler isn't running.
+static std::atomic<uint16_t> currentRun          = 0;
+static std::atomic<uint32_t> stackSampleInterval = HeapProfilerOptions().stackSampleInterval;
+
+/// Guards the list of threads' counters, and adding them up.
+static std::mutex threadCountersMutex;
+static ThreadTagCounters* threadCountersList = nullptr;
+/// What threads that have exited counted, and whatever's counted on a thread after its counters are gone.
+static TagCounters retiredCounters;
+/// Only brought up to date at sampled allocations and snapshots.
+static std::array<std::atomic<int64_t>, maxTagCount> peakBytes = {};
+
+/// Serializes Start() and Stop().
+static std::mutex runMutex;
+/// The run that's going, or the one that was last stopped, which snapshots are still taken of.
+static std::atomic<uint16_t> latestRun = 0;
+
+static std::mutex tagMutex;
+static std::array<const char*, maxTagCount> tagNames = {"Untagged"};
+static std::atomic<size_t> tagCount                   = 1;
+
+/// Everything the profiler keeps for each thread, together so that counting a block only looks it up once.
+struct ThreadState
+{
+    /// Null until the thread first counts something, and again once its counters are destroyed.
+    ThreadTagCounters* counters     = nullptr;
+    uint32_t allocationsUntilSample = 0;
+    /// The run allocationsUntilSample is counting down for, so that each run samples from its first allocation on.
+    uint16_t samplingRun = 0;
+    TagId currentTag     = untaggedTag;
+    /// Set while the profiler allocates for itself, so that it doesn't count or sample its own bookkeeping.
+    bool isProfilerAllocating = false;
+    bool areCountersDestroyed = false;
+};
+
+static thread_local ThreadState threadState;
+/// Only looked up the first time, since its constructor makes every lookup check whether it's been constructed yet.
+static thread_local ThreadTagCounters threadCounters;
+
+/// Marks what the calling thread allocates as the profiler's own for as long as it's alive.
+struct ProfilerAllocationScope
+{
+    bool wasProfilerAllocating = std::exchange(threadState.isProfilerAllocating, true);
+
+    ~ProfilerAllocationScope() { threadState.isProfilerAllocating = wasProfilerAllocating; }
+};
+
+static CallSiteRegistry& GetCallSiteRegistry()
+{
+    // Never destroyed, since sampled blocks can still be freed during static destruction
+    static auto* registry = new CallSiteRegistry();
+    return *registry;
+}
+
+static uint64_t GetCallSiteKey(const StackTrace& stackTrace, TagId tag)
+{
+    return stackTrace.GetHash() ^ (uint64_t(tag) * 0x9E3779B97F4A7C15ull);
+}
+
+static void UpdatePeak(std::atomic<int64_t>& peak, int64_t value)
+{
+    auto currentPeak = peak.load(std::memory_order_relaxed);
+    while (value > currentPeak && !peak.compare_exchange_weak(currentPeak, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+ThreadTagCounters::ThreadTagCounters()
+{
+    const auto lock = std::lock_guard(threadCountersMutex);
+    next            = threadCountersList;
+    if (next)
+        next->previous = this;
+    threadCountersList = this;
+}
+
+ThreadTagCounters::~ThreadTagCounters()
+{
+    const auto lock = std::lock_guard(threadCountersMutex);
+    if (run.load(std::memory_order_relaxed) == latestRun.load(std::memory_order_relaxed))
+    {
+        for (size_t tag = 0; tag < maxTagCount; ++tag)
+        {
+            retiredCounters.liveBytes[tag].fetch_add(counters.liveBytes[tag].load(std::memory_order_relaxed),
+                                                     std::memory_order_relaxed);
+            retiredCounters.liveCount[tag].fetch_add(counters.liveCount[tag].load(std::memory_order_relaxed),
+                                                     std::memory_order_relaxed);
+        }
+    }
+
+    (previous ? previous->next : threadCountersList) = next;
+    if (next)
+        next->previous = previous;
+
+    threadState.counters             = nullptr;
+    threadState.areCountersDestroyed = true;
+}
+
+static void AddToCounters(ThreadState& state, TagId tag, int64_t bytes, int64_t count, uint16_t run)
+{
+    if (!state.counters)
+    {
+        if (state.areCountersDestroyed)
+        {
+            retiredCounters.liveBytes[tag].fetch_add(bytes, std::memory_order_relaxed);
+            retiredCounters.liveCount[tag].fetch_add(count, std::memory_order_relaxed);
+            return;
+        }
+
+        state.counters = &threadCounters;
+    }
+
+    auto& thread   = *state.counters;
+    auto& counters = thread.counters;
+    if (thread.run.load(std::memory_order_relaxed) != run)
+    {
+        for (size_t i = 0; i < maxTagCount; ++i)
+        {
+            counters.liveBytes[i].store(0, std::memory_order_relaxed);
+            counters.liveCount[i].store(0, std::memory_order_relaxed);
+        }
+        thread.run.store(run, std::memory_order_relaxed);
+    }
+
+    auto& liveBytes = counters.liveBytes[tag];
+    auto& liveCount = counters.liveCount[tag];
+    liveBytes.store(liveBytes.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+    liveCount.store(liveCount.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+}
+
+/// Call with threadCountersMutex locked.
+static HeapUsage GetTagUsage(TagId tag, uint16_t run)
+{
+    auto usage      = HeapUsage();
+    usage.liveBytes = retiredCounters.liveBytes[tag].load(std::memory_order_relaxed);
+    usage.liveCount = retiredCounters.liveCount[tag].load(std::memory_order_relaxed);
+    for (auto* thread = threadCountersList; thread; thread = thread->next)
+    {
+        if (thread->run.load(std::memory_order_relaxed) != run)
+            continue;
+
+        usage.liveBytes += thread->counters.liveBytes[tag].load(std::memory_order_relaxed);
+        usage.liveCount += thread->counters.liveCount[tag].load(std::memory_order_relaxed);
+    }
+
+    UpdatePeak(peakBytes[tag], usage.liveBytes);
+    usage.peakBytes = peakBytes[tag].load(std::memory_order_relaxed);
+    return usage;
+}
+
+static void* AllocateFromUnderlyingHeap(size_t size)
+{
+#if ADHOC_WINDOWS && ADHOC_EDITOR
+    return mi_malloc(size);
+#else
+    return std::malloc(size);
+#endif
+}
+
+static void FreeToUnderlyingHeap(void* memory)
+{
+#if ADHOC_WINDOWS && ADHOC_EDITOR
+    mi_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+TagId RegisterTag(const char* name)
+{
+    const auto lock            = std::lock_guard(tagMutex);
+    const auto registeredCount = tagCount.load(std::memory_order_relaxed);
+    for (size_t tag = 0; tag < registeredCount; ++tag)
+    {
+        if (std::strcmp(tagNames[tag], name) == 0)
+            return static_cast<TagId>(tag);
+    }
+
+    if (registeredCount == maxTagCount)
+        return untaggedTag;
+
+    // The name is only ever read, and only by whoever's formatting a snapshot, so it's kept for good
+    auto* nameCopy = static_cast<char*>(AllocateFromUnderlyingHeap(std::strlen(name) + 1));
+    std::strcpy(nameCopy, name);
+
+    tagNames[registeredCount] = nameCopy;
+    tagCount.store(registeredCount + 1, std::memory_order_release);
+    return static_cast<TagId>(registeredCount);
+}
+
+const char* GetTagName(TagId tag)
+{
+    return tag < tagCount.load(std::memory_order_acquire) ? tagNames[tag] : tagNames[untaggedTag];
+}
+
+TagScope::TagScope(TagId tag) : previousTag(std::exchange(threadState.currentTag, tag))
+{
+}
+
+TagScope::~TagScope()
+{
+    threadState.currentTag = previousTag;
+}
+
+void Start(const HeapProfilerOptions& options)
+{
+    const auto lock = std::lock_guard(runMutex);
+
+    // Blocks counted by an earlier run are left alone from here on
+    currentRun.store(0, std::memory_order_relaxed);
+    {
+        const auto countersLock = std::lock_guard(threadCountersMutex);
+        for (size_t tag = 0; tag < maxTagCount; ++tag)
+        {
+            retiredCounters.liveBytes[tag].store(0, std::memory_order_relaxed);
+            retiredCounters.liveCount[tag].store(0, std::memory_order_relaxed);
+            peakBytes[tag].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    {
+        const auto allocationScope = ProfilerAllocationScope();
+        auto& registry             = GetCallSiteRegistry();
+        const auto registryLock    = std::lock_guard(registry.mutex);
+        registry.callSites.clear();
+        registry.callSiteIndices.clear();
+    }
+
+    stackSampleInterval.store(std::max(options.stackSampleInterval, 1u), std::memory_order_relaxed);
+
+    const auto run = static_cast<uint16_t>(latestRun.load(std::memory_order_relaxed) % UINT16_MAX + 1);
+    latestRun.store(run, std::memory_order_relaxed);
+    currentRun.store(run, std::memory_order_release);
+}
+
+void Stop()
+{
+    const auto lock = std::lock_guard(runMutex);
+    currentRun.store(0, std::memory_order_release);
+}
+
+bool IsRunning()
+{
+    return currentRun.load(std::memory_order_relaxed) != 0;
+}
+
+/// Returns the header's callSite.
+NOINLINE COLD static uint16_t SampleCallSite(const AllocationHeader& header)
+{
+    const auto allocationScope = ProfilerAllocationScope();
+
+    // Starts at the operator new that called Allocate()
+    const auto stackTrace = StackTrace::Capture(3);
+    const auto key        = GetCallSiteKey(stackTrace, header.tag);
+
+    auto& registry          = GetCallSiteRegistry();
+    const auto registryLock = std::lock_guard(registry.mutex);
+
+    auto index       = uint16_t(0);
+    const auto found = registry.callSiteIndices.find(key);
+    if (found != registry.callSiteIndices.end())
+    {
+        index = found->second;
+    }
+    else
+    {
+        if (registry.callSites.size() == maxCallSiteCount)
+            return 0;
+
+        index = static_cast<uint16_t>(registry.callSites.size());
+        registry.callSites.push_back(CallSite{.stackTrace = stackTrace, .tag = header.tag});
+        registry.callSiteIndices.emplace(key, index);
+    }
+
+    auto& usage = registry.callSites[index].sampledUsage;
+    usage.liveBytes += static_cast<int64_t>(header.size);
+    usage.liveCount += 1;
+    usage.peakBytes = std::max(usage.peakBytes, usage.liveBytes);
+    return index + 1;
+}
+
+NOINLINE COLD static void ForgetSampledBlock(const AllocationHeader& header)
+{
+    const auto allocationScope = ProfilerAllocationScope();
+
+    auto& registry          = GetCallSiteRegistry();
+    const auto registryLock = std::lock_guard(registry.mutex);
+
+    // Start() may have cleared the call sites since this block was counted
+    if (header.callSite > registry.callSites.size())
+        return;
+
+    auto& usage = registry.callSites[header.callSite - 1].sampledUsage;
+    usage.liveBytes -= static_cast<int64_t>(header.size);
+    usage.liveCount -= 1;
+}
+
+NOINLINE COLD static void UpdateTagPeak(TagId tag, uint16_t run)
+{
+    const auto lock = std::lock_guard(threadCountersMutex);
+    GetTagUsage(tag, run);
+}
+
+static void CountBlock(ThreadState& state, AllocationHeader& header, uint16_t run)
+{
+    header.run = run;
+    header.tag = state.currentTag;
+
+    AddToCounters(state, header.tag, static_cast<int64_t>(header.size), 1, run);
+
+    if (state.samplingRun != run)
+    {
+        state.samplingRun            = run;
+        state.allocationsUntilSample = 0;
+    }
+
+    if (state.allocationsUntilSample != 0)
+    {
+        --state.allocationsUntilSample;
+        return;
+    }
+
+    state.allocationsUntilSample = stackSampleInterval.load(std::memory_order_relaxed) - 1;
+    header.callSite        = SampleCallSite(header);
+    UpdateTagPeak(header.tag, run);
+}
+
+static void UncountBlock(ThreadState& state, const AllocationHeader& header)
+{
+    AddToCounters(state, header.tag, -static_cast<int64_t>(header.size), -1, header.run);
+
+    if (header.callSite != 0)
+        ForgetSampledBlock(header);
+}
+
+void* Allocate(size_t size, size_t alignment)
+{
+    alignment = std::max(alignment, alignof(AllocationHeader));
+
+    // The underlying heap's blocks are aligned for the header, which leaves at most this much to skip past
+    const auto overhead = sizeof(AllocationHeader) + alignment - alignof(AllocationHeader);
+    if (size > SIZE_MAX - overhead)
+        return nullptr;
+
+    auto* memory = static_cast<std::byte*>(AllocateFromUnderlyingHeap(size + overhead));
+    if (!memory)
+        return nullptr;
+
+    const auto blockAddress = (reinterpret_cast<uintptr_t>(memory) + sizeof(AllocationHeader) + alignment - 1) &
+                              ~(uintptr_t(alignment) - 1);
+    auto* block  = reinterpret_cast<std::byte*>(blockAddress);
+    auto* header = reinterpret_cast<AllocationHeader*>(block) - 1;
+    *header      = AllocationHeader{.size     = size,
+                                    .run      = 0,
+                                    .offset   = static_cast<uint32_t>(block - memory),
+                                    .tag      = untaggedTag,
+                                    .callSite = 0};
+
+    const auto run = currentRun.load(std::memory_order_relaxed);
+    if (run != 0)
+    {
+        auto& state = threadState;
+        if (!state.isProfilerAllocating)
+            CountBlock(state, *header, run);
+    }
+
+    return block;
+}
+
+void Free(void* memory) noexcept
+{
+    if (!memory)
+        return;
+
+    const auto* header = static_cast<const AllocationHeader*>(memory) - 1;
+    if (header->run != 0 && header->run == currentRun.load(std::memory_order_relaxed))
+        UncountBlock(threadState, *header);
+
+    FreeToUnderlyingHeap(static_cast<std::byte*>(memory) - header->offset);
+}
+
+template <typename T>
+static void SortByLiveBytes(std::vector<T>& entries)
+{
+    std::stable_sort(entries.begin(),
+                     entries.end(),
+                     [](const T& lhs, const T& rhs) { return lhs.usage.liveBytes > rhs.usage.liveBytes; });
+}
+
+HeapSnapshot TakeSnapshot()
+{
+    auto snapshot                = HeapSnapshot();
+    snapshot.stackSampleInterval = stackSampleInterval.load(std::memory_order_relaxed);
+
+    // Added up before anything's allocated for the snapshot, since sampling that would take the lock again
+    const auto registeredTagCount = tagCount.load(std::memory_order_acquire);
+    auto tagUsages                = std::array<HeapUsage, maxTagCount>();
+    {
+        const auto run  = latestRun.load(std::memory_order_relaxed);
+        const auto lock = std::lock_guard(threadCountersMutex);
+        for (size_t tag = 0; tag < registeredTagCount; ++tag)
+            tagUsages[tag] = GetTagUsage(static_cast<TagId>(tag), run);
+    }
+
+    for (size_t tag = 0; tag < registeredTagCount; ++tag)
+    {
+        if (tagUsages[tag].peakBytes != 0)
+            snapshot.tags.push_back(TagHeapUsage{.tag = static_cast<TagId>(tag), .usage = tagUsages[tag]});
+    }
+
+    {
+        // Sampling one of the snapshot's own allocations would take the registry's lock again
+        const auto allocationScope = ProfilerAllocationScope();
+        auto& registry             = GetCallSiteRegistry();
+        const auto registryLock    = std::lock_guard(registry.mutex);
+
+        const auto scale = static_cast<int64_t>(snapshot.stackSampleInterval);
+        snapshot.callSites.reserve(registry.callSites.size());
+        for (const auto& callSite : registry.callSites)
+        {
+            const auto& sampledUsage = callSite.sampledUsage;
+            snapshot.callSites.push_back(CallSiteHeapUsage{.stackTrace = callSite.stackTrace,
+                                                           .tag        = callSite.tag,
+                                                           .usage = HeapUsage{.liveBytes = sampledUsage.liveBytes * scale,
+                                                                              .liveCount = sampledUsage.liveCount * scale,
+                                                                              .peakBytes = sampledUsage.peakBytes * scale}});
+        }
+    }
+
+    SortByLiveBytes(snapshot.tags);
+    SortByLiveBytes(snapshot.callSites);
+    return snapshot;
+}
+
+static HeapUsage Subtract(const HeapUsage& after, const HeapUsage& before)
+{
+    return HeapUsage{.liveBytes = after.liveBytes - before.liveBytes,
+                     .liveCount = after.liveCount - before.liveCount,
+                     .peakBytes = after.peakBytes};
+}
+
+/// Pairs up before's and after's entries by key, and keeps the ones whose live bytes or count changed.
+template <typename T, typename GetKey>
+static std::vector<T> DiffEntries(const std::vector<T>& before, const std::vector<T>& after, GetKey&& getKey)
+{
+    auto beforeIndices = std::unordered_map<uint64_t, size_t>();
+    for (size_t i = 0; i < before.size(); ++i)
+        beforeIndices.emplace(getKey(before[i]), i);
+
+    auto diff = std::vector<T>();
+    for (const auto& entry : after)
+    {
+        auto changed     = entry;
+        const auto found = beforeIndices.find(getKey(entry));
+        if (found != beforeIndices.end())
+        {
+            changed.usage = Subtract(entry.usage, before[found->second].usage);
+            beforeIndices.erase(found);
+        }
+
+        if (changed.usage.liveBytes != 0 || changed.usage.liveCount != 0)
+            diff.push_back(changed);
+    }
+
+    // Whatever's only in before has gone away entirely
+    for (const auto& [key, index] : beforeIndices)
+    {
+        auto removed  = before[index];
+        removed.usage = Subtract(HeapUsage(), removed.usage);
+        if (removed.usage.liveBytes != 0 || removed.usage.liveCount != 0)
+            diff.push_back(removed);
+    }
+
+    SortByLiveBytes(diff);
+    return diff;
+}
+
+HeapSnapshot DiffSnapshots(const HeapSnapshot& before, const HeapSnapshot& after)
+{
+    auto diff                = HeapSnapshot();
+    diff.stackSampleInterval = after.stackSampleInterval;
+    diff.tags = DiffEntries(before.tags, after.tags, [](const TagHeapUsage& entry) { return uint64_t(entry.tag); });
+    diff.callSites = DiffEntries(before.callSites,
+                                 after.callSites,
+                                 [](const CallSiteHeapUsage& entry)
+                                 { return GetCallSiteKey(entry.stackTrace, entry.tag); });
+    return diff;
+}
+
+std::string FormatSnapshot(const HeapSnapshot& snapshot, size_t maxCallSites)
+{
+    static constexpr size_t maxFramesPerCallSite = 8;
+
+    auto text = std::string();
+    auto out  = std::back_inserter(text);
+
+    fmt::format_to(out, "{:<24} {:>14} {:>12} {:>14}\n", "Tag", "Live bytes", "Live count", "Peak bytes");
+    for (const auto& [tag, usage] : snapshot.tags)
+    {
+        fmt::format_to(
+            out, "{:<24} {:>14} {:>12} {:>14}\n", GetTagName(tag), usage.liveBytes, usage.liveCount, usage.peakBytes);
+    }
+
+    const auto callSiteCount = std::min(maxCallSites, snapshot.callSites.size());
+    if (callSiteCount == 0)
+        return text;
+
+    fmt::format_to(out,
+                   "\nTop {} of {} call sites, estimated from 1 in {} allocations:\n",
+                   callSiteCount,
+                   snapshot.callSites.size(),
+                   snapshot.stackSampleInterval);
+
+    auto* symbolHandler = BacktraceSymbolHandler::GetInstance();
+    for (size_t i = 0; i < callSiteCount; ++i)
+    {
+        const auto& callSite = snapshot.callSites[i];
+        fmt::format_to(out,
+                       "{} bytes in {} blocks ({})\n",
+                       callSite.usage.liveBytes,
+                       callSite.usage.liveCount,
+                       GetTagName(callSite.tag));
+
+        const auto frames = callSite.stackTrace.GetFrames().first(
+            std::min<size_t>(callSite.stackTrace.frameCount, maxFramesPerCallSite));
+        if (!symbolHandler)
+        {
+            for (const auto* frame : frames)
+                fmt::format_to(out, "    {}\n", fmt::ptr(frame));
+            continue;
+        }
+
+        auto trimmedStackTrace = StackTrace();
+        std::copy(frames.begin(), frames.end(), trimmedStackTrace.frames);
+        trimmedStackTrace.frameCount = static_cast<uint32_t>(frames.size());
+
+        const auto symbolizedFrames = symbolHandler->Symbolize(trimmedStackTrace);
+        auto lineStart              = size_t(0);
+        while (lineStart < symbolizedFrames.size())
+        {
+            auto lineEnd = symbolizedFrames.find('\n', lineStart);
+            if (lineEnd == std::string::npos)
+                lineEnd = symbolizedFrames.size();
+
+            fmt::format_to(out, "    {}\n", std::string_view(symbolizedFrames).substr(lineStart, lineEnd - lineStart));
+            lineStart = lineEnd + 1;
+        }
+    }
+
+    return text;
+}
+
+} // namespace Engine::HeapProfiler
@@ -0,0 +1,121 @@
+#include <Engine/Core/HotReload.h>
+
+#include <Engine/Core/Console.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace Engine
+{
+
+struct RegisteredReloadHook
+{
+    std::string name;
+    uint32_t version;
+    void (*save)(std::vector<std::byte>& data);
+    bool (*restore)(std::span<const std::byte> data);
+};
+
+// Hooks are registered from static initializers in other modules, so these can't be plain globals
+static std::mutex& GetReloadHooksMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::vector<RegisteredReloadHook>& GetReloadHooks()
+{
+    static std::vector<RegisteredReloadHook> hooks;
+    return hooks;
+}
+
+static std::atomic<bool> isReloadRequested = false;
+
+void RegisterReloadHook(const ReloadHook& hook)
+{
+    const auto lock = std::lock_guard(GetReloadHooksMutex());
+    auto& hooks     = GetReloadHooks();
+
+    auto registeredHook = RegisteredReloadHook{.name    = std::string(hook.name),
+                                               .version = hook.version,
+                                               .save    = hook.save,
+                                               .restore = hook.restore};
+
+    const auto existingHook =
+        std::find_if(hooks.begin(), hooks.end(), [&](const auto& other) { return other.name == hook.name; });
+    if (existingHook != hooks.end())
+        *existingHook = std::move(registeredHook);
+    else
+        hooks.push_back(std::move(registeredHook));
+}
+
+void UnregisterReloadHook(std::string_view name)
+{
+    const auto lock = std::lock_guard(GetReloadHooksMutex());
+    std::erase_if(GetReloadHooks(), [&](const auto& hook) { return hook.name == name; });
+}
+
+ReloadState SaveReloadState()
+{
+    const auto lock = std::lock_guard(GetReloadHooksMutex());
+
+    auto state = ReloadState();
+    for (const auto& hook : GetReloadHooks())
+    {
+        auto& section   = state.emplace_back();
+        section.name    = hook.name;
+        section.version = hook.version;
+        hook.save(section.data);
+    }
+
+    return state;
+}
+
+size_t RestoreReloadState(const ReloadState& state)
+{
+    const auto lock   = std::lock_guard(GetReloadHooksMutex());
+    const auto& hooks = GetReloadHooks();
+
+    auto restoredCount = size_t(0);
+    for (const auto& section : state)
+    {
+        const auto hook =
+            std::find_if(hooks.begin(), hooks.end(), [&](const auto& other) { return other.name == section.name; });
+        if (hook == hooks.end())
+            continue;
+
+        if (hook->version != section.version)
+        {
+            Console::LogWarning("Dropping {} state saved by version {}, since version {} is loaded now",
+                                section.name,
+                                section.version,
+                                hook->version);
+            continue;
+        }
+
+        if (hook->restore(section.data))
+            ++restoredCount;
+        else
+            Console::LogWarning("Failed to restore {} state!", section.name);
+    }
+
+    return restoredCount;
+}
+
+void RequestReload()
+{
+    isReloadRequested.store(true, std::memory_order_release);
+}
+
+bool IsReloadRequested()
+{
+    return isReloadRequested.load(std::memory_order_acquire);
+}
+
+void ClearReloadRequest()
+{
+    isReloadRequested.store(false, std::memory_order_release);
+}
+
+} // namespace Engine
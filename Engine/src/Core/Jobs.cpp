@@ -0,0 +1,555 @@
+#include <Engine/Core/Jobs.h>
+
+#include <Engine/Core/Assertions.h>
+#include <Engine/Core/Console.h>
+#include <Engine/Core/Memory.h>
+#include <Engine/Core/MiscMacros.h>
+#include <Engine/Core/PoolAllocator.h>
+#include <Engine/Core/WorkStealingDeque.h>
+
+#include <deque>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace Engine::Jobs
+{
+
+struct JobFiber;
+
+struct Job
+{
+    JobDeclaration declaration;
+    JobCounter* counter = nullptr;
+    /// Set for a parked fiber to pick back up, rather than a job to start.
+    JobFiber* fiberToResume = nullptr;
+};
+
+/// A fiber from the pool, and the job it's running.
+struct JobFiber
+{
+    Fiber fiber;
+    JobSystem* jobSystem = nullptr;
+    Job* job             = nullptr;
+};
+
+/// Everything one thread of the job system owns. The main thread is worker 0.
+struct alignas(64) Worker
+{
+    WorkStealingDeque<Job*> queue;
+    uint32_t index       = 0;
+    uint32_t randomState = 0;
+    std::thread thread;
+
+    /// The thread's own stack, which it runs on whenever it isn't running a job fiber.
+    Fiber threadFiber;
+    JobFiber* runningFiber = nullptr;
+
+    /// A job fiber can't be handed to another thread while it's still running, so it leaves what should happen to it
+    /// here, for its thread to do once it has switched away.
+    JobFiber* fiberToRelease = nullptr;
+    JobFiber* fiberToPark    = nullptr;
+    JobCounter* parkCounter  = nullptr;
+};
+
+static thread_local Worker* currentWorker = nullptr;
+
+/// Parked fibers can be resumed on another thread, so code that runs on one mustn't hold on to the address of a
+/// thread_local from before a switch, which the compiler would otherwise be free to do.
+static NOINLINE Worker* GetCurrentWorker()
+{
+    return currentWorker;
+}
+
+class JobSystem
+{
+public:
+    explicit JobSystem(const JobSystemOptions& options)
+        : isRunningJobsOnFibers(options.runJobsOnFibers)
+        , jobPool(PoolOptions{
+              .name = "Job pool",
+              .heap = Memory::IsInitialized() ? &Memory::GetSubsystemHeap(Memory::Subsystem::Jobs) : nullptr,
+          })
+    {
+        workers.reserve(options.workerThreadCount + 1);
+        for (uint32_t i = 0; i <= options.workerThreadCount; ++i)
+        {
+            workers.push_back(std::make_unique<Worker>());
+            workers.back()->index       = i;
+            workers.back()->randomState = 0x9E3779B9u * (i + 1);
+        }
+
+        if (isRunningJobsOnFibers)
+        {
+            fibers.reserve(options.fiberCount);
+            freeFibers.reserve(options.fiberCount);
+            for (uint32_t i = 0; i < options.fiberCount; ++i)
+            {
+                auto fiber       = std::make_unique<JobFiber>();
+                fiber->jobSystem = this;
+                if (!fiber->fiber.Create(RunJobFiber, fiber.get(), options.fiberStackSize))
+                    break;
+
+                freeFibers.push_back(fiber.get());
+                fibers.push_back(std::move(fiber));
+            }
+        }
+
+        currentWorker = workers.front().get();
+        if (isRunningJobsOnFibers)
+            currentWorker->threadFiber.ConvertCurrentThread();
+
+        for (uint32_t i = 1; i <= options.workerThreadCount; ++i)
+            workers[i]->thread = std::thread(&JobSystem::WorkerMain, this, workers[i].get());
+    }
+
+    ~JobSystem()
+    {
+        isStopping.store(true, std::memory_order_seq_cst);
+        wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+        wakeEpoch.notify_all();
+
+        for (size_t i = 1; i < workers.size(); ++i)
+            workers[i]->thread.join();
+
+        for (const auto& worker : workers)
+            Assert_True(worker->queue.IsEmpty());
+        Assert_True(externalQueue.empty());
+        Assert_Eq(freeFibers.size(), fibers.size());
+
+        if (isRunningJobsOnFibers)
+            currentWorker->threadFiber.ConvertBackToThread();
+        currentWorker = nullptr;
+    }
+
+    JobSystem(const JobSystem&)            = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    uint32_t GetWorkerThreadCount() const { return static_cast<uint32_t>(workers.size() - 1); }
+
+    static void AddToCounter(JobCounter* counter, uint32_t jobCount)
+    {
+        if (counter)
+            counter->pendingCount.fetch_add(jobCount, std::memory_order_relaxed);
+    }
+
+    Job* CreateJob(const JobDeclaration& declaration, JobCounter* counter)
+    {
+        Assert_True(declaration.function != nullptr);
+        return jobPool.New(Job{.declaration = declaration, .counter = counter});
+    }
+
+    void Push(Job* job)
+    {
+        if (currentWorker)
+        {
+            currentWorker->queue.Push(job);
+        }
+        else
+        {
+            // Threads that aren't part of the job system don't have a queue to push to
+            const auto lock = std::lock_guard(externalQueueMutex);
+            externalQueue.push_back(job);
+            externalQueueSize.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Wake a sleeping worker, if there is one, for jobs that were just pushed.
+    void WakeWorkers()
+    {
+        // Pairs with the fence in TryToSleep(): either this sees the worker going to sleep, or the worker sees the job
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepingWorkerCount.load(std::memory_order_relaxed) == 0)
+            return;
+
+        wakeEpoch.fetch_add(1, std::memory_order_relaxed);
+        wakeEpoch.notify_all();
+    }
+
+    /// The calling thread's own newest job first, then the oldest one of any other thread.
+    Job* FindJob()
+    {
+        if (currentWorker)
+        {
+            if (const auto job = currentWorker->queue.Pop())
+                return *job;
+        }
+
+        if (externalQueueSize.load(std::memory_order_relaxed) > 0)
+        {
+            const auto lock = std::lock_guard(externalQueueMutex);
+            if (!externalQueue.empty())
+            {
+                auto* job = externalQueue.front();
+                externalQueue.pop_front();
+                externalQueueSize.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        // Start at a random victim so that idle workers don't all pile onto the same one
+        const auto workerCount = static_cast<uint32_t>(workers.size());
+        const auto firstVictim = currentWorker ? NextRandom(*currentWorker) % workerCount : 0;
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            auto& victim = *workers[(firstVictim + i) % workerCount];
+            if (&victim == currentWorker)
+                continue;
+
+            if (const auto job = victim.queue.Steal())
+                return *job;
+        }
+
+        return nullptr;
+    }
+
+    void Execute(Job* job)
+    {
+        auto* worker = GetCurrentWorker();
+        if (!isRunningJobsOnFibers || !worker)
+        {
+            RunJob(job);
+            return;
+        }
+
+        auto* fiber = job->fiberToResume;
+        if (fiber)
+        {
+            jobPool.Delete(job);
+        }
+        else
+        {
+            // Without a free fiber, the job runs on the thread's own stack, and waits there too
+            fiber = AcquireFiber();
+            if (!fiber)
+            {
+                RunJob(job);
+                return;
+            }
+            fiber->job = job;
+        }
+
+        Assert_True(worker->runningFiber == nullptr);
+        worker->runningFiber = fiber;
+        fiber->fiber.SwitchFrom(worker->threadFiber);
+
+        // Back on this thread's own stack, so worker is still this thread's
+        worker->runningFiber = nullptr;
+
+        if (auto* fiberToRelease = std::exchange(worker->fiberToRelease, nullptr))
+            ReleaseFiber(fiberToRelease);
+
+        if (auto* fiberToPark = std::exchange(worker->fiberToPark, nullptr))
+            Park(fiberToPark, *std::exchange(worker->parkCounter, nullptr));
+    }
+
+    void RunJob(Job* job)
+    {
+        job->declaration.function(job->declaration.data);
+        FinishJob(job);
+    }
+
+    /// Count the job as done, and queue whatever was waiting on its counter if it was the last one.
+    void FinishJob(Job* job)
+    {
+        auto* counter = job->counter;
+        jobPool.Delete(job);
+
+        if (!counter)
+            return;
+
+        auto pendingCount = counter->pendingCount.load(std::memory_order_relaxed);
+        while (pendingCount > 1)
+        {
+            if (counter->pendingCount.compare_exchange_weak(
+                    pendingCount, pendingCount - 1, std::memory_order_release, std::memory_order_relaxed))
+                return;
+        }
+
+        // Probably the last job. Its continuations are taken under the lock, which the counter's destructor waits
+        // for, since a waiting thread may return and destroy the counter as soon as it reaches zero.
+        auto continuations = std::vector<Job*>();
+        {
+            const auto lock = std::lock_guard(counter->continuationMutex);
+            if (counter->pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                continuations.swap(counter->continuations);
+        }
+
+        for (auto* continuation : continuations)
+            Push(continuation);
+        if (!continuations.empty())
+            WakeWorkers();
+    }
+
+    void RunAfter(JobCounter& dependency, std::span<const JobDeclaration> declarations, JobCounter* counter)
+    {
+        AddToCounter(counter, static_cast<uint32_t>(declarations.size()));
+
+        {
+            const auto lock = std::lock_guard(dependency.continuationMutex);
+
+            // Checked under the lock so that FinishJob() can't take the continuations before these are added to them
+            if (!dependency.IsDone())
+            {
+                for (const auto& declaration : declarations)
+                    dependency.continuations.push_back(CreateJob(declaration, counter));
+                return;
+            }
+        }
+
+        for (const auto& declaration : declarations)
+            Push(CreateJob(declaration, counter));
+        WakeWorkers();
+    }
+
+    void WaitFor(JobCounter& counter)
+    {
+        auto* worker = GetCurrentWorker();
+        if (worker && worker->runningFiber)
+        {
+            // Switch back to the thread's own stack, which parks this fiber on counter
+            while (!counter.IsDone())
+            {
+                auto* fiber         = worker->runningFiber;
+                worker->fiberToPark = fiber;
+                worker->parkCounter = &counter;
+                worker->threadFiber.SwitchFrom(fiber->fiber);
+
+                worker = GetCurrentWorker();
+            }
+            return;
+        }
+
+        // Threads outside the job system can't switch to a parked fiber, so they only help without fibers
+        const auto canRunJobs = worker || !isRunningJobsOnFibers;
+        while (!counter.IsDone())
+        {
+            auto* job = canRunJobs ? FindJob() : nullptr;
+            if (job)
+                Execute(job);
+            else
+                std::this_thread::yield();
+        }
+    }
+
+private:
+    /// How many times a worker looks for work before it goes to sleep.
+    static constexpr uint32_t spinCountBeforeSleep = 64;
+
+    const bool isRunningJobsOnFibers;
+    /// Its slabs come from the Jobs heap, if there is one.
+    Pool<Job> jobPool;
+    std::vector<std::unique_ptr<JobFiber>> fibers;
+    std::mutex freeFiberMutex;
+    std::vector<JobFiber*> freeFibers;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /// Jobs pushed from threads outside the job system.
+    std::mutex externalQueueMutex;
+    std::deque<Job*> externalQueue;
+    /// So that workers don't have to take the lock to find out there's nothing in it.
+    std::atomic<size_t> externalQueueSize = 0;
+
+    std::atomic<uint32_t> wakeEpoch           = 0;
+    std::atomic<uint32_t> sleepingWorkerCount = 0;
+    std::atomic<bool> isStopping              = false;
+
+    static uint32_t NextRandom(Worker& worker)
+    {
+        // xorshift32
+        auto x = worker.randomState;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        worker.randomState = x;
+        return x;
+    }
+
+    JobFiber* AcquireFiber()
+    {
+        const auto lock = std::lock_guard(freeFiberMutex);
+        if (freeFibers.empty())
+            return nullptr;
+
+        auto* fiber = freeFibers.back();
+        freeFibers.pop_back();
+        return fiber;
+    }
+
+    void ReleaseFiber(JobFiber* fiber)
+    {
+        const auto lock = std::lock_guard(freeFiberMutex);
+        freeFibers.push_back(fiber);
+    }
+
+    /// Queue the fiber to be resumed once counter is done, which may be right away.
+    void Park(JobFiber* fiber, JobCounter& counter)
+    {
+        auto* resumeJob = jobPool.New(Job{.fiberToResume = fiber});
+        {
+            const auto lock = std::lock_guard(counter.continuationMutex);
+            if (!counter.IsDone())
+            {
+                counter.continuations.push_back(resumeJob);
+                return;
+            }
+        }
+
+        Push(resumeJob);
+        WakeWorkers();
+    }
+
+    /// Every job fiber runs this, one job after another.
+    static void RunJobFiber(void* data)
+    {
+        auto& fiber = *static_cast<JobFiber*>(data);
+        while (true)
+        {
+            fiber.jobSystem->RunJob(std::exchange(fiber.job, nullptr));
+
+            auto* worker           = GetCurrentWorker();
+            worker->fiberToRelease = &fiber;
+            worker->threadFiber.SwitchFrom(fiber.fiber);
+        }
+    }
+
+    /// Sleep until more jobs are pushed. Returns a job instead if one turned up on the way.
+    Job* TryToSleep()
+    {
+        const auto epoch = wakeEpoch.load(std::memory_order_acquire);
+        sleepingWorkerCount.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto* job = FindJob();
+        if (!job && !isStopping.load(std::memory_order_relaxed))
+            wakeEpoch.wait(epoch, std::memory_order_relaxed);
+
+        sleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    void WorkerMain(Worker* worker)
+    {
+        currentWorker = worker;
+        if (isRunningJobsOnFibers)
+            worker->threadFiber.ConvertCurrentThread();
+
+        auto idleCount = uint32_t(0);
+        while (!isStopping.load(std::memory_order_relaxed))
+        {
+            auto* job = FindJob();
+            if (!job && ++idleCount >= spinCountBeforeSleep)
+                job = TryToSleep();
+
+            if (job)
+            {
+                Execute(job);
+                idleCount = 0;
+            }
+        }
+
+        if (isRunningJobsOnFibers)
+            worker->threadFiber.ConvertBackToThread();
+        currentWorker = nullptr;
+    }
+};
+
+static std::unique_ptr<JobSystem> jobSystem;
+
+JobCounter::~JobCounter()
+{
+    // Wait for FinishJob() to let go of the counter
+    const auto lock = std::lock_guard(continuationMutex);
+
+    Assert_True(IsDone());
+    Assert_True(continuations.empty());
+}
+
+uint32_t GetDefaultWorkerThreadCount()
+{
+    const auto hardwareThreadCount = std::thread::hardware_concurrency();
+    return hardwareThreadCount > 1 ? hardwareThreadCount - 1 : 1;
+}
+
+void Initialize(uint32_t workerThreadCount)
+{
+    Initialize(JobSystemOptions{.workerThreadCount = workerThreadCount});
+}
+
+void Initialize(const JobSystemOptions& options)
+{
+    Assert_True(!jobSystem);
+
+    jobSystem = std::make_unique<JobSystem>(options);
+    if (options.runJobsOnFibers)
+    {
+        Console::Log("Started {} job worker threads, with {} fibers of {} KiB",
+                     options.workerThreadCount,
+                     options.fiberCount,
+                     options.fiberStackSize / 1024);
+    }
+    else
+    {
+        Console::Log("Started {} job worker threads", options.workerThreadCount);
+    }
+}
+
+void Shutdown()
+{
+    jobSystem.reset();
+}
+
+bool IsInitialized()
+{
+    return jobSystem != nullptr;
+}
+
+uint32_t GetWorkerThreadCount()
+{
+    return jobSystem ? jobSystem->GetWorkerThreadCount() : 0;
+}
+
+void Run(std::span<const JobDeclaration> jobs, JobCounter* counter)
+{
+    if (!jobSystem)
+    {
+        for (const auto& job : jobs)
+            job.function(job.data);
+        return;
+    }
+
+    JobSystem::AddToCounter(counter, static_cast<uint32_t>(jobs.size()));
+    for (const auto& job : jobs)
+        jobSystem->Push(jobSystem->CreateJob(job, counter));
+
+    jobSystem->WakeWorkers();
+}
+
+void Run(const JobDeclaration& job, JobCounter* counter)
+{
+    Run(std::span(&job, 1), counter);
+}
+
+void RunAfter(JobCounter& dependency, std::span<const JobDeclaration> jobs, JobCounter* counter)
+{
+    if (!jobSystem)
+    {
+        // Without workers, every job has already run by the time it could be depended on
+        Assert_True(dependency.IsDone());
+        Run(jobs, counter);
+        return;
+    }
+
+    jobSystem->RunAfter(dependency, jobs, counter);
+}
+
+void WaitFor(JobCounter& counter)
+{
+    if (jobSystem)
+        jobSystem->WaitFor(counter);
+
+    Assert_True(counter.IsDone());
+}
+
+} // namespace Engine::Jobs
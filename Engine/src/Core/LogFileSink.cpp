@@ -0,0 +1,186 @@
+#include <Engine/Core/LogFileSink.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace Engine::Console
+{
+
+static std::optional<size_t> ParseSegmentIndex(const fs::path& path, std::string_view baseName)
+{
+    const auto fileName  = path.filename().string();
+    const auto extension = std::string_view(".log");
+
+    if (fileName.size() <= baseName.size() + 1 + extension.size() || !fileName.starts_with(baseName) ||
+        fileName[baseName.size()] != '.' || !fileName.ends_with(extension))
+    {
+        return std::nullopt;
+    }
+
+    const auto* digitsBegin = fileName.data() + baseName.size() + 1;
+    const auto* digitsEnd   = fileName.data() + fileName.size() - extension.size();
+
+    auto index              = size_t(0);
+    const auto [end, error] = std::from_chars(digitsBegin, digitsEnd, index);
+    if (error != std::errc() || end != digitsEnd)
+        return std::nullopt;
+
+    return index;
+}
+
+LogFileSink::LogFileSink(LogLevel verbosity, const LogFileOptions& options)
+    : options(options), segmentSize(std::max<size_t>(options.segmentSize, 1024)),
+      logStream(verbosity, [this](LogLevel logLevel, std::string_view message) { Write(logLevel, message); })
+{
+    const auto lock = std::scoped_lock(segmentMutex);
+
+    auto error = std::error_code();
+    fs::create_directories(options.directory, error);
+
+    auto existingSegments = std::vector<std::pair<size_t, fs::path>>();
+    for (const auto& entry : fs::directory_iterator(options.directory, error))
+    {
+        if (const auto index = ParseSegmentIndex(entry.path(), options.baseName))
+            existingSegments.emplace_back(*index, entry.path());
+    }
+    std::sort(existingSegments.begin(), existingSegments.end());
+
+    for (const auto& [index, path] : existingSegments)
+        segmentPaths.push_back(path);
+
+    if (!existingSegments.empty())
+    {
+        // Earlier segments were closed when rotating away from them, so only the last one can have been left behind
+        // by a crash
+        RecoverLogFile(existingSegments.back().second);
+        nextSegmentIndex = existingSegments.back().first + 1;
+    }
+
+    OpenNextSegment();
+}
+
+LogFileSink::~LogFileSink()
+{
+    const auto lock = std::scoped_lock(segmentMutex);
+    CloseSegment();
+}
+
+bool LogFileSink::IsValid()
+{
+    const auto lock = std::scoped_lock(segmentMutex);
+    return segment.IsValid();
+}
+
+fs::path LogFileSink::GetSegmentPath()
+{
+    const auto lock = std::scoped_lock(segmentMutex);
+    return segmentPath;
+}
+
+void LogFileSink::Write(LogLevel logLevel, std::string_view message)
+{
+    auto line = fmt::memory_buffer();
+    fmt::format_to(std::back_inserter(line), "[{}] {}\n", logLevel, message);
+
+    // A NUL marks where the completely written lines end, so there can't be one inside a line
+    std::replace(line.begin(), line.end(), '\0', ' ');
+
+    if (line.size() > segmentSize)
+    {
+        line.resize(segmentSize);
+        line[segmentSize - 1] = '\n';
+    }
+
+    const auto lock = std::scoped_lock(segmentMutex);
+    if (!segment.IsValid())
+        return;
+
+    const auto isFull    = segmentWritePosition + line.size() > segment.GetSize();
+    const auto isExpired = options.rotationInterval.count() > 0 && segmentWritePosition > 0 &&
+                           std::chrono::steady_clock::now() - segmentStartTime >= options.rotationInterval;
+
+    if ((isFull || isExpired) && !OpenNextSegment())
+        return;
+
+    auto* out = segment.GetData() + segmentWritePosition;
+    std::memcpy(out + 1, line.data() + 1, line.size() - 1);
+
+    // The first byte goes in last. Until then the line starts with a NUL, so a crash part way through the copy leaves
+    // the line looking unwritten rather than corrupt.
+    std::atomic_signal_fence(std::memory_order_release);
+    out[0] = static_cast<std::byte>(line[0]);
+
+    segmentWritePosition += line.size();
+}
+
+bool LogFileSink::OpenNextSegment()
+{
+    CloseSegment();
+
+    segmentPath = options.directory / fmt::format("{}.{:04}.log", options.baseName, nextSegmentIndex++);
+    if (!segment.Create(segmentPath, segmentSize))
+        return false;
+
+    segmentWritePosition = 0;
+    segmentStartTime     = std::chrono::steady_clock::now();
+    segmentPaths.push_back(segmentPath);
+
+    while (options.maxSegmentCount != 0 && segmentPaths.size() > options.maxSegmentCount)
+    {
+        auto error = std::error_code();
+        fs::remove(segmentPaths.front(), error);
+        segmentPaths.pop_front();
+    }
+
+    return true;
+}
+
+void LogFileSink::CloseSegment()
+{
+    // Trims the preallocated space that was never written to
+    if (segment.IsValid())
+        segment.Close(segmentWritePosition);
+}
+
+bool RecoverLogFile(const fs::path& logFilePath)
+{
+    auto file = std::ifstream(logFilePath, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    // Every line before the first NUL was completely written (see LogFileSink::Write)
+    auto writtenSize = uintmax_t(0);
+    auto chunk       = std::vector<char>(64 * 1024);
+    while (file.read(chunk.data(), static_cast<std::streamsize>(chunk.size())) || file.gcount() > 0)
+    {
+        const auto* chunkBegin = chunk.data();
+        const auto* chunkEnd   = chunkBegin + file.gcount();
+        const auto* nul        = std::find(chunkBegin, chunkEnd, '\0');
+
+        writtenSize += static_cast<uintmax_t>(nul - chunkBegin);
+        if (nul != chunkEnd)
+            break;
+    }
+    file.close();
+
+    auto error = std::error_code();
+    if (writtenSize != fs::file_size(logFilePath, error) && !error)
+        fs::resize_file(logFilePath, writtenSize, error);
+
+    return !error;
+}
+
+} // namespace Engine::Console
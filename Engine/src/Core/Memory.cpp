@@ -0,0 +1,492 @@
+#include <Engine/Core/Memory.h>
+
+#include <Engine/Core/Assertions.h>
+#include <Engine/Core/Console.h>
+
+#if ADHOC_WINDOWS && ADHOC_EDITOR
+    #include <mimalloc.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+
+namespace Engine::Memory
+{
+
+#if ADHOC_WINDOWS && ADHOC_EDITOR
+
+/// mimalloc heaps can only be allocated from on the thread that created them, so each Heap has one of these for every
+/// thread that allocates from it. mi_free() works from any thread.
+struct UnderlyingHeap
+{
+    mi_heap_t* heap = mi_heap_new();
+};
+
+static void DestroyUnderlyingHeap(UnderlyingHeap& underlyingHeap)
+{
+    mi_heap_destroy(underlyingHeap.heap);
+}
+
+static void* AllocateFromUnderlyingHeap(UnderlyingHeap& underlyingHeap,
+                                        size_t size,
+                                        size_t alignment,
+                                        size_t& allocatedSize)
+{
+    auto* memory = mi_heap_malloc_aligned(underlyingHeap.heap, size, alignment);
+    if (memory)
+        allocatedSize = mi_usable_size(memory);
+    return memory;
+}
+
+static size_t FreeToUnderlyingHeap(void* memory)
+{
+    const auto size = mi_usable_size(memory);
+    mi_free(memory);
+    return size;
+}
+
+#else
+
+struct UnderlyingHeap;
+
+/// Goes right before each block, which is linked into its thread's list so that the whole heap can be freed at once.
+struct HeapBlockHeader
+{
+    UnderlyingHeap* underlyingHeap;
+    HeapBlockHeader* previous;
+    HeapBlockHeader* next;
+    size_t size;
+    /// From the start of what came from malloc to the block.
+    size_t offset;
+};
+
+/// The blocks one thread allocated from a Heap, so that threads only contend over a list when one frees another's.
+struct UnderlyingHeap
+{
+    std::mutex mutex;
+    HeapBlockHeader* blocks = nullptr;
+};
+
+static void DestroyUnderlyingHeap(UnderlyingHeap& underlyingHeap)
+{
+    for (auto* header = underlyingHeap.blocks; header;)
+    {
+        auto* next = header->next;
+        std::free(reinterpret_cast<std::byte*>(header + 1) - header->offset);
+        header = next;
+    }
+    underlyingHeap.blocks = nullptr;
+}
+
+static void* AllocateFromUnderlyingHeap(UnderlyingHeap& underlyingHeap, size_t size, size_t alignment, size_t&)
+{
+    alignment = std::max(alignment, alignof(HeapBlockHeader));
+
+    auto* raw = static_cast<std::byte*>(std::malloc(sizeof(HeapBlockHeader) + alignment - 1 + size));
+    if (!raw)
+        return nullptr;
+
+    const auto blockStart  = reinterpret_cast<uintptr_t>(raw) + sizeof(HeapBlockHeader);
+    auto* memory           = reinterpret_cast<std::byte*>((blockStart + alignment - 1) & ~(alignment - 1));
+    auto* header           = reinterpret_cast<HeapBlockHeader*>(memory) - 1;
+    header->underlyingHeap = &underlyingHeap;
+    header->size           = size;
+    header->offset         = static_cast<size_t>(memory - raw);
+    header->previous       = nullptr;
+
+    {
+        const auto lock = std::lock_guard(underlyingHeap.mutex);
+        header->next    = underlyingHeap.blocks;
+        if (underlyingHeap.blocks)
+            underlyingHeap.blocks->previous = header;
+        underlyingHeap.blocks = header;
+    }
+
+    return memory;
+}
+
+static size_t FreeToUnderlyingHeap(void* memory)
+{
+    auto* header         = static_cast<HeapBlockHeader*>(memory) - 1;
+    auto& underlyingHeap = *header->underlyingHeap;
+
+    {
+        const auto lock = std::lock_guard(underlyingHeap.mutex);
+        if (header->previous)
+            header->previous->next = header->next;
+        else
+            underlyingHeap.blocks = header->next;
+        if (header->next)
+            header->next->previous = header->previous;
+    }
+
+    const auto size = header->size;
+    std::free(static_cast<std::byte*>(memory) - header->offset);
+    return size;
+}
+
+#endif
+
+/// One thread's part of a Heap, created the first time the thread allocates from it.
+struct ThreadHeap
+{
+    UnderlyingHeap underlyingHeap;
+    ThreadHeap* next = nullptr;
+};
+
+static void DestroyThreadHeaps(ThreadHeap*& threadHeaps)
+{
+    while (auto* threadHeap = threadHeaps)
+    {
+        threadHeaps = threadHeap->next;
+        DestroyUnderlyingHeap(threadHeap->underlyingHeap);
+        delete threadHeap;
+    }
+}
+
+/// How many heaps can exist at once, which is how many slots each thread's table of its thread heaps has.
+static constexpr size_t maxHeapCount = 64;
+
+struct HeapRegistry
+{
+    /// Also guards every heap's list of thread heaps.
+    std::mutex mutex;
+    std::vector<Heap*> heaps;
+    std::array<Heap*, maxHeapCount> slotHeaps = {};
+};
+
+/// Never destroyed, so that heaps which outlive static destruction, like the subsystem heaps if Shutdown() isn't
+/// called, can still unregister.
+static HeapRegistry& GetHeapRegistry()
+{
+    static auto* registry = new HeapRegistry();
+    return *registry;
+}
+
+/// Each heap takes a new generation when it's created and each time it's emptied, so that a thread can tell whether the
+/// thread heap in its slot still belongs to the heap.
+static std::atomic<uint64_t> nextHeapGeneration = 1;
+
+struct ThreadHeapSlot
+{
+    uint64_t generation    = 0;
+    ThreadHeap* threadHeap = nullptr;
+};
+
+struct ThreadHeapTable
+{
+    std::array<ThreadHeapSlot, maxHeapCount> slots;
+
+#if ADHOC_WINDOWS && ADHOC_EDITOR
+    ~ThreadHeapTable();
+#endif
+};
+
+static thread_local ThreadHeapTable threadHeapTable;
+
+#if ADHOC_WINDOWS && ADHOC_EDITOR
+ThreadHeapTable::~ThreadHeapTable()
+{
+    // mimalloc deletes the exiting thread's heaps itself, and moves the blocks still allocated from them over to the
+    // thread's default heap. They can still be freed one at a time, but DestroyAll() no longer sees them.
+    auto& registry  = GetHeapRegistry();
+    const auto lock = std::lock_guard(registry.mutex);
+    for (size_t slotIndex = 0; slotIndex < maxHeapCount; ++slotIndex)
+    {
+        const auto& slot = slots[slotIndex];
+        auto* heap       = registry.slotHeaps[slotIndex];
+        if (!slot.threadHeap || !heap || heap->generation.load(std::memory_order_relaxed) != slot.generation)
+            continue;
+
+        for (auto** link = &heap->threadHeaps; *link; link = &(*link)->next)
+        {
+            if (*link == slot.threadHeap)
+            {
+                *link = slot.threadHeap->next;
+                break;
+            }
+        }
+        delete slot.threadHeap;
+    }
+}
+#endif
+
+static thread_local Heap* currentHeap = nullptr;
+
+Heap::Heap(const HeapOptions& options)
+    : options(options)
+    , generation(nextHeapGeneration.fetch_add(1, std::memory_order_relaxed))
+    , softLimitBytes(options.budget.softLimitBytes)
+    , hardLimitBytes(options.budget.hardLimitBytes)
+{
+    auto& registry  = GetHeapRegistry();
+    const auto lock = std::lock_guard(registry.mutex);
+
+    const auto freeSlot = std::find(registry.slotHeaps.begin(), registry.slotHeaps.end(), nullptr);
+    if (freeSlot == registry.slotHeaps.end())
+        Console::LogFatal("No more than {} heaps can exist at once", maxHeapCount);
+
+    slotIndex = static_cast<uint32_t>(freeSlot - registry.slotHeaps.begin());
+    *freeSlot = this;
+    registry.heaps.push_back(this);
+}
+
+Heap::~Heap()
+{
+    auto& registry  = GetHeapRegistry();
+    const auto lock = std::lock_guard(registry.mutex);
+    std::erase(registry.heaps, this);
+    registry.slotHeaps[slotIndex] = nullptr;
+
+    DestroyThreadHeaps(threadHeaps);
+}
+
+UnderlyingHeap& Heap::GetThreadUnderlyingHeap()
+{
+    auto& slot = threadHeapTable.slots[slotIndex];
+    if (slot.generation != generation.load(std::memory_order_relaxed)) [[unlikely]]
+        slot = {.generation = generation.load(std::memory_order_relaxed), .threadHeap = AddThreadHeap()};
+
+    return slot.threadHeap->underlyingHeap;
+}
+
+ThreadHeap* Heap::AddThreadHeap()
+{
+    auto& registry   = GetHeapRegistry();
+    const auto lock  = std::lock_guard(registry.mutex);
+    auto* threadHeap = new ThreadHeap();
+    threadHeap->next = threadHeaps;
+    threadHeaps      = threadHeap;
+    return threadHeap;
+}
+
+void* Heap::Allocate(size_t size, size_t alignment)
+{
+    Assert_True(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    // The bytes are taken from the budget before the allocation, so that threads allocating at the same time can't
+    // take the heap past its hard limit between them
+    const auto hardLimit = hardLimitBytes.load(std::memory_order_relaxed);
+    auto live            = liveBytes.load(std::memory_order_relaxed);
+    do
+    {
+        if (hardLimit != 0 && live + size > hardLimit)
+        {
+            rejectedCount.fetch_add(1, std::memory_order_relaxed);
+            if (!isHardLimitReported.exchange(true, std::memory_order_relaxed))
+                ReportBudgetExceeded(BudgetLimit::Hard, hardLimit, live, size);
+            return nullptr;
+        }
+    } while (!liveBytes.compare_exchange_weak(live, live + size, std::memory_order_relaxed));
+
+    auto allocatedSize = size;
+    auto* memory       = AllocateFromUnderlyingHeap(GetThreadUnderlyingHeap(), size, alignment, allocatedSize);
+    if (!memory)
+    {
+        liveBytes.fetch_sub(size, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    // Counted as what the heap actually handed out, which is what freeing the block gives back
+    if (allocatedSize != size)
+        liveBytes.fetch_add(allocatedSize - size, std::memory_order_relaxed);
+
+    const auto newLive = live + allocatedSize;
+    liveCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(allocatedSize, std::memory_order_relaxed);
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    auto peak = peakBytes.load(std::memory_order_relaxed);
+    while (newLive > peak && !peakBytes.compare_exchange_weak(peak, newLive, std::memory_order_relaxed))
+    {}
+
+    const auto softLimit = softLimitBytes.load(std::memory_order_relaxed);
+    if (softLimit != 0 && newLive > softLimit && !isOverSoftLimit.exchange(true, std::memory_order_relaxed))
+        ReportBudgetExceeded(BudgetLimit::Soft, softLimit, newLive, size);
+
+    return memory;
+}
+
+void Heap::Free(void* memory)
+{
+    if (!memory)
+        return;
+
+    CountFree(FreeToUnderlyingHeap(memory));
+}
+
+void Heap::CountFree(size_t size)
+{
+    const auto newLive = liveBytes.fetch_sub(size, std::memory_order_relaxed) - size;
+    liveCount.fetch_sub(1, std::memory_order_relaxed);
+    freedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    // Reported again the next time it goes over
+    if (newLive <= softLimitBytes.load(std::memory_order_relaxed))
+        isOverSoftLimit.store(false, std::memory_order_relaxed);
+}
+
+void Heap::DestroyAll()
+{
+    {
+        auto& registry  = GetHeapRegistry();
+        const auto lock = std::lock_guard(registry.mutex);
+        DestroyThreadHeaps(threadHeaps);
+
+        // Every thread makes itself a new thread heap the next time it allocates
+        generation.store(nextHeapGeneration.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    freedBytes.fetch_add(liveBytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    liveCount.store(0, std::memory_order_relaxed);
+    isOverSoftLimit.store(false, std::memory_order_relaxed);
+}
+
+void Heap::BeginFrame()
+{
+    frameStartAllocated.store(allocatedBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    frameStartCount.store(allocationCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    frameStartFreed.store(freedBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    frameStartRejected.store(rejectedCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    isHardLimitReported.store(false, std::memory_order_relaxed);
+}
+
+HeapStats Heap::GetStats() const
+{
+    return HeapStats{
+        .name      = options.name,
+        .liveBytes = liveBytes.load(std::memory_order_relaxed),
+        .liveCount = liveCount.load(std::memory_order_relaxed),
+        .peakBytes = peakBytes.load(std::memory_order_relaxed),
+        .frameAllocatedBytes =
+            allocatedBytes.load(std::memory_order_relaxed) - frameStartAllocated.load(std::memory_order_relaxed),
+        .frameAllocationCount =
+            allocationCount.load(std::memory_order_relaxed) - frameStartCount.load(std::memory_order_relaxed),
+        .frameFreedBytes = freedBytes.load(std::memory_order_relaxed) - frameStartFreed.load(std::memory_order_relaxed),
+        .frameRejectedCount =
+            rejectedCount.load(std::memory_order_relaxed) - frameStartRejected.load(std::memory_order_relaxed),
+        .budget = HeapBudget{.softLimitBytes = softLimitBytes.load(std::memory_order_relaxed),
+                             .hardLimitBytes = hardLimitBytes.load(std::memory_order_relaxed)},
+    };
+}
+
+void Heap::SetBudget(const HeapBudget& budget)
+{
+    softLimitBytes.store(budget.softLimitBytes, std::memory_order_relaxed);
+    hardLimitBytes.store(budget.hardLimitBytes, std::memory_order_relaxed);
+    // So that a heap that's already over a lowered limit is reported on its next allocation
+    isOverSoftLimit.store(false, std::memory_order_relaxed);
+}
+
+void Heap::ReportBudgetExceeded(BudgetLimit limit, size_t limitBytes, size_t live, size_t requestedBytes)
+{
+    const auto event = BudgetExceededEvent{
+        .heapName       = options.name,
+        .limit          = limit,
+        .limitBytes     = limitBytes,
+        .liveBytes      = live,
+        .requestedBytes = requestedBytes,
+    };
+
+    if (options.onBudgetExceeded)
+    {
+        options.onBudgetExceeded(event);
+        return;
+    }
+
+    if (limit == BudgetLimit::Soft)
+    {
+        Console::LogWarning("{} heap went over its soft budget of {} bytes, to {} bytes",
+                            event.heapName,
+                            event.limitBytes,
+                            event.liveBytes);
+    }
+    else
+    {
+        Console::LogWarning("{} heap refused {} bytes, which would have taken it past its hard budget of {} bytes, with"
+                            " {} bytes live",
+                            event.heapName,
+                            event.requestedBytes,
+                            event.limitBytes,
+                            event.liveBytes);
+    }
+}
+
+HeapScope::HeapScope(Heap& heap) : previousHeap(currentHeap)
+{
+    currentHeap = &heap;
+}
+
+HeapScope::~HeapScope()
+{
+    currentHeap = previousHeap;
+}
+
+Heap* GetCurrentHeap()
+{
+    return currentHeap;
+}
+
+void BeginFrame()
+{
+    auto& registry  = GetHeapRegistry();
+    const auto lock = std::lock_guard(registry.mutex);
+    for (auto* heap : registry.heaps)
+        heap->BeginFrame();
+}
+
+void GetHeapStats(std::vector<HeapStats>& stats)
+{
+    stats.clear();
+
+    auto& registry  = GetHeapRegistry();
+    const auto lock = std::lock_guard(registry.mutex);
+    for (const auto* heap : registry.heaps)
+        stats.push_back(heap->GetStats());
+}
+
+static constexpr auto subsystemCount = static_cast<size_t>(Subsystem::Count);
+
+static constexpr std::array<const char*, subsystemCount> subsystemNames = {
+    "Logging",
+    "Editor state",
+    "Assets",
+    "Jobs",
+};
+
+static std::array<std::unique_ptr<Heap>, subsystemCount> subsystemHeaps;
+
+void Initialize(const MemoryOptions& options)
+{
+    Assert_False(IsInitialized());
+
+    for (size_t subsystem = 0; subsystem < subsystemCount; ++subsystem)
+    {
+        subsystemHeaps[subsystem] = std::make_unique<Heap>(
+            HeapOptions{.name = subsystemNames[subsystem], .budget = options.budgets[subsystem]});
+    }
+}
+
+void Shutdown()
+{
+    for (auto& heap : subsystemHeaps)
+        heap.reset();
+}
+
+bool IsInitialized()
+{
+    return subsystemHeaps[0] != nullptr;
+}
+
+Heap& GetSubsystemHeap(Subsystem subsystem)
+{
+    Assert_True(IsInitialized());
+    return *subsystemHeaps[static_cast<size_t>(subsystem)];
+}
+
+const char* GetSubsystemName(Subsystem subsystem)
+{
+    return subsystemNames[static_cast<size_t>(subsystem)];
+}
+
+} // namespace Engine::Memory
@@ -0,0 +1,348 @@
+#include <Engine/Core/PoolAllocator.h>
+
+#include <Engine/Core/Assertions.h>
+#include <Engine/Core/BacktraceSymbolHandler.h>
+#include <Engine/Core/Console.h>
+#include <Engine/Core/Memory.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+namespace Engine
+{
+
+struct PoolFreeNode
+{
+    PoolFreeNode* next;
+};
+
+/// One thread's free objects for one pool. Only that thread touches the list; the counts are atomic so that the pool
+/// can add them up when it's destroyed.
+struct PoolThreadCache
+{
+    std::atomic<uint64_t> allocatorId = 0;
+    PoolFreeNode* head                = nullptr;
+    std::atomic<uint32_t> count       = 0;
+};
+
+static constexpr uint32_t maxThreadCachedPools = 64;
+
+/// A thread's caches, one for each pool that has a thread cache slot. Given back to their pools when the thread exits.
+struct PoolThreadCaches
+{
+    std::array<PoolThreadCache, maxThreadCachedPools> caches;
+
+    PoolThreadCaches();
+    ~PoolThreadCaches();
+
+    /// The calling thread's cache for allocator, emptied first if it was last used by a pool that's since been destroyed.
+    PoolThreadCache& Get(const SlabAllocator& allocator);
+};
+
+struct PoolRegistry
+{
+    std::mutex mutex;
+    /// Which pool each thread cache slot belongs to.
+    std::array<SlabAllocator*, maxThreadCachedPools> allocators = {};
+    std::vector<PoolThreadCaches*> threadCaches;
+};
+
+static PoolRegistry& GetPoolRegistry()
+{
+    static PoolRegistry registry;
+    return registry;
+}
+
+static std::atomic<uint64_t> nextAllocatorId = 1;
+
+static thread_local PoolThreadCaches threadCaches;
+
+PoolThreadCaches::PoolThreadCaches()
+{
+    auto& registry  = GetPoolRegistry();
+    const auto lock = std::lock_guard(registry.mutex);
+    registry.threadCaches.push_back(this);
+}
+
+PoolThreadCaches::~PoolThreadCaches()
+{
+    auto& registry  = GetPoolRegistry();
+    const auto lock = std::lock_guard(registry.mutex);
+
+    for (uint32_t slot = 0; slot < maxThreadCachedPools; ++slot)
+    {
+        auto& cache      = caches[slot];
+        auto* allocator  = registry.allocators[slot];
+        const auto count = cache.count.load(std::memory_order_relaxed);
+        if (!allocator || allocator->id != cache.allocatorId.load(std::memory_order_relaxed) || count == 0)
+            continue;
+
+        auto* last = cache.head;
+        while (last->next)
+            last = last->next;
+
+        const auto allocatorLock = std::lock_guard(allocator->mutex);
+        allocator->ReturnToFreeList(cache.head, last, count);
+    }
+
+    std::erase(registry.threadCaches, this);
+}
+
+PoolThreadCache& PoolThreadCaches::Get(const SlabAllocator& allocator)
+{
+    auto& cache = caches[allocator.threadCacheSlot];
+    if (cache.allocatorId.load(std::memory_order_relaxed) != allocator.id)
+    {
+        // Whatever's left in it belonged to slabs that are gone
+        cache.head = nullptr;
+        cache.count.store(0, std::memory_order_relaxed);
+        cache.allocatorId.store(allocator.id, std::memory_order_relaxed);
+    }
+
+    return cache;
+}
+
+static size_t ComputeElementStride(size_t elementSize, size_t elementAlignment)
+{
+    // Free objects hold the free list's links, so they have to fit one
+    const auto alignment = std::max(elementAlignment, alignof(PoolFreeNode));
+    const auto size      = std::max(elementSize, sizeof(PoolFreeNode));
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+SlabAllocator::SlabAllocator(size_t elementSize, size_t elementAlignment, const PoolOptions& options)
+    : options(options)
+    , elementStride(ComputeElementStride(elementSize, std::max(elementAlignment, size_t(1))))
+    , elementsPerSlab(std::max(options.slabSize / elementStride, size_t(1)))
+    , id(nextAllocatorId.fetch_add(1, std::memory_order_relaxed))
+{
+    Assert_True(elementAlignment <= slabAlignment);
+    Assert_Gt(options.threadCacheBatchSize, 0u);
+
+    if (!options.useThreadCaches)
+        return;
+
+    auto& registry  = GetPoolRegistry();
+    const auto lock = std::lock_guard(registry.mutex);
+
+    const auto freeSlot = std::find(registry.allocators.begin(), registry.allocators.end(), nullptr);
+    if (freeSlot != registry.allocators.end())
+    {
+        *freeSlot       = this;
+        threadCacheSlot = static_cast<uint32_t>(freeSlot - registry.allocators.begin());
+    }
+}
+
+SlabAllocator::~SlabAllocator()
+{
+    auto cachedCount = size_t(0);
+    if (HasThreadCaches())
+    {
+        auto& registry  = GetPoolRegistry();
+        const auto lock = std::lock_guard(registry.mutex);
+
+        registry.allocators[threadCacheSlot] = nullptr;
+        for (const auto* caches : registry.threadCaches)
+        {
+            const auto& cache = caches->caches[threadCacheSlot];
+            if (cache.allocatorId.load(std::memory_order_relaxed) == id)
+                cachedCount += cache.count.load(std::memory_order_relaxed);
+        }
+    }
+
+    const auto lock = std::lock_guard(mutex);
+    if (outstandingCount > cachedCount)
+        ReportLeaks(outstandingCount - cachedCount);
+
+    for (void* slab : slabs)
+    {
+        if (options.heap)
+            options.heap->Free(slab);
+        else
+            ::operator delete(slab, std::align_val_t(slabAlignment));
+    }
+}
+
+void* SlabAllocator::Allocate()
+{
+    PoolFreeNode* node = nullptr;
+    if (HasThreadCaches())
+    {
+        auto& cache = threadCaches.Get(*this);
+        if (!cache.head)
+        {
+            const auto lock = std::lock_guard(mutex);
+            auto takenCount = uint32_t(0);
+            cache.head      = TakeFromFreeList(options.threadCacheBatchSize, takenCount);
+            cache.count.store(takenCount, std::memory_order_relaxed);
+        }
+
+        node       = cache.head;
+        cache.head = node->next;
+        cache.count.store(cache.count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    }
+    else
+    {
+        const auto lock = std::lock_guard(mutex);
+        auto takenCount = uint32_t(0);
+        node            = TakeFromFreeList(1, takenCount);
+    }
+
+    TrackAllocation(node);
+    return node;
+}
+
+void SlabAllocator::Free(void* element)
+{
+    if (!element)
+        return;
+
+    TrackFree(element);
+
+    auto* node = static_cast<PoolFreeNode*>(element);
+    if (!HasThreadCaches())
+    {
+        const auto lock = std::lock_guard(mutex);
+        ReturnToFreeList(node, node, 1);
+        return;
+    }
+
+    auto& cache = threadCaches.Get(*this);
+    node->next  = cache.head;
+    cache.head  = node;
+
+    // Keeps a batch for the thread's next allocations and gives a batch back, so that a thread that only frees what
+    // others allocate doesn't hoard them
+    const auto batchSize = options.threadCacheBatchSize;
+    auto count           = cache.count.load(std::memory_order_relaxed) + 1;
+    if (count >= 2 * batchSize)
+    {
+        auto* first = cache.head;
+        auto* last  = first;
+        for (uint32_t i = 1; i < batchSize; ++i)
+            last = last->next;
+        cache.head = last->next;
+        count -= batchSize;
+
+        const auto lock = std::lock_guard(mutex);
+        ReturnToFreeList(first, last, batchSize);
+    }
+
+    cache.count.store(count, std::memory_order_relaxed);
+}
+
+size_t SlabAllocator::GetLiveCount() const
+{
+    auto cachedCount = size_t(0);
+    if (HasThreadCaches())
+    {
+        auto& registry  = GetPoolRegistry();
+        const auto lock = std::lock_guard(registry.mutex);
+        for (const auto* caches : registry.threadCaches)
+        {
+            const auto& cache = caches->caches[threadCacheSlot];
+            if (cache.allocatorId.load(std::memory_order_relaxed) == id)
+                cachedCount += cache.count.load(std::memory_order_relaxed);
+        }
+    }
+
+    const auto lock = std::lock_guard(mutex);
+    return outstandingCount - cachedCount;
+}
+
+size_t SlabAllocator::GetSlabCount() const
+{
+    const auto lock = std::lock_guard(mutex);
+    return slabs.size();
+}
+
+PoolFreeNode* SlabAllocator::TakeFromFreeList(uint32_t count, uint32_t& takenCount)
+{
+    if (!freeList)
+    {
+        const auto slabSize = elementsPerSlab * elementStride;
+        void* slabMemory    = options.heap ? options.heap->Allocate(slabSize, slabAlignment)
+                                           : ::operator new(slabSize, std::align_val_t(slabAlignment));
+        if (!slabMemory)
+            throw std::bad_alloc();
+
+        auto* slab = static_cast<std::byte*>(slabMemory);
+        slabs.push_back(slab);
+
+        // Linked back to front, so that objects are handed out in address order
+        for (auto i = elementsPerSlab; i-- > 0;)
+        {
+            auto* node = reinterpret_cast<PoolFreeNode*>(slab + i * elementStride);
+            node->next = freeList;
+            freeList   = node;
+        }
+    }
+
+    auto* first = freeList;
+    auto* last  = first;
+    takenCount  = 1;
+    while (takenCount < count && last->next)
+    {
+        last = last->next;
+        ++takenCount;
+    }
+
+    freeList   = last->next;
+    last->next = nullptr;
+    outstandingCount += takenCount;
+    return first;
+}
+
+void SlabAllocator::ReturnToFreeList(PoolFreeNode* first, PoolFreeNode* last, uint32_t count)
+{
+    last->next = freeList;
+    freeList   = first;
+
+    Assert_Ge(outstandingCount, count);
+    outstandingCount -= count;
+}
+
+void SlabAllocator::TrackAllocation([[maybe_unused]] void* element)
+{
+#if ADHOC_DEBUG
+    const auto stackTrace = StackTrace::Capture(1);
+
+    const auto lock = std::lock_guard(mutex);
+    liveAllocations.emplace(element, stackTrace);
+#endif
+}
+
+void SlabAllocator::TrackFree([[maybe_unused]] void* element)
+{
+#if ADHOC_DEBUG
+    const auto lock = std::lock_guard(mutex);
+
+    // Either freed twice, or it was never allocated from this pool
+    Assert_Eq(liveAllocations.erase(element), 1u);
+#endif
+}
+
+void SlabAllocator::ReportLeaks(size_t leakCount)
+{
+    Console::LogError("{} leaked {} objects", options.name, leakCount);
+
+#if ADHOC_DEBUG
+    static constexpr size_t maxReportedLeaks = 4;
+
+    auto* symbolHandler = BacktraceSymbolHandler::GetInstance();
+    if (!symbolHandler)
+        return;
+
+    auto reportedCount = size_t(0);
+    for (const auto& [element, stackTrace] : liveAllocations)
+    {
+        if (reportedCount++ == maxReportedLeaks)
+            break;
+
+        Console::LogError("{} leaked {} allocated at:\n{}", options.name, element, symbolHandler->Symbolize(stackTrace));
+    }
+#endif
+}
+
+} // namespace Engine
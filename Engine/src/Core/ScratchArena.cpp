@@ -0,0 +1,150 @@
+#include <Engine/Core/ScratchArena.h>
+
+#include <Engine/Core/Assertions.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace Engine
+{
+
+struct ScratchArena
+{
+    std::byte* memory = nullptr;
+    size_t offset     = 0;
+
+    ScratchScope* innermostScope = nullptr;
+};
+
+/// Owns the thread's arena, which is only created once the thread opens its first scope.
+struct ScratchArenaOwner
+{
+    ScratchArena arena;
+
+    ~ScratchArenaOwner();
+};
+
+// Plain pointers and flags, which are still safe to read while the thread's other thread_locals are being destroyed
+static thread_local ScratchArena* threadArena   = nullptr;
+static thread_local bool isThreadArenaDestroyed = false;
+static thread_local ScratchArenaOwner arenaOwner;
+
+ScratchArenaOwner::~ScratchArenaOwner()
+{
+    Assert_True(arena.innermostScope == nullptr);
+
+    std::free(arena.memory);
+    threadArena            = nullptr;
+    isThreadArenaDestroyed = true;
+}
+
+static ScratchArena* GetThreadArena()
+{
+    if (threadArena || isThreadArenaDestroyed)
+        return threadArena;
+
+    // Allocated once per thread and reused by every scope after that
+    auto& arena  = arenaOwner.arena;
+    arena.memory = static_cast<std::byte*>(std::malloc(scratchArenaSize));
+    if (!arena.memory)
+        return nullptr;
+
+#if ADHOC_DEBUG
+    std::memset(arena.memory, static_cast<int>(scratchReleasedPattern), scratchArenaSize);
+#endif
+
+    threadArena = &arena;
+    return threadArena;
+}
+
+/// Heap allocations are chained through a header in front of them.
+struct ScratchScope::HeapBlock
+{
+    HeapBlock* next;
+    size_t alignment;
+};
+
+ScratchScope::ScratchScope() : arena(GetThreadArena())
+{
+    if (!arena)
+        return;
+
+    outerScope            = arena->innermostScope;
+    startOffset           = arena->offset;
+    arena->innermostScope = this;
+}
+
+ScratchScope::~ScratchScope()
+{
+    while (heapBlocks)
+    {
+        auto* next = heapBlocks->next;
+        ::operator delete(heapBlocks, std::align_val_t(heapBlocks->alignment));
+        heapBlocks = next;
+    }
+
+    if (!arena)
+        return;
+
+    Assert_True(arena->innermostScope == this);
+
+#if ADHOC_DEBUG
+    std::memset(arena->memory + startOffset, static_cast<int>(scratchReleasedPattern), arena->offset - startOffset);
+#endif
+
+    arena->offset         = startOffset;
+    arena->innermostScope = outerScope;
+}
+
+void* ScratchScope::Allocate(size_t size, size_t alignment)
+{
+    Assert_True(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    if (!arena)
+        return AllocateFromHeap(size, alignment);
+
+    // An outer scope allocating would hand out memory that an inner one releases when it ends
+    Assert_True(arena->innermostScope == this);
+
+    const auto address        = reinterpret_cast<uintptr_t>(arena->memory + arena->offset);
+    const auto alignedAddress = (address + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    const auto alignedOffset  = arena->offset + (alignedAddress - address);
+    if (alignedOffset + size > scratchArenaSize || alignedOffset + size < alignedOffset)
+        return AllocateFromHeap(size, alignment);
+
+    auto* memory  = arena->memory + alignedOffset;
+    arena->offset = alignedOffset + size;
+
+#if ADHOC_DEBUG
+    std::memset(memory, static_cast<int>(scratchAllocatedPattern), size);
+#endif
+
+    return memory;
+}
+
+size_t ScratchScope::GetArenaBytesUsed() const
+{
+    return arena ? arena->offset - startOffset : 0;
+}
+
+void* ScratchScope::AllocateFromHeap(size_t size, size_t alignment)
+{
+    // The header goes at the start of the block, padded so that what's handed out after it is still aligned
+    alignment             = std::max(alignment, alignof(HeapBlock));
+    const auto headerSize = (sizeof(HeapBlock) + alignment - 1) & ~(alignment - 1);
+
+    auto* block = static_cast<std::byte*>(::operator new(headerSize + size, std::align_val_t(alignment)));
+    heapBlocks  = new (block) HeapBlock{.next = heapBlocks, .alignment = alignment};
+    heapBytesUsed += size;
+
+#if ADHOC_DEBUG
+    std::memset(block + headerSize, static_cast<int>(scratchAllocatedPattern), size);
+#endif
+
+    return block + headerSize;
+}
+
+} // namespace Engine
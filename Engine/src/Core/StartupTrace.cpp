@@ -0,0 +1,197 @@
+#include <Engine/Core/StartupTrace.h>
+
+#include <Engine/Core/Console.h>
+
+#include <fmt/format.h>
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
+namespace fs = std::filesystem;
+
+namespace Engine
+{
+
+// Scopes can run from static initializers in any module, so these can't be plain globals
+struct StartupTraceState
+{
+    std::mutex mutex;
+    std::vector<StartupTraceEvent> events;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    fs::path tracePath;
+};
+
+static StartupTraceState& GetStartupTraceState()
+{
+    static StartupTraceState state;
+    return state;
+}
+
+static std::atomic<bool> isTracingStartup     = true;
+static std::atomic<uint32_t> nextThreadIndex  = 1;
+static thread_local uint32_t threadIndex      = 0;
+static thread_local bool hasThreadIndex       = false;
+static thread_local uint32_t threadScopeDepth = 0;
+
+static uint32_t GetThreadIndex()
+{
+    if (!hasThreadIndex)
+    {
+        threadIndex    = nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+        hasThreadIndex = true;
+    }
+    return threadIndex;
+}
+
+StartupTraceScope::StartupTraceScope(const char* name)
+    : name(name), isRecording(isTracingStartup.load(std::memory_order_relaxed))
+{
+    if (!isRecording)
+        return;
+
+    ++threadScopeDepth;
+    startTime = std::chrono::steady_clock::now();
+}
+
+StartupTraceScope::~StartupTraceScope()
+{
+    if (!isRecording)
+        return;
+
+    const auto endTime = std::chrono::steady_clock::now();
+    --threadScopeDepth;
+
+    // Scopes that are still open when tracing ends, like main(), aren't part of startup
+    if (!isTracingStartup.load(std::memory_order_relaxed))
+        return;
+
+    auto& state     = GetStartupTraceState();
+    const auto lock = std::lock_guard(state.mutex);
+    state.events.push_back({.name        = name,
+                            .threadIndex = GetThreadIndex(),
+                            .depth       = threadScopeDepth,
+                            .start       = startTime - state.startTime,
+                            .duration    = endTime - startTime});
+}
+
+void BeginStartupTrace()
+{
+    auto& state     = GetStartupTraceState();
+    const auto lock = std::lock_guard(state.mutex);
+
+    // This thread is the one the summary follows
+    threadIndex    = 0;
+    hasThreadIndex = true;
+
+    state.events.clear();
+    state.startTime = std::chrono::steady_clock::now();
+    isTracingStartup.store(true, std::memory_order_relaxed);
+}
+
+static void WriteChromeTrace(const fs::path& path, const std::vector<StartupTraceEvent>& events)
+{
+    auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        Console::LogError("Failed to write the startup trace to {}!", path.string());
+        return;
+    }
+
+    // Complete events, with their times in microseconds
+    auto json = std::string("{\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const auto& event = events[i];
+
+        auto escapedName = std::string();
+        for (const char c : event.name)
+        {
+            if (c == '"' || c == '\\')
+                escapedName += '\\';
+            escapedName += c;
+        }
+
+        fmt::format_to(std::back_inserter(json),
+                       "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}{}\n",
+                       escapedName,
+                       event.threadIndex,
+                       event.start.count() / 1000.0,
+                       event.duration.count() / 1000.0,
+                       i + 1 < events.size() ? "," : "");
+    }
+    json += "]}\n";
+
+    file << json;
+    Console::Log("Wrote the startup trace to {}", path.string());
+}
+
+std::chrono::nanoseconds EndStartupTrace()
+{
+    auto& state = GetStartupTraceState();
+
+    auto events    = std::vector<StartupTraceEvent>();
+    auto tracePath = fs::path();
+    auto totalTime = std::chrono::nanoseconds();
+    {
+        const auto lock = std::lock_guard(state.mutex);
+        isTracingStartup.store(false, std::memory_order_relaxed);
+
+        events    = state.events;
+        tracePath = state.tracePath;
+        totalTime = std::chrono::steady_clock::now() - state.startTime;
+    }
+
+    const auto ToMilliseconds = [](std::chrono::nanoseconds time) { return time.count() / 1e6; };
+
+    // The outermost scopes on the main thread run one after the other, so together they're the critical path.
+    // Everything else either overlaps them on other threads or is inside one of them.
+    Console::Log(
+        "Startup took {:.1f} ms, against a budget of {} ms:", ToMilliseconds(totalTime), startupBudget.count());
+
+    auto criticalPathTime = std::chrono::nanoseconds();
+    for (const auto& event : events)
+    {
+        if (event.threadIndex != 0 || event.depth != 0)
+            continue;
+
+        criticalPathTime += event.duration;
+        Console::Log("  {:<32} {:>8.1f} ms", event.name, ToMilliseconds(event.duration));
+    }
+    Console::Log("  {:<32} {:>8.1f} ms", "(untraced)", ToMilliseconds(totalTime - criticalPathTime));
+
+    for (const auto& event : events)
+    {
+        if (event.threadIndex != 0 && event.depth == 0)
+            Console::Log("  {:<32} {:>8.1f} ms in the background", event.name, ToMilliseconds(event.duration));
+    }
+
+    if (totalTime > startupBudget)
+        Console::LogWarning("Startup went {:.1f} ms over budget!", ToMilliseconds(totalTime - startupBudget));
+
+    if (!tracePath.empty())
+        WriteChromeTrace(tracePath, events);
+
+    return totalTime;
+}
+
+bool IsTracingStartup()
+{
+    return isTracingStartup.load(std::memory_order_relaxed);
+}
+
+void SetStartupTracePath(const fs::path& path)
+{
+    auto& state     = GetStartupTraceState();
+    const auto lock = std::lock_guard(state.mutex);
+    state.tracePath = path;
+}
+
+std::vector<StartupTraceEvent> GetStartupTraceEvents()
+{
+    auto& state     = GetStartupTraceState();
+    const auto lock = std::lock_guard(state.mutex);
+    return state.events;
+}
+
+} // namespace Engine
@@ -0,0 +1,141 @@
+#include <Engine/Core/_platform/Linux/LinuxBacktraceSymbolHandler.h>
+
+#if ADHOC_HAS_LIBBACKTRACE
+    #include <backtrace.h>
+#endif
+#include <cxxabi.h>
+#include <dlfcn.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+namespace fs = std::filesystem;
+
+namespace Engine
+{
+
+static std::string Demangle(const char* symbol)
+{
+    int demangleStatus    = 0;
+    char* demangledSymbol = abi::__cxa_demangle(symbol, nullptr, nullptr, &demangleStatus);
+
+    auto result = std::string(demangleStatus == 0 ? demangledSymbol : symbol);
+
+    free(demangledSymbol);
+    return result;
+}
+
+#if ADHOC_HAS_LIBBACKTRACE
+static void OnBacktraceError(void*, const char*, int)
+{
+    // Modules without debug info are reported here, and just end up without a file and line
+}
+
+/// libbacktrace reads the ELF symbol tables and DWARF line tables of every loaded module in-process, and keeps what
+/// it has parsed, which is far cheaper than running addr2line per address.
+static backtrace_state* GetBacktraceState()
+{
+    static backtrace_state* state = backtrace_create_state(nullptr, 1, OnBacktraceError, nullptr);
+    return state;
+}
+
+static int OnProgramCounterInfo(void* userData, uintptr_t, const char* file, int line, const char* function)
+{
+    auto& symbol = *static_cast<SymbolInfo*>(userData);
+    if (!function)
+        return 0;
+
+    // Inlined frames come innermost first, and the innermost one is where the address really is
+    symbol.function = Demangle(function);
+    if (file)
+    {
+        symbol.file = file;
+        symbol.line = static_cast<uint32_t>(line);
+    }
+    return 1;
+}
+
+static void OnSymbolInfo(void* userData, uintptr_t address, const char* symbolName, uintptr_t symbolAddress, uintptr_t)
+{
+    auto& symbol = *static_cast<SymbolInfo*>(userData);
+    if (!symbolName)
+        return;
+
+    // Offsets are from the return address, like everywhere else in the trace
+    symbol.function = Demangle(symbolName);
+    symbol.offset   = address + 1 - symbolAddress;
+}
+#endif
+
+LinuxBacktraceSymbolHandler::LinuxBacktraceSymbolHandler()
+{
+    StartLoadingSymbols();
+}
+
+LinuxBacktraceSymbolHandler::~LinuxBacktraceSymbolHandler()
+{
+    WaitForSymbols();
+}
+
+void LinuxBacktraceSymbolHandler::LoadSymbols()
+{
+#if ADHOC_HAS_LIBBACKTRACE
+    // libbacktrace only reads a module's debug info the first time it's asked about an address in it, so ask about one
+    // in the Engine now rather than during the first backtrace
+    if (auto* state = GetBacktraceState())
+    {
+        auto symbol = SymbolInfo();
+        backtrace_pcinfo(state,
+                         reinterpret_cast<uintptr_t>(&OnProgramCounterInfo),
+                         OnProgramCounterInfo,
+                         OnBacktraceError,
+                         &symbol);
+    }
+#endif
+}
+
+SymbolInfo LinuxBacktraceSymbolHandler::LookupSymbol(void* address)
+{
+    auto symbol = SymbolInfo();
+
+    // Return addresses point just past their call, which can be the start of the next function if the call was the
+    // last instruction of a noreturn one
+    const auto callAddress = reinterpret_cast<uintptr_t>(address) - 1;
+
+    auto info = Dl_info();
+    if (dladdr(reinterpret_cast<void*>(callAddress), &info) != 0 && info.dli_fname)
+        symbol.module = fs::path(info.dli_fname).filename().string();
+
+#if ADHOC_HAS_LIBBACKTRACE
+    if (auto* state = GetBacktraceState())
+    {
+        backtrace_pcinfo(state, callAddress, OnProgramCounterInfo, OnBacktraceError, &symbol);
+        if (symbol.function.empty())
+            backtrace_syminfo(state, callAddress, OnSymbolInfo, OnBacktraceError, &symbol);
+        if (!symbol.function.empty())
+            return symbol;
+    }
+#endif
+
+    // dladdr() only sees exported symbols
+    if (info.dli_sname)
+    {
+        symbol.function = Demangle(info.dli_sname);
+        symbol.offset   = callAddress + 1 - reinterpret_cast<uintptr_t>(info.dli_saddr);
+    }
+    else if (info.dli_fbase)
+    {
+        symbol.offset = callAddress + 1 - reinterpret_cast<uintptr_t>(info.dli_fbase);
+    }
+
+    return symbol;
+}
+
+} // namespace Engine
@@ -0,0 +1,115 @@
+#include <Engine/Core/CrashHandler.h>
+
+#include <execinfo.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <iterator>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+namespace Engine
+{
+
+static constexpr int crashSignals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+static struct sigaction previousCrashActions[std::size(crashSignals)];
+static std::atomic<CrashCallback> crashCallback = nullptr;
+static bool isCrashHandlerInstalled             = false;
+
+// The handler runs on its own stack so a stack overflow can still be reported
+alignas(16) static char crashHandlerStack[64 * 1024];
+
+static const char* GetSignalName(int signalNumber)
+{
+    switch (signalNumber)
+    {
+    case SIGSEGV: return "SIGSEGV";
+    case SIGBUS: return "SIGBUS";
+    case SIGFPE: return "SIGFPE";
+    case SIGILL: return "SIGILL";
+    case SIGABRT: return "SIGABRT";
+    default: return "unknown signal";
+    }
+}
+
+/// fmt and stdio may allocate or lock, neither of which is allowed in a signal handler.
+static void WriteToStderr(const char* text)
+{
+    [[maybe_unused]] auto result = write(STDERR_FILENO, text, strlen(text));
+}
+
+static void OnCrashSignal(int signalNumber, siginfo_t*, void*)
+{
+    // backtrace() unwinds through the signal frame into the code that crashed, which frame pointers can't do. Its
+    // first frame is this handler.
+    auto stackTrace       = StackTrace();
+    stackTrace.frameCount = static_cast<uint32_t>(backtrace(stackTrace.frames, StackTrace::maxFrames));
+
+    WriteToStderr("Fatal signal ");
+    WriteToStderr(GetSignalName(signalNumber));
+    WriteToStderr("! Stack:\n");
+    if (stackTrace.frameCount > 1)
+        backtrace_symbols_fd(stackTrace.frames + 1, static_cast<int>(stackTrace.frameCount - 1), STDERR_FILENO);
+
+    if (auto callback = crashCallback.load(std::memory_order_acquire))
+        callback(signalNumber, stackTrace);
+
+    // Hand the signal back to whoever had it before (usually the default action, which ends the process), and raise
+    // it again. It's blocked until this handler returns, and a fault will just happen again anyway.
+    for (size_t i = 0; i < std::size(crashSignals); ++i)
+    {
+        if (crashSignals[i] == signalNumber)
+            sigaction(signalNumber, &previousCrashActions[i], nullptr);
+    }
+    raise(signalNumber);
+}
+
+void InstallCrashHandler(CrashCallback callback)
+{
+    crashCallback.store(callback, std::memory_order_release);
+
+    if (isCrashHandlerInstalled)
+        return;
+
+    // The first backtrace() loads the unwinder with dlopen(), which mustn't happen inside a signal handler
+    void* warmUpFrame;
+    backtrace(&warmUpFrame, 1);
+
+    auto alternateStack    = stack_t();
+    alternateStack.ss_sp   = crashHandlerStack;
+    alternateStack.ss_size = sizeof(crashHandlerStack);
+    sigaltstack(&alternateStack, nullptr);
+
+    struct sigaction action = {};
+    action.sa_sigaction     = OnCrashSignal;
+    action.sa_flags         = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+
+    for (size_t i = 0; i < std::size(crashSignals); ++i)
+        sigaction(crashSignals[i], &action, &previousCrashActions[i]);
+
+    isCrashHandlerInstalled = true;
+}
+
+void UninstallCrashHandler()
+{
+    if (!isCrashHandlerInstalled)
+        return;
+
+    for (size_t i = 0; i < std::size(crashSignals); ++i)
+        sigaction(crashSignals[i], &previousCrashActions[i], nullptr);
+
+    auto alternateStack     = stack_t();
+    alternateStack.ss_flags = SS_DISABLE;
+    sigaltstack(&alternateStack, nullptr);
+
+    crashCallback.store(nullptr, std::memory_order_release);
+    isCrashHandlerInstalled = false;
+}
+
+} // namespace Engine
@@ -0,0 +1,46 @@
+#include <Engine/Core/_platform/Linux/LinuxDynamicLibrary.h>
+
+#include <dlfcn.h>
+
+#include <iostream>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+namespace fs = std::filesystem;
+
+void LinuxDynamicLibrary::Load(const std::filesystem::path& libraryPath)
+{
+    // Copied first, since it may refer to this library's own path, which Unload() clears
+    const auto path = fs::path(libraryPath);
+    Unload();
+
+    // Binding everything up front reports missing symbols here rather than part way through a frame, and keeps the
+    // lazy binding trampolines off the first call of every function
+    libraryHandle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    if (!libraryHandle)
+        std::cerr << "Failed to load library " << path << "! " << dlerror() << "\n";
+    else
+        this->libraryPath = path;
+}
+
+void LinuxDynamicLibrary::Unload()
+{
+    if (libraryHandle)
+        dlclose(libraryHandle);
+
+    symbolCache.clear();
+    libraryPath.clear();
+    libraryHandle = nullptr;
+}
+
+void* LinuxDynamicLibrary::GetRawFunctionPtr(const std::string& functionName)
+{
+    void* functionPtr = dlsym(libraryHandle, functionName.c_str());
+    if (!functionPtr)
+        std::cerr << "Failed to get symbol " << functionName + "! " << dlerror() << "\n";
+
+    return functionPtr;
+}
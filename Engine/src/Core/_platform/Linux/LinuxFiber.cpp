@@ -0,0 +1,143 @@
+#include <Engine/Core/_platform/Linux/LinuxFiber.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+// ThreadSanitizer has to be told about every switch, or it mistakes the fiber's stack for the thread's and crashes
+#if defined(__SANITIZE_THREAD__)
+    #define ADHOC_THREAD_SANITIZER 1
+#elif defined(__has_feature)
+    #if __has_feature(thread_sanitizer)
+        #define ADHOC_THREAD_SANITIZER 1
+    #endif
+#endif
+
+#if ADHOC_THREAD_SANITIZER
+extern "C"
+{
+void* __tsan_get_current_fiber();
+void* __tsan_create_fiber(unsigned flags);
+void __tsan_destroy_fiber(void* fiber);
+void __tsan_switch_to_fiber(void* fiber, unsigned flags);
+}
+#endif
+
+LinuxFiber::~LinuxFiber()
+{
+    ReleaseStack();
+}
+
+void LinuxFiber::ReleaseStack()
+{
+    if (!stackMapping)
+        return;
+
+#if ADHOC_THREAD_SANITIZER
+    if (sanitizerFiber)
+        __tsan_destroy_fiber(sanitizerFiber);
+    sanitizerFiber = nullptr;
+#endif
+
+    munmap(stackMapping, stackMappingSize);
+    stackMapping     = nullptr;
+    stackMappingSize = 0;
+    isValid          = false;
+}
+
+bool LinuxFiber::Create(FiberFunction function, void* data, size_t stackSize)
+{
+    // Creating a fiber again replaces its stack, which nothing can still be running on
+    ReleaseStack();
+
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    stackSize           = (stackSize + pageSize - 1) / pageSize * pageSize;
+
+    // Stacks grow down, so the guard page goes at the bottom
+    stackMappingSize = stackSize + pageSize;
+    stackMapping     = mmap(nullptr, stackMappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (stackMapping == MAP_FAILED)
+    {
+        std::cerr << "Failed to allocate a fiber stack! " << std::strerror(errno) << "\n";
+        stackMapping = nullptr;
+        return false;
+    }
+    if (mprotect(stackMapping, pageSize, PROT_NONE) != 0)
+    {
+        std::cerr << "Failed to protect a fiber stack's guard page! " << std::strerror(errno) << "\n";
+        munmap(stackMapping, stackMappingSize);
+        stackMapping = nullptr;
+        return false;
+    }
+
+    this->function  = function;
+    this->data      = data;
+    this->stackSize = stackSize;
+
+    getcontext(&context);
+    context.uc_stack.ss_sp   = static_cast<std::byte*>(stackMapping) + pageSize;
+    context.uc_stack.ss_size = stackSize;
+    context.uc_link          = nullptr;
+
+    // makecontext() only passes ints along, so the fiber's address is split in two
+    const auto address = reinterpret_cast<uintptr_t>(this);
+    makecontext(&context,
+                reinterpret_cast<void (*)()>(&LinuxFiber::Start),
+                2,
+                static_cast<unsigned int>(static_cast<uint64_t>(address) >> 32),
+                static_cast<unsigned int>(address & 0xFFFFFFFFu));
+
+#if ADHOC_THREAD_SANITIZER
+    sanitizerFiber = __tsan_create_fiber(0);
+#endif
+
+    isValid = true;
+    return true;
+}
+
+bool LinuxFiber::ConvertCurrentThread()
+{
+    // The context is filled in by the first switch away from it
+#if ADHOC_THREAD_SANITIZER
+    sanitizerFiber = __tsan_get_current_fiber();
+#endif
+
+    isValid = true;
+    return true;
+}
+
+void LinuxFiber::ConvertBackToThread()
+{
+    isValid = false;
+}
+
+void LinuxFiber::SwitchFrom(LinuxFiber& currentFiber)
+{
+    // TODO: swapcontext() also saves and restores the signal mask, which costs a system call each way. A hand-written
+    // switch that only saves callee-saved registers would be an order of magnitude faster.
+#if ADHOC_THREAD_SANITIZER
+    __tsan_switch_to_fiber(sanitizerFiber, 0);
+#endif
+
+    swapcontext(&currentFiber.context, &context);
+}
+
+void LinuxFiber::Start(unsigned int dataHigh, unsigned int dataLow)
+{
+    const auto address = static_cast<uintptr_t>((static_cast<uint64_t>(dataHigh) << 32) | dataLow);
+    auto* fiber        = reinterpret_cast<LinuxFiber*>(address);
+
+    fiber->function(fiber->data);
+
+    std::cerr << "A fiber function returned!\n";
+    std::abort();
+}
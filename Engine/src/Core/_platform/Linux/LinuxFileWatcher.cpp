@@ -0,0 +1,126 @@
+#include <Engine/Core/_platform/Linux/LinuxFileWatcher.h>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+namespace fs = std::filesystem;
+
+bool LinuxFileWatcher::Start(const fs::path& path, ChangeCallback onChanged)
+{
+    Stop();
+
+    inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    stopDescriptor    = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (inotifyDescriptor == -1 || stopDescriptor == -1)
+    {
+        std::cerr << "Failed to create a file watcher! " << std::strerror(errno) << "\n";
+        Stop();
+        return false;
+    }
+
+    // Linkers usually write to a new file and rename it over the old one, which only shows up on the directory
+    const auto directory = path.has_parent_path() ? path.parent_path() : fs::path(".");
+    if (inotify_add_watch(inotifyDescriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) == -1)
+    {
+        std::cerr << "Failed to watch directory " << directory << "! " << std::strerror(errno) << "\n";
+        Stop();
+        return false;
+    }
+
+    watchedPath     = path;
+    this->onChanged = std::move(onChanged);
+    watchThread     = std::thread(&LinuxFileWatcher::WatchForChanges, this);
+    return true;
+}
+
+void LinuxFileWatcher::Stop()
+{
+    if (watchThread.joinable())
+    {
+        const auto wake = uint64_t(1);
+        [[maybe_unused]] const auto written = write(stopDescriptor, &wake, sizeof(wake));
+        watchThread.join();
+    }
+
+    if (inotifyDescriptor != -1)
+        close(inotifyDescriptor);
+    if (stopDescriptor != -1)
+        close(stopDescriptor);
+
+    inotifyDescriptor = -1;
+    stopDescriptor    = -1;
+    watchedPath.clear();
+    onChanged = nullptr;
+}
+
+void LinuxFileWatcher::WatchForChanges()
+{
+    const auto fileName = watchedPath.filename().string();
+
+    auto isChangePending = false;
+    auto lastChangeTime  = std::chrono::steady_clock::time_point();
+
+    while (true)
+    {
+        // Wait indefinitely until something changes, then only until the file has settled
+        auto timeoutMilliseconds = -1;
+        if (isChangePending)
+        {
+            const auto settledTime = lastChangeTime + settleTime;
+            const auto remaining   = std::chrono::ceil<std::chrono::milliseconds>(settledTime -
+                                                                                 std::chrono::steady_clock::now());
+            timeoutMilliseconds    = std::max(static_cast<int>(remaining.count()), 0);
+        }
+
+        pollfd descriptors[] = {{.fd = inotifyDescriptor, .events = POLLIN, .revents = 0},
+                                {.fd = stopDescriptor, .events = POLLIN, .revents = 0}};
+        const auto readyCount = poll(descriptors, 2, timeoutMilliseconds);
+        if (readyCount == -1 && errno != EINTR)
+        {
+            std::cerr << "Failed to wait for changes to " << watchedPath << "! " << std::strerror(errno) << "\n";
+            return;
+        }
+
+        if (descriptors[1].revents != 0)
+            return;
+
+        if (descriptors[0].revents != 0)
+        {
+            alignas(inotify_event) char buffer[4096];
+            ssize_t bytesRead;
+            while ((bytesRead = read(inotifyDescriptor, buffer, sizeof(buffer))) > 0)
+            {
+                for (auto offset = ssize_t(0); offset < bytesRead;)
+                {
+                    const auto& event = *reinterpret_cast<const inotify_event*>(buffer + offset);
+                    offset += static_cast<ssize_t>(sizeof(inotify_event) + event.len);
+
+                    if (event.len > 0 && std::string_view(event.name) == fileName)
+                    {
+                        isChangePending = true;
+                        lastChangeTime  = std::chrono::steady_clock::now();
+                    }
+                }
+            }
+        }
+        else if (isChangePending && std::chrono::steady_clock::now() >= lastChangeTime + settleTime)
+        {
+            isChangePending = false;
+            onChanged();
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include <Engine/Core/_platform/Linux/LinuxMappedFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+namespace fs = std::filesystem;
+
+bool LinuxMappedFile::Create(const fs::path& path, size_t size)
+{
+    Close(this->size);
+
+    fileDescriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fileDescriptor == -1)
+    {
+        std::cerr << "Failed to create file " << path << "! " << std::strerror(errno) << "\n";
+        return false;
+    }
+
+    // The file is sparse until written, so preallocating it doesn't cost any disk space up front
+    if (ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0)
+    {
+        std::cerr << "Failed to resize file " << path << "! " << std::strerror(errno) << "\n";
+        Close(0);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+        std::cerr << "Failed to map file " << path << "! " << std::strerror(errno) << "\n";
+        Close(0);
+        return false;
+    }
+
+    data       = static_cast<std::byte*>(mapping);
+    this->size = size;
+    return true;
+}
+
+void LinuxMappedFile::Close(size_t finalSize)
+{
+    if (data)
+        munmap(data, size);
+
+    if (fileDescriptor != -1)
+    {
+        if (ftruncate(fileDescriptor, static_cast<off_t>(std::min(finalSize, size))) != 0)
+            std::cerr << "Failed to shrink mapped file! " << std::strerror(errno) << "\n";
+
+        close(fileDescriptor);
+    }
+
+    data           = nullptr;
+    size           = 0;
+    fileDescriptor = -1;
+}
@@ -0,0 +1,129 @@
+#include <Engine/Core/_platform/Linux/LinuxMisc.h>
+
+#include <Engine/Core/MiscMacros.h>
+#include <Engine/Core/StackTrace.h>
+
+#include <pthread.h>
+#include <unwind.h>
+
+#include <cstdint>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+namespace Engine
+{
+
+#if defined(__x86_64__) || defined(__aarch64__)
+struct StackBounds
+{
+    uintptr_t low  = 0;
+    uintptr_t high = 0;
+};
+
+static thread_local StackBounds threadStackBounds;
+
+static const StackBounds& GetThreadStackBounds()
+{
+    if (threadStackBounds.high != 0)
+        return threadStackBounds;
+
+    auto attributes = pthread_attr_t();
+    if (pthread_getattr_np(pthread_self(), &attributes) == 0)
+    {
+        void* stackLow = nullptr;
+        auto stackSize = size_t(0);
+        if (pthread_attr_getstack(&attributes, &stackLow, &stackSize) == 0)
+        {
+            threadStackBounds.low  = reinterpret_cast<uintptr_t>(stackLow);
+            threadStackBounds.high = threadStackBounds.low + stackSize;
+        }
+        pthread_attr_destroy(&attributes);
+    }
+
+    return threadStackBounds;
+}
+#endif
+
+struct UnwindState
+{
+    StackTrace* stackTrace;
+    uint32_t framesToSkip;
+};
+
+static _Unwind_Reason_Code OnUnwindFrame(_Unwind_Context* context, void* userData)
+{
+    auto& state = *static_cast<UnwindState*>(userData);
+
+    if (state.framesToSkip > 0)
+    {
+        --state.framesToSkip;
+        return _URC_NO_REASON;
+    }
+
+    auto& stackTrace = *state.stackTrace;
+    if (stackTrace.frameCount == StackTrace::maxFrames)
+        return _URC_END_OF_STACK;
+
+    stackTrace.frames[stackTrace.frameCount++] = reinterpret_cast<void*>(_Unwind_GetIP(context));
+    return _URC_NO_REASON;
+}
+
+/// Unwinding with the frame tables works through code built without frame pointers, but has to interpret them for
+/// every frame, so it's a couple of orders of magnitude slower than walking frame pointers.
+NOINLINE static void CaptureWithUnwinder(StackTrace& stackTrace, uint32_t framesToSkip)
+{
+    // Skip this function and Capture()
+    auto state = UnwindState{.stackTrace = &stackTrace, .framesToSkip = framesToSkip + 2};
+    _Unwind_Backtrace(OnUnwindFrame, &state);
+}
+
+NOINLINE StackTrace StackTrace::Capture(uint32_t framesToSkip)
+{
+    auto stackTrace = StackTrace();
+
+#if defined(__x86_64__) || defined(__aarch64__)
+    const auto& stackBounds = GetThreadStackBounds();
+    if (stackBounds.high == 0)
+    {
+        CaptureWithUnwinder(stackTrace, framesToSkip);
+        return stackTrace;
+    }
+
+    // Both ABIs keep a {previous frame pointer, return address} record at the frame pointer. The Engine is built with
+    // frame pointers, but code that isn't may leave anything in the frame pointer register, so every record has to be
+    // inside this thread's stack and further out than the last one before it's read.
+    auto* frameRecord = static_cast<void**>(__builtin_frame_address(0));
+    while (stackTrace.frameCount < maxFrames)
+    {
+        const auto recordAddress = reinterpret_cast<uintptr_t>(frameRecord);
+        if (recordAddress < stackBounds.low || recordAddress + 2 * sizeof(void*) > stackBounds.high ||
+            recordAddress % sizeof(void*) != 0)
+        {
+            break;
+        }
+
+        void* returnAddress = frameRecord[1];
+        if (!returnAddress)
+            break;
+
+        if (framesToSkip > 0)
+            --framesToSkip;
+        else
+            stackTrace.frames[stackTrace.frameCount++] = returnAddress;
+
+        auto* nextFrameRecord = static_cast<void**>(frameRecord[0]);
+        if (nextFrameRecord <= frameRecord)
+            break;
+
+        frameRecord = nextFrameRecord;
+    }
+#else
+    CaptureWithUnwinder(stackTrace, framesToSkip);
+#endif
+
+    return stackTrace;
+}
+
+} // namespace Engine
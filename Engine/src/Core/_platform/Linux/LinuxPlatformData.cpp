@@ -0,0 +1,88 @@
+#include <Engine/Core/_platform/Linux/LinuxPlatformData.h>
+
+#include <Engine/Core/Console.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+#endif
+
+#include <chrono>
+#include <thread>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+namespace Engine
+{
+
+#if defined(__x86_64__) || defined(__i386__)
+static bool IsTimestampCounterInvariant()
+{
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8)) != 0;
+}
+
+/// Newer CPUs report the timestamp counter's frequency directly, relative to their crystal clock.
+static uint64_t GetReportedTimestampCounterFrequency()
+{
+    unsigned int denominator, numerator, crystalFrequency, edx;
+    if (!__get_cpuid(0x15, &denominator, &numerator, &crystalFrequency, &edx) || denominator == 0 ||
+        numerator == 0 || crystalFrequency == 0)
+    {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(crystalFrequency) * numerator / denominator;
+}
+
+static uint64_t MeasureTimestampCounterFrequency()
+{
+    const auto startNanoseconds = GetMonotonicRawNanoseconds();
+    const auto startTicks       = ReadTimestampCounter();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    const auto endTicks       = ReadTimestampCounter();
+    const auto endNanoseconds = GetMonotonicRawNanoseconds();
+
+    return static_cast<uint64_t>(static_cast<double>(endTicks - startTicks) * 1e9 /
+                                 static_cast<double>(endNanoseconds - startNanoseconds));
+}
+#endif
+
+LinuxPlatformData& GetMutablePlatformData()
+{
+    static LinuxPlatformData instance;
+    return instance;
+}
+
+void InitializePlatformData()
+{
+    auto& data = GetMutablePlatformData();
+
+#if defined(__x86_64__) || defined(__i386__)
+    Console::Log("Calibrating timestamp counter...");
+
+    data.isTimestampCounterInvariant = IsTimestampCounterInvariant();
+    if (!data.isTimestampCounterInvariant)
+        Console::LogWarning("The timestamp counter isn't invariant! Timings taken with it will drift.");
+
+    data.timestampCounterFrequency = GetReportedTimestampCounterFrequency();
+    if (data.timestampCounterFrequency == 0)
+        data.timestampCounterFrequency = MeasureTimestampCounterFrequency();
+
+    Console::Log("Timestamp counter frequency: {} Hz", data.timestampCounterFrequency);
+#else
+    // ReadTimestampCounter() falls back to the monotonic clock, which is already in nanoseconds
+    data.isTimestampCounterInvariant = true;
+    data.timestampCounterFrequency   = 1000000000;
+#endif
+}
+
+const LinuxPlatformData& LinuxPlatformData::GetInstance()
+{
+    return GetMutablePlatformData();
+}
+
+} // namespace Engine
@@ -0,0 +1,74 @@
+#include <Engine/Core/_platform/Linux/LinuxVirtualMemory.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif // !ADHOC_LINUX
+
+static size_t RoundUpToPageSize(size_t size)
+{
+    static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+bool LinuxVirtualMemory::Reserve(size_t size)
+{
+    Release();
+
+    size          = RoundUpToPageSize(size);
+    void* mapping = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        std::cerr << "Failed to reserve " << size << " bytes of address space! " << std::strerror(errno) << "\n";
+        return false;
+    }
+
+    data         = static_cast<std::byte*>(mapping);
+    reservedSize = size;
+    return true;
+}
+
+bool LinuxVirtualMemory::Commit(size_t size)
+{
+    size = RoundUpToPageSize(size);
+    if (size <= committedSize)
+        return true;
+    if (size > reservedSize)
+        return false;
+
+    if (mprotect(data + committedSize, size - committedSize, PROT_READ | PROT_WRITE) != 0)
+    {
+        std::cerr << "Failed to commit " << size << " bytes! " << std::strerror(errno) << "\n";
+        return false;
+    }
+
+    committedSize = size;
+    return true;
+}
+
+void LinuxVirtualMemory::Decommit(size_t size)
+{
+    size = RoundUpToPageSize(size);
+    if (size >= committedSize)
+        return;
+
+    // Mapping fresh pages over the old ones drops them, and they come back zeroed if they're committed again
+    mmap(data + size, committedSize - size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+    committedSize = size;
+}
+
+void LinuxVirtualMemory::Release()
+{
+    if (data)
+        munmap(data, reservedSize);
+
+    data          = nullptr;
+    reservedSize  = 0;
+    committedSize = 0;
+}
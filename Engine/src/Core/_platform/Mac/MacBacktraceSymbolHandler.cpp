@@ -0,0 +1,50 @@
+#include <Engine/Core/_platform/Mac/MacBacktraceSymbolHandler.h>
+
+#include <cxxabi.h>
+#include <dlfcn.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#if !ADHOC_MACOS
+static_assert(false);
+#endif
+
+namespace fs = std::filesystem;
+
+namespace Engine
+{
+
+SymbolInfo MacBacktraceSymbolHandler::LookupSymbol(void* address)
+{
+    auto symbol = SymbolInfo();
+
+    // Return addresses point just past their call, which can be the start of the next function if the call was the
+    // last instruction of a noreturn one
+    const auto callAddress = reinterpret_cast<uintptr_t>(address) - 1;
+
+    auto info = Dl_info();
+    if (dladdr(reinterpret_cast<void*>(callAddress), &info) == 0 || !info.dli_fname)
+        return symbol;
+
+    // TODO: File and line information from the dSYM, through CoreSymbolication or atos
+    symbol.module = fs::path(info.dli_fname).filename().string();
+    if (!info.dli_sname)
+    {
+        symbol.offset = callAddress + 1 - reinterpret_cast<uintptr_t>(info.dli_fbase);
+        return symbol;
+    }
+
+    int demangleStatus    = 0;
+    char* demangledSymbol = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &demangleStatus);
+
+    symbol.function = demangleStatus == 0 ? demangledSymbol : info.dli_sname;
+    symbol.offset   = callAddress + 1 - reinterpret_cast<uintptr_t>(info.dli_saddr);
+
+    free(demangledSymbol);
+    return symbol;
+}
+
+} // namespace Engine
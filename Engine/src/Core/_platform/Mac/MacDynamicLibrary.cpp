@@ -12,12 +12,16 @@ namespace fs = std::filesystem;
 
 void MacDynamicLibrary::Load(const std::filesystem::path& libraryPath)
 {
-    libraryHandle = dlopen(libraryPath.c_str(), RTLD_LAZY | RTLD_LOCAL | RTLD_FIRST);
+    // Copied first, since it may refer to this library's own path, which Unload() clears
+    const auto path = fs::path(libraryPath);
+    Unload();
+
+    libraryHandle = dlopen(path.c_str(), RTLD_LAZY | RTLD_LOCAL | RTLD_FIRST);
 
     if (!libraryHandle)
-        std::cerr << "Failed to load library " << libraryPath << "! " << dlerror() << "\n";
+        std::cerr << "Failed to load library " << path << "! " << dlerror() << "\n";
     else
-        this->libraryPath = libraryPath;
+        this->libraryPath = path;
 }
 
 void MacDynamicLibrary::Unload()
@@ -25,18 +29,13 @@ void MacDynamicLibrary::Unload()
     if (libraryHandle)
         dlclose(libraryHandle);
 
+    symbolCache.clear();
     libraryPath.clear();
     libraryHandle = nullptr;
 }
 
 void* MacDynamicLibrary::GetRawFunctionPtr(const std::string& functionName)
 {
-    if (!libraryHandle)
-    {
-        std::cerr << "Attempted to load symbol " << functionName + " on an invalid DynamicLibrary!\n";
-        return nullptr;
-    }
-
     void* functionPtr = dlsym(libraryHandle, functionName.c_str());
     if (!functionPtr)
         std::cerr << "Failed to get symbol " << functionName + "! " << dlerror() << "\n";
@@ -0,0 +1,120 @@
+// The ucontext functions are deprecated on macOS, and hidden unless this is defined before anything is included
+#define _XOPEN_SOURCE 600
+#define _DARWIN_C_SOURCE
+
+#include <Engine/Core/_platform/Mac/MacFiber.h>
+
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#if !ADHOC_MACOS
+static_assert(false);
+#endif
+
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+
+struct MacFiberContext
+{
+    ucontext_t context = {};
+};
+
+MacFiber::MacFiber() : context(std::make_unique<MacFiberContext>()) {}
+
+MacFiber::~MacFiber()
+{
+    ReleaseStack();
+}
+
+void MacFiber::ReleaseStack()
+{
+    if (!stackMapping)
+        return;
+
+    munmap(stackMapping, stackMappingSize);
+    stackMapping     = nullptr;
+    stackMappingSize = 0;
+    isValid          = false;
+}
+
+bool MacFiber::Create(FiberFunction function, void* data, size_t stackSize)
+{
+    // Creating a fiber again replaces its stack, which nothing can still be running on
+    ReleaseStack();
+
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    stackSize           = (stackSize + pageSize - 1) / pageSize * pageSize;
+
+    // Stacks grow down, so the guard page goes at the bottom
+    stackMappingSize = stackSize + pageSize;
+    stackMapping     = mmap(nullptr, stackMappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    if (stackMapping == MAP_FAILED)
+    {
+        std::cerr << "Failed to allocate a fiber stack! " << std::strerror(errno) << "\n";
+        stackMapping = nullptr;
+        return false;
+    }
+    if (mprotect(stackMapping, pageSize, PROT_NONE) != 0)
+    {
+        std::cerr << "Failed to protect a fiber stack's guard page! " << std::strerror(errno) << "\n";
+        munmap(stackMapping, stackMappingSize);
+        stackMapping = nullptr;
+        return false;
+    }
+
+    this->function  = function;
+    this->data      = data;
+    this->stackSize = stackSize;
+
+    auto& fiberContext = context->context;
+    getcontext(&fiberContext);
+    fiberContext.uc_stack.ss_sp   = static_cast<std::byte*>(stackMapping) + pageSize;
+    fiberContext.uc_stack.ss_size = stackSize;
+    fiberContext.uc_link          = nullptr;
+
+    // makecontext() only passes ints along, so the fiber's address is split in two
+    const auto address = reinterpret_cast<uintptr_t>(this);
+    makecontext(&fiberContext,
+                reinterpret_cast<void (*)()>(&MacFiber::Start),
+                2,
+                static_cast<unsigned int>(static_cast<uint64_t>(address) >> 32),
+                static_cast<unsigned int>(address & 0xFFFFFFFFu));
+
+    isValid = true;
+    return true;
+}
+
+bool MacFiber::ConvertCurrentThread()
+{
+    // The context is filled in by the first switch away from it
+    isValid = true;
+    return true;
+}
+
+void MacFiber::ConvertBackToThread()
+{
+    isValid = false;
+}
+
+void MacFiber::SwitchFrom(MacFiber& currentFiber)
+{
+    // TODO: Deprecated, and slow since it saves and restores the signal mask too. Replace with a hand-written switch.
+    swapcontext(&currentFiber.context->context, &context->context);
+}
+
+void MacFiber::Start(unsigned int dataHigh, unsigned int dataLow)
+{
+    const auto address = static_cast<uintptr_t>((static_cast<uint64_t>(dataHigh) << 32) | dataLow);
+    auto* fiber        = reinterpret_cast<MacFiber*>(address);
+
+    fiber->function(fiber->data);
+
+    std::cerr << "A fiber function returned!\n";
+    std::abort();
+}
@@ -0,0 +1,69 @@
+#include <Engine/Core/_platform/Mac/MacFileWatcher.h>
+
+#include <chrono>
+#include <system_error>
+
+#if !ADHOC_MACOS
+static_assert(false);
+#endif // !ADHOC_MACOS
+
+namespace fs = std::filesystem;
+
+// TODO: Use FSEvents instead of polling
+static constexpr auto pollInterval = std::chrono::milliseconds(50);
+
+bool MacFileWatcher::Start(const fs::path& path, ChangeCallback onChanged)
+{
+    Stop();
+
+    watchedPath     = path;
+    this->onChanged = std::move(onChanged);
+    isStopRequested = false;
+    watchThread     = std::thread(&MacFileWatcher::WatchForChanges, this);
+    return true;
+}
+
+void MacFileWatcher::Stop()
+{
+    if (watchThread.joinable())
+    {
+        {
+            const auto lock = std::lock_guard(stopMutex);
+            isStopRequested = true;
+        }
+        stopCondition.notify_one();
+        watchThread.join();
+    }
+
+    watchedPath.clear();
+    onChanged = nullptr;
+}
+
+void MacFileWatcher::WatchForChanges()
+{
+    auto error           = std::error_code();
+    auto lastWriteTime   = fs::last_write_time(watchedPath, error);
+    auto isChangePending = false;
+    auto lastChangeTime  = std::chrono::steady_clock::time_point();
+
+    auto lock = std::unique_lock(stopMutex);
+    while (!stopCondition.wait_for(lock, pollInterval, [this] { return isStopRequested; }))
+    {
+        // A missing file reads as the minimum time, so it's picked up once it's created
+        const auto writeTime = fs::last_write_time(watchedPath, error);
+        if (writeTime != lastWriteTime)
+        {
+            lastWriteTime   = writeTime;
+            isChangePending = true;
+            lastChangeTime  = std::chrono::steady_clock::now();
+        }
+        else if (isChangePending && std::chrono::steady_clock::now() >= lastChangeTime + settleTime)
+        {
+            isChangePending = false;
+
+            lock.unlock();
+            onChanged();
+            lock.lock();
+        }
+    }
+}
@@ -1,13 +1,11 @@
 #include <Engine/Core/_platform/Mac/MacMisc.h>
 
-#include <Engine/Core/Console.h>
-
-#include <fmt/format.h>
+#include <Engine/Core/MiscMacros.h>
+#include <Engine/Core/StackTrace.h>
 
 #include <execinfo.h>
 
-#include <sstream>
-#include <string>
+#include <algorithm>
 
 #if !ADHOC_MACOS
 static_assert(false);
@@ -16,29 +14,20 @@ static_assert(false);
 namespace Engine
 {
 
-std::string GetBacktrace()
+NOINLINE StackTrace StackTrace::Capture(uint32_t framesToSkip)
 {
-    const int maxFrames = 64;
-    void* callstack[maxFrames];
-
-    auto frames  = backtrace(callstack, maxFrames);
-    auto symbols = backtrace_symbols(callstack, frames);
-
-    if (!symbols)
-    {
-        Console::LogError("Failed to retrieve stack trace symbols.");
-        return std::string();
-    }
+    // The platform ABI always keeps frame pointers, so backtrace() is a cheap walk of them rather than an unwind. Its
+    // first frame is this function.
+    framesToSkip = std::min<uint32_t>(framesToSkip + 1, 32);
 
-    auto output = std::ostringstream();
-    for (int i = 0; i < frames; ++i)
-    {
-        output << fmt::format("{}\n", symbols[i]);
-    }
+    void* callStack[maxFrames + 32];
+    const auto frames = backtrace(callStack, static_cast<int>(maxFrames + framesToSkip));
 
-    free(symbols);
+    auto stackTrace = StackTrace();
+    for (auto i = static_cast<int>(framesToSkip); i < frames; ++i)
+        stackTrace.frames[stackTrace.frameCount++] = callStack[i];
 
-    return output.str();
+    return stackTrace;
 }
 
 } // namespace Engine
@@ -8,6 +8,7 @@
 #include <windows.h>
 
 #include <filesystem>
+#include <string>
 
 #if !ADHOC_WINDOWS
 static_assert(false);
@@ -21,11 +22,21 @@ namespace Engine
 {
 
 WindowsBacktraceSymbolHandler::WindowsBacktraceSymbolHandler()
+{
+    // Loading every module's symbols takes long enough to show up in startup times, and nothing needs them until the
+    // first backtrace
+    StartLoadingSymbols();
+}
+
+void WindowsBacktraceSymbolHandler::LoadSymbols()
 {
     const auto& platformData = Engine::PlatformData::GetInstance();
 
     Console::Log("Initializing symbol handler...");
 
+    // Line numbers are needed for file and line information in SymbolInfo
+    SymSetOptions(SymGetOptions() | SYMOPT_LOAD_LINES | SYMOPT_UNDNAME);
+
     isValid = SymInitialize(platformData.processHandle, NULL, TRUE);
 
     if (!isValid)
@@ -37,6 +48,8 @@ WindowsBacktraceSymbolHandler::WindowsBacktraceSymbolHandler()
 
 WindowsBacktraceSymbolHandler::~WindowsBacktraceSymbolHandler()
 {
+    WaitForSymbols();
+
     const auto& platformData = Engine::PlatformData::GetInstance();
 
     Console::Log("Cleaning up symbol handler...");
@@ -47,4 +60,45 @@ WindowsBacktraceSymbolHandler::~WindowsBacktraceSymbolHandler()
     }
 }
 
+SymbolInfo WindowsBacktraceSymbolHandler::LookupSymbol(void* address)
+{
+    auto symbol = SymbolInfo();
+    if (!isValid)
+        return symbol;
+
+    const auto& platformData = Engine::PlatformData::GetInstance();
+
+    // Return addresses point just past their call, which can be the start of the next function if the call was the
+    // last instruction of a noreturn one
+    const auto callAddress = reinterpret_cast<DWORD64>(address) - 1;
+
+    auto module         = IMAGEHLP_MODULE64();
+    module.SizeOfStruct = sizeof(module);
+    if (SymGetModuleInfo64(platformData.processHandle, callAddress, &module))
+        symbol.module = module.ModuleName;
+
+    alignas(SYMBOL_INFO) char symbolBuffer[sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(char)];
+    auto symbolInfo          = reinterpret_cast<SYMBOL_INFO*>(symbolBuffer);
+    symbolInfo->SizeOfStruct = sizeof(SYMBOL_INFO);
+    symbolInfo->MaxNameLen   = MAX_SYM_NAME;
+
+    auto displacement = DWORD64(0);
+    if (!SymFromAddr(platformData.processHandle, callAddress, &displacement, symbolInfo))
+        return symbol;
+
+    symbol.function = symbolInfo->Name;
+    symbol.offset   = static_cast<uintptr_t>(displacement + 1);
+
+    auto lineDisplacement = DWORD(0);
+    auto line             = IMAGEHLP_LINE64();
+    line.SizeOfStruct     = sizeof(line);
+    if (SymGetLineFromAddr64(platformData.processHandle, callAddress, &lineDisplacement, &line))
+    {
+        symbol.file = line.FileName;
+        symbol.line = line.LineNumber;
+    }
+
+    return symbol;
+}
+
 } // namespace Engine
@@ -0,0 +1,121 @@
+#include <Engine/Core/CrashHandler.h>
+
+#include <windows.h>
+
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#if !ADHOC_WINDOWS
+static_assert(false);
+#endif
+
+namespace Engine
+{
+
+static constexpr int crashSignals[] = {SIGSEGV, SIGFPE, SIGILL, SIGABRT};
+
+static _crt_signal_t previousCrashHandlers[std::size(crashSignals)];
+static LPTOP_LEVEL_EXCEPTION_FILTER previousExceptionFilter = NULL;
+static std::atomic<CrashCallback> crashCallback             = nullptr;
+static bool isCrashHandlerInstalled                         = false;
+
+static const char* GetSignalName(int signalNumber)
+{
+    switch (signalNumber)
+    {
+    case SIGSEGV: return "SIGSEGV";
+    case SIGFPE: return "SIGFPE";
+    case SIGILL: return "SIGILL";
+    case SIGABRT: return "SIGABRT";
+    default: return "unknown signal";
+    }
+}
+
+/// fmt and stdio may allocate or lock, neither of which is safe while crashing.
+static void WriteToStderr(const char* text)
+{
+    auto bytesWritten = DWORD(0);
+    WriteFile(GetStdHandle(STD_ERROR_HANDLE), text, static_cast<DWORD>(strlen(text)), &bytesWritten, NULL);
+}
+
+static void WriteAddressToStderr(const void* address)
+{
+    char line[2 + 2 * sizeof(uintptr_t) + 2] = "0x";
+
+    auto value = reinterpret_cast<uintptr_t>(address);
+    for (int digit = 2 * sizeof(uintptr_t) - 1; digit >= 0; --digit)
+    {
+        line[2 + digit] = "0123456789abcdef"[value & 0xf];
+        value >>= 4;
+    }
+    line[2 + 2 * sizeof(uintptr_t)] = '\n';
+
+    WriteToStderr(line);
+}
+
+static void ReportCrash(int signalNumber, const char* description)
+{
+    // Skip this function
+    const auto stackTrace = StackTrace::Capture(1);
+
+    WriteToStderr("Fatal error ");
+    WriteToStderr(description);
+    WriteToStderr("! Stack:\n");
+    for (const auto* frame : stackTrace.GetFrames())
+        WriteAddressToStderr(frame);
+
+    if (auto callback = crashCallback.load(std::memory_order_acquire))
+        callback(signalNumber, stackTrace);
+}
+
+static LONG WINAPI OnUnhandledException(EXCEPTION_POINTERS* exceptionPointers)
+{
+    ReportCrash(SIGSEGV, "unhandled exception");
+
+    if (previousExceptionFilter)
+        return previousExceptionFilter(exceptionPointers);
+
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+
+static void __cdecl OnCrashSignal(int signalNumber)
+{
+    ReportCrash(signalNumber, GetSignalName(signalNumber));
+
+    // The CRT has already reset the handler to SIG_DFL, so this ends the process the way it would have anyway
+    raise(signalNumber);
+}
+
+void InstallCrashHandler(CrashCallback callback)
+{
+    crashCallback.store(callback, std::memory_order_release);
+
+    if (isCrashHandlerInstalled)
+        return;
+
+    previousExceptionFilter = SetUnhandledExceptionFilter(OnUnhandledException);
+
+    for (size_t i = 0; i < std::size(crashSignals); ++i)
+        previousCrashHandlers[i] = signal(crashSignals[i], OnCrashSignal);
+
+    isCrashHandlerInstalled = true;
+}
+
+void UninstallCrashHandler()
+{
+    if (!isCrashHandlerInstalled)
+        return;
+
+    SetUnhandledExceptionFilter(previousExceptionFilter);
+
+    for (size_t i = 0; i < std::size(crashSignals); ++i)
+        signal(crashSignals[i], previousCrashHandlers[i]);
+
+    crashCallback.store(nullptr, std::memory_order_release);
+    isCrashHandlerInstalled = false;
+}
+
+} // namespace Engine
@@ -15,12 +15,16 @@ namespace fs = std::filesystem;
 
 void WindowsDynamicLibrary::Load(const fs::path& libraryPath)
 {
-    libraryHandle = LoadLibraryEx(libraryPath.wstring().c_str(), NULL, LOAD_WITH_ALTERED_SEARCH_PATH);
+    // Copied first, since it may refer to this library's own path, which Unload() clears
+    const auto path = fs::path(libraryPath);
+    Unload();
+
+    libraryHandle = LoadLibraryEx(path.wstring().c_str(), NULL, LOAD_WITH_ALTERED_SEARCH_PATH);
 
     if (libraryHandle == NULL)
-        std::cerr << "Failed to load library " << libraryPath << "! " << Windows::GetLastErrorMessage() << "\n";
+        std::cerr << "Failed to load library " << path << "! " << Windows::GetLastErrorMessage() << "\n";
     else
-        this->libraryPath = libraryPath;
+        this->libraryPath = path;
 }
 
 void WindowsDynamicLibrary::Unload()
@@ -28,18 +32,13 @@ void WindowsDynamicLibrary::Unload()
     if (libraryHandle != NULL)
         FreeLibrary(libraryHandle);
 
+    symbolCache.clear();
     libraryPath.clear();
     libraryHandle = NULL;
 }
 
 void* WindowsDynamicLibrary::GetRawFunctionPtr(const std::string& functionName)
 {
-    if (libraryHandle == NULL)
-    {
-        std::cerr << "Attempted to load symbol " << functionName + " on an invalid DynamicLibrary!\n";
-        return nullptr;
-    }
-
     auto functionPtr = GetProcAddress(libraryHandle, functionName.c_str());
     if (functionPtr == NULL)
         std::cerr << "Failed to get symbol " << functionName + "! " << Windows::GetLastErrorMessage() << "\n";
@@ -0,0 +1,70 @@
+#include <Engine/Core/_platform/Windows/WindowsFiber.h>
+
+#include <Engine/Core/PlatformHelpers.h>
+
+#include <windows.h>
+
+#include <cstdlib>
+#include <iostream>
+
+#if !ADHOC_WINDOWS
+static_assert(false);
+#endif
+
+WindowsFiber::~WindowsFiber()
+{
+    if (fiberHandle && !isConvertedThread)
+        DeleteFiber(fiberHandle);
+}
+
+bool WindowsFiber::Create(FiberFunction function, void* data, size_t stackSize)
+{
+    this->function  = function;
+    this->data      = data;
+    this->stackSize = stackSize;
+
+    // stackSize is only reserved. Pages are committed as the stack grows into the guard page below them
+    fiberHandle = CreateFiberEx(0, stackSize, FIBER_FLAG_FLOAT_SWITCH, &WindowsFiber::Start, this);
+    if (!fiberHandle)
+    {
+        std::cerr << "CreateFiberEx() failed! " << Windows::GetLastErrorMessage() << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool WindowsFiber::ConvertCurrentThread()
+{
+    fiberHandle = ConvertThreadToFiberEx(nullptr, FIBER_FLAG_FLOAT_SWITCH);
+    if (!fiberHandle)
+    {
+        std::cerr << "ConvertThreadToFiberEx() failed! " << Windows::GetLastErrorMessage() << "\n";
+        return false;
+    }
+
+    isConvertedThread = true;
+    return true;
+}
+
+void WindowsFiber::ConvertBackToThread()
+{
+    ConvertFiberToThread();
+    fiberHandle       = nullptr;
+    isConvertedThread = false;
+}
+
+void WindowsFiber::SwitchFrom(WindowsFiber&)
+{
+    SwitchToFiber(fiberHandle);
+}
+
+void __stdcall WindowsFiber::Start(void* fiber)
+{
+    auto& windowsFiber = *static_cast<WindowsFiber*>(fiber);
+
+    windowsFiber.function(windowsFiber.data);
+
+    std::cerr << "A fiber function returned!\n";
+    std::abort();
+}
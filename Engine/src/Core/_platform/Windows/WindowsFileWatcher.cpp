@@ -0,0 +1,114 @@
+#include <Engine/Core/_platform/Windows/WindowsFileWatcher.h>
+
+#include <Engine/Core/PlatformHelpers.h>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <system_error>
+
+#if !ADHOC_WINDOWS
+static_assert(false);
+#endif
+
+namespace fs = std::filesystem;
+
+bool WindowsFileWatcher::Start(const fs::path& path, ChangeCallback onChanged)
+{
+    Stop();
+
+    // Change notifications only say that something in the directory changed, so the file's write time tells whether
+    // it was this one
+    const auto directory = path.has_parent_path() ? path.parent_path() : fs::path(L".");
+    changeNotification   = FindFirstChangeNotificationW(directory.wstring().c_str(),
+                                                      FALSE,
+                                                      FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE);
+    stopEvent            = CreateEventW(NULL, TRUE, FALSE, NULL);
+    if (changeNotification == INVALID_HANDLE_VALUE || stopEvent == NULL)
+    {
+        std::cerr << "Failed to watch directory " << directory << "! " << Windows::GetLastErrorMessage() << "\n";
+        Stop();
+        return false;
+    }
+
+    watchedPath     = path;
+    this->onChanged = std::move(onChanged);
+    watchThread     = std::thread(&WindowsFileWatcher::WatchForChanges, this);
+    return true;
+}
+
+void WindowsFileWatcher::Stop()
+{
+    if (watchThread.joinable())
+    {
+        SetEvent(stopEvent);
+        watchThread.join();
+    }
+
+    if (changeNotification != INVALID_HANDLE_VALUE)
+        FindCloseChangeNotification(changeNotification);
+    if (stopEvent != NULL)
+        CloseHandle(stopEvent);
+
+    changeNotification = INVALID_HANDLE_VALUE;
+    stopEvent          = NULL;
+    watchedPath.clear();
+    onChanged = nullptr;
+}
+
+void WindowsFileWatcher::WatchForChanges()
+{
+    auto error           = std::error_code();
+    auto lastWriteTime   = fs::last_write_time(watchedPath, error);
+    auto isChangePending = false;
+    auto lastChangeTime  = std::chrono::steady_clock::time_point();
+
+    while (true)
+    {
+        // Wait indefinitely until something changes, then only until the file has settled
+        auto timeoutMilliseconds = INFINITE;
+        if (isChangePending)
+        {
+            const auto settledTime = lastChangeTime + settleTime;
+            const auto remaining   = std::chrono::ceil<std::chrono::milliseconds>(settledTime -
+                                                                                 std::chrono::steady_clock::now());
+            timeoutMilliseconds    = static_cast<DWORD>(std::max(remaining.count(), 0ll));
+        }
+
+        const HANDLE handles[] = {changeNotification, stopEvent};
+        const auto waitResult  = WaitForMultipleObjects(2, handles, FALSE, timeoutMilliseconds);
+
+        if (waitResult == WAIT_OBJECT_0)
+        {
+            const auto writeTime = fs::last_write_time(watchedPath, error);
+            if (writeTime != lastWriteTime)
+            {
+                lastWriteTime   = writeTime;
+                isChangePending = true;
+                lastChangeTime  = std::chrono::steady_clock::now();
+            }
+
+            if (!FindNextChangeNotification(changeNotification))
+            {
+                std::cerr << "Failed to wait for changes to " << watchedPath << "! "
+                          << Windows::GetLastErrorMessage() << "\n";
+                return;
+            }
+        }
+        else if (waitResult == WAIT_TIMEOUT)
+        {
+            if (isChangePending && std::chrono::steady_clock::now() >= lastChangeTime + settleTime)
+            {
+                isChangePending = false;
+                onChanged();
+            }
+        }
+        else
+        {
+            // The stop event, or a failed wait
+            return;
+        }
+    }
+}
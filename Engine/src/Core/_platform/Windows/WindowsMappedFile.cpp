@@ -0,0 +1,83 @@
+#include <Engine/Core/_platform/Windows/WindowsMappedFile.h>
+
+#include <Engine/Core/PlatformHelpers.h>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <iostream>
+
+#if !ADHOC_WINDOWS
+static_assert(false);
+#endif
+
+namespace fs = std::filesystem;
+
+static bool SetFileSize(HANDLE fileHandle, size_t size)
+{
+    auto distance     = LARGE_INTEGER();
+    distance.QuadPart = static_cast<LONGLONG>(size);
+
+    return SetFilePointerEx(fileHandle, distance, NULL, FILE_BEGIN) && SetEndOfFile(fileHandle);
+}
+
+bool WindowsMappedFile::Create(const fs::path& path, size_t size)
+{
+    Close(this->size);
+
+    fileHandle = CreateFileW(path.wstring().c_str(),
+                             GENERIC_READ | GENERIC_WRITE,
+                             FILE_SHARE_READ | FILE_SHARE_DELETE,
+                             NULL,
+                             CREATE_ALWAYS,
+                             FILE_ATTRIBUTE_NORMAL,
+                             NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        std::cerr << "Failed to create file " << path << "! " << Windows::GetLastErrorMessage() << "\n";
+        return false;
+    }
+
+    if (!SetFileSize(fileHandle, size))
+    {
+        std::cerr << "Failed to resize file " << path << "! " << Windows::GetLastErrorMessage() << "\n";
+        Close(0);
+        return false;
+    }
+
+    mappingHandle = CreateFileMappingW(fileHandle, NULL, PAGE_READWRITE, 0, 0, NULL);
+    void* mapping = mappingHandle != NULL ? MapViewOfFile(mappingHandle, FILE_MAP_WRITE, 0, 0, size) : NULL;
+    if (mapping == NULL)
+    {
+        std::cerr << "Failed to map file " << path << "! " << Windows::GetLastErrorMessage() << "\n";
+        Close(0);
+        return false;
+    }
+
+    data       = static_cast<std::byte*>(mapping);
+    this->size = size;
+    return true;
+}
+
+void WindowsMappedFile::Close(size_t finalSize)
+{
+    if (data)
+        UnmapViewOfFile(data);
+
+    if (mappingHandle != NULL)
+        CloseHandle(mappingHandle);
+
+    // The file can only be shrunk once nothing maps it
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        if (!SetFileSize(fileHandle, std::min(finalSize, size)))
+            std::cerr << "Failed to shrink mapped file! " << Windows::GetLastErrorMessage() << "\n";
+
+        CloseHandle(fileHandle);
+    }
+
+    data          = nullptr;
+    size          = 0;
+    mappingHandle = NULL;
+    fileHandle    = INVALID_HANDLE_VALUE;
+}
@@ -0,0 +1,79 @@
+#include <Engine/Core/_platform/Windows/WindowsVirtualMemory.h>
+
+#include <Engine/Core/PlatformHelpers.h>
+
+#include <windows.h>
+
+#include <iostream>
+
+#if !ADHOC_WINDOWS
+static_assert(false);
+#endif
+
+static size_t RoundUpToPageSize(size_t size)
+{
+    static const auto pageSize = []
+    {
+        auto systemInfo = SYSTEM_INFO();
+        GetSystemInfo(&systemInfo);
+        return static_cast<size_t>(systemInfo.dwPageSize);
+    }();
+
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+bool WindowsVirtualMemory::Reserve(size_t size)
+{
+    Release();
+
+    size          = RoundUpToPageSize(size);
+    void* mapping = VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+    if (mapping == NULL)
+    {
+        std::cerr << "Failed to reserve " << size << " bytes of address space! " << Windows::GetLastErrorMessage()
+                  << "\n";
+        return false;
+    }
+
+    data         = static_cast<std::byte*>(mapping);
+    reservedSize = size;
+    return true;
+}
+
+bool WindowsVirtualMemory::Commit(size_t size)
+{
+    size = RoundUpToPageSize(size);
+    if (size <= committedSize)
+        return true;
+    if (size > reservedSize)
+        return false;
+
+    if (VirtualAlloc(data + committedSize, size - committedSize, MEM_COMMIT, PAGE_READWRITE) == NULL)
+    {
+        std::cerr << "Failed to commit " << size << " bytes! " << Windows::GetLastErrorMessage() << "\n";
+        return false;
+    }
+
+    committedSize = size;
+    return true;
+}
+
+void WindowsVirtualMemory::Decommit(size_t size)
+{
+    size = RoundUpToPageSize(size);
+    if (size >= committedSize)
+        return;
+
+    VirtualFree(data + size, committedSize - size, MEM_DECOMMIT);
+    committedSize = size;
+}
+
+void WindowsVirtualMemory::Release()
+{
+    if (data)
+        VirtualFree(data, 0, MEM_RELEASE);
+
+    data          = nullptr;
+    reservedSize  = 0;
+    committedSize = 0;
+}
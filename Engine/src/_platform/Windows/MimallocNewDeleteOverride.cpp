@@ -1,5 +1,8 @@
-#if ADHOC_EDITOR
+#if ADHOC_EDITOR && ADHOC_RELEASE
     #include <mimalloc-new-delete.h>
+#elif ADHOC_EDITOR
+    // Through the HeapProfiler instead, so that it can be started at any point and see every block
+    #include <Engine/Core/HeapProfilerNewDelete.h>
 #endif
 
 // On Windows, we override new/delete in addition to malloc/free for performance reasons.
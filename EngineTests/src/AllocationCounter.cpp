@@ -0,0 +1,109 @@
+#include "AllocationCounter.h"
+
+#include <Engine/Core/HeapProfiler.h>
+
+#if ADHOC_WINDOWS && ADHOC_EDITOR && ADHOC_RELEASE
+    #include <mimalloc.h>
+#endif
+
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new/delete for the whole test executable. Like HeapProfilerNewDelete.h, these go
+// through the HeapProfiler, except in Windows editor Release builds, where the Engine library overrides them with
+// mimalloc-new-delete.h and these have to forward to mimalloc directly to match.
+
+static thread_local size_t threadAllocationCount = 0;
+
+static void* AllocateCounted(size_t size)
+{
+    ++threadAllocationCount;
+
+#if ADHOC_WINDOWS && ADHOC_EDITOR && ADHOC_RELEASE
+    void* memory = mi_malloc(size == 0 ? 1 : size);
+#else
+    void* memory = Engine::HeapProfiler::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+#endif
+
+    if (!memory)
+        throw std::bad_alloc();
+
+    return memory;
+}
+
+static void FreeCounted(void* memory) noexcept
+{
+#if ADHOC_WINDOWS && ADHOC_EDITOR && ADHOC_RELEASE
+    mi_free(memory);
+#else
+    Engine::HeapProfiler::Free(memory);
+#endif
+}
+
+void* operator new(size_t size)
+{
+    return AllocateCounted(size);
+}
+
+void* operator new[](size_t size)
+{
+    return AllocateCounted(size);
+}
+
+// The nothrow ones too, since sanitizer runtimes replace whichever ones aren't, and the two have to agree
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return AllocateCounted(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t& nothrow) noexcept
+{
+    return operator new(size, nothrow);
+}
+
+void operator delete(void* memory) noexcept
+{
+    FreeCounted(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    FreeCounted(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    FreeCounted(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+    FreeCounted(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    FreeCounted(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    FreeCounted(memory);
+}
+
+namespace Testing
+{
+
+size_t GetThreadAllocationCount()
+{
+    return threadAllocationCount;
+}
+
+} // namespace Testing
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Testing
+{
+
+/// Number of times operator new has been called on the current thread. Only differences between two calls are
+/// meaningful.
+size_t GetThreadAllocationCount();
+
+} // namespace Testing
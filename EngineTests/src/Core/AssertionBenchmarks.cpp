@@ -0,0 +1,143 @@
+#include <Engine/Core/Assertions.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Core
+{
+
+// These only report timings; they don't assert on them since the numbers depend entirely on the machine running them
+
+// The binary assertion expansion from before operands were stringified lazily, kept to compare against
+#define EAGER_ASSERT_EQ(leftExpression, rightExpression)                                                               \
+    {                                                                                                                  \
+        decltype(leftExpression) leftExpressionResult   = leftExpression;                                              \
+        decltype(rightExpression) rightExpressionResult = rightExpression;                                             \
+                                                                                                                       \
+        auto leftExpressionResultString  = fmt::format("{}", leftExpressionResult);                                    \
+        auto rightExpressionResultString = fmt::format("{}", rightExpressionResult);                                   \
+                                                                                                                       \
+        if (!(leftExpressionResult == rightExpressionResult))                                                          \
+        {                                                                                                              \
+            ::Engine::Internal::LogBinaryAssertionFailure(true,                                                        \
+                                                          STRINGIFY(leftExpression),                                   \
+                                                          leftExpressionResultString,                                  \
+                                                          STRINGIFY(rightExpression),                                  \
+                                                          rightExpressionResultString,                                 \
+                                                          "==",                                                        \
+                                                          "",                                                          \
+                                                          std::source_location::current());                            \
+            ::Engine::Internal::TriggerFatalErrorResponse();                                                           \
+        }                                                                                                              \
+    }
+
+// The binary assertion expansion from before failures were handled out of line
+#define INLINE_FAILURE_ASSERT_LT(leftExpression, rightExpression)                                                      \
+    {                                                                                                                  \
+        const auto& leftExpressionResult  = leftExpression;                                                            \
+        const auto& rightExpressionResult = rightExpression;                                                           \
+                                                                                                                       \
+        if (!(leftExpressionResult < rightExpressionResult))                                                           \
+        {                                                                                                              \
+            ::Engine::Internal::LogBinaryAssertionFailure(true,                                                        \
+                                                          STRINGIFY(leftExpression),                                   \
+                                                          fmt::format("{}", leftExpressionResult),                     \
+                                                          STRINGIFY(rightExpression),                                  \
+                                                          fmt::format("{}", rightExpressionResult),                    \
+                                                          "<",                                                         \
+                                                          "",                                                          \
+                                                          std::source_location::current());                            \
+            ::Engine::Internal::TriggerFatalErrorResponse();                                                           \
+        }                                                                                                              \
+    }
+
+static constexpr int benchmarkIterations = 1000000;
+static constexpr int benchmarkValueCount = 1024;
+
+template <typename F>
+static double MeasureNanosecondsPerIteration(F&& iteration)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < benchmarkIterations; ++i)
+        iteration(i % benchmarkValueCount);
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / benchmarkIterations;
+}
+
+TEST(AssertionBenchmark, PassingBinaryAssertionCost)
+{
+    if constexpr (!ADHOC_ASSERTIONS_ON)
+        GTEST_SKIP() << "Assertions are compiled out in this configuration";
+
+    // Separate copies so the comparisons can't be folded away
+    auto ints    = std::vector<int>();
+    auto strings = std::vector<std::string>();
+    for (auto i = 0; i < benchmarkValueCount; ++i)
+    {
+        ints.push_back(i * 7919);
+        strings.push_back(fmt::format("A string long enough to need a heap allocation #{}", i));
+    }
+    const auto intCopies    = ints;
+    const auto stringCopies = strings;
+
+    const auto eagerInts    = MeasureNanosecondsPerIteration([&](int i) EAGER_ASSERT_EQ(ints[i], intCopies[i]));
+    const auto lazyInts     = MeasureNanosecondsPerIteration([&](int i) Assert_Eq(ints[i], intCopies[i]));
+    const auto eagerStrings = MeasureNanosecondsPerIteration([&](int i) EAGER_ASSERT_EQ(strings[i], stringCopies[i]));
+    const auto lazyStrings  = MeasureNanosecondsPerIteration([&](int i) Assert_Eq(strings[i], stringCopies[i]));
+
+    fmt::print("[ Asserts  ] passing Assert_Eq on ints:    {:>7.2f} ns before, {:>7.2f} ns now\n", eagerInts, lazyInts);
+    fmt::print("[ Asserts  ] passing Assert_Eq on strings: {:>7.2f} ns before, {:>7.2f} ns now\n",
+               eagerStrings,
+               lazyStrings);
+}
+
+// A hot function guarded by a handful of assertions, as in a typical engine loop
+#define DEFINE_GUARDED_SUM(name, ASSERT_LT)                                                                            \
+    NOINLINE static int name(const std::vector<int>& values, int i)                                                    \
+    {                                                                                                                  \
+        const auto size = static_cast<int>(values.size());                                                             \
+        ASSERT_LT(i, size);                                                                                            \
+        ASSERT_LT(i + 1, size + 1);                                                                                    \
+        ASSERT_LT(values[i], values[i] + 1);                                                                           \
+        ASSERT_LT(-1, values[i]);                                                                                      \
+        ASSERT_LT(values[i] / 2, values[i] + 1);                                                                       \
+        ASSERT_LT(i - 1, size);                                                                                        \
+        return values[i] + i;                                                                                          \
+    }
+
+DEFINE_GUARDED_SUM(GuardedSumWithInlineFailures, INLINE_FAILURE_ASSERT_LT)
+DEFINE_GUARDED_SUM(GuardedSumWithOutlinedFailures, Assert_Lt)
+
+TEST(AssertionBenchmark, OutlinedFailurePathCost)
+{
+    if constexpr (!ADHOC_ASSERTIONS_ON)
+        GTEST_SKIP() << "Assertions are compiled out in this configuration";
+
+    auto values = std::vector<int>();
+    for (auto i = 0; i < benchmarkValueCount; ++i)
+        values.push_back(i * 31);
+
+    auto inlineSum   = 0;
+    auto outlinedSum = 0;
+
+    const auto inlineNanoseconds =
+        MeasureNanosecondsPerIteration([&](int i) { inlineSum += GuardedSumWithInlineFailures(values, i); });
+    const auto outlinedNanoseconds =
+        MeasureNanosecondsPerIteration([&](int i) { outlinedSum += GuardedSumWithOutlinedFailures(values, i); });
+
+    EXPECT_EQ(inlineSum, outlinedSum);
+    fmt::print("[ Asserts  ] 6 passing Assert_Lt: {:>7.2f} ns with inline failure paths, {:>7.2f} ns outlined\n",
+               inlineNanoseconds,
+               outlinedNanoseconds);
+}
+
+#undef DEFINE_GUARDED_SUM
+#undef INLINE_FAILURE_ASSERT_LT
+#undef EAGER_ASSERT_EQ
+
+} // namespace Core
@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <source_location>
+#include <string>
+
 #pragma clang diagnostic ignored "-Wunused-value"
 #pragma clang diagnostic ignored "-Wunused-comparison"
 
@@ -234,6 +238,121 @@ TEST(AssertionTest, FailingExpectsLogErrors)
 }
 #endif // ADHOC_ASSERTIONS_ON
 
+#if ADHOC_ASSERTIONS_ON
+TEST(AssertionTest, FailingExpectsAreRateLimited)
+{
+    auto errorLogCount = 0;
+    auto lastErrorLog  = std::string();
+    auto errorStream   = Console::LogStream(Console::LogLevel::Error,
+                                          [&](const Console::LogLevel logLevel, const std::string& message)
+                                          {
+                                              ++errorLogCount;
+                                              lastErrorLog = message;
+                                          });
+
+    const auto expectNegative = [](int rateLimitedValue) { Expect_Lt(rateLimitedValue, 0); };
+
+    Engine::SetAssertionReportInterval(std::chrono::hours(1));
+    for (auto i = 0; i < 1000; ++i)
+        expectNegative(i);
+    EXPECT_EQ(errorLogCount, 1);
+
+    // The next failure that's logged also says how many weren't
+    Engine::SetAssertionReportInterval(std::chrono::milliseconds(0));
+    expectNegative(1000);
+    EXPECT_EQ(errorLogCount, 3);
+    EXPECT_NE(lastErrorLog.find("rateLimitedValue"), std::string::npos);
+
+    Engine::SetAssertionReportInterval(std::chrono::seconds(1));
+
+    const auto stats = Engine::GetAssertionStatsJson();
+    EXPECT_NE(stats.find(R"("expression": "rateLimitedValue < 0", "isFatal": false, "hitCount": 1001, )"
+                         R"("failureCount": 1001, "firstFailureTimeMs": )"),
+              std::string::npos)
+        << stats;
+}
+
+TEST(AssertionTest, StatsIncludePassingAssertions)
+{
+    for (auto i = 0; i < 3; ++i)
+        Expect_Eq(std::string("a \"quoted\" string"), std::string("a \"quoted\" string"));
+
+    const auto stats = Engine::GetAssertionStatsJson();
+    EXPECT_NE(stats.find(R"json("expression": "std::string(\"a \\\"quoted\\\" string\") == )json"
+                         R"json(std::string(\"a \\\"quoted\\\" string\")", "isFatal": false, "hitCount": 3, )json"
+                         R"json("failureCount": 0, "firstFailureTimeMs": null, "lastFailureTimeMs": null})json"),
+              std::string::npos)
+        << stats;
+}
+
+TEST(AssertionTest, StatsOutliveTheSitesStrings)
+{
+    using Engine::Internal::AssertionRecord;
+    using Engine::Internal::AssertionSite;
+
+    // Stands in for a module's read-only data, which goes away when it's unloaded
+    auto expression = std::string("reloadedModuleValue > 0");
+    const auto site = AssertionSite(false, expression, std::source_location::current());
+
+    {
+        auto record = AssertionRecord(site);
+        record.CountHit();
+        record.CountHit();
+    }
+    expression.assign(expression.size(), '?');
+
+    // The same site in the module's next copy picks up where it left off
+    auto reloadedExpression = std::string("reloadedModuleValue > 0");
+    const auto reloadedSite = AssertionSite(false, reloadedExpression, site.location);
+    auto reloadedRecord     = AssertionRecord(reloadedSite);
+    reloadedRecord.CountHit();
+
+    const auto stats = Engine::GetAssertionStatsJson();
+    EXPECT_NE(stats.find(R"("expression": "reloadedModuleValue > 0", "isFatal": false, "hitCount": 3, )"),
+              std::string::npos)
+        << stats;
+    EXPECT_EQ(stats.find("???"), std::string::npos) << stats;
+}
+#endif // ADHOC_ASSERTIONS_ON
+
+#if ADHOC_ASSERTIONS_ON
+TEST(AssertionTest, FmtExpectsLogTheirMessage)
+{
+    auto lastErrorLog = std::string();
+    auto errorStream  = Console::LogStream(Console::LogLevel::Error,
+                                          [&lastErrorLog](const Console::LogLevel logLevel, const std::string& message)
+                                          { lastErrorLog = message; });
+
+    ExpectF_Le(2, 1, "Le message {}", 1);
+    EXPECT_NE(lastErrorLog.find("Le message 1"), std::string::npos);
+
+    ExpectEvalF_Eq(1, 2, "EvalEq message {}", 2);
+    EXPECT_NE(lastErrorLog.find("EvalEq message 2"), std::string::npos);
+}
+#endif // ADHOC_ASSERTIONS_ON
+
+#if ADHOC_SLOW_ASSERTIONS_ON
+TEST(AssertionTest, SlowAssertionsAreSampled)
+{
+    auto checkCount     = 0;
+    auto evaluatedCount = 0;
+    auto codeBlockCount = 0;
+
+    Engine::SetSlowAssertionSampleRate(4);
+    for (auto i = 0; i < 100; ++i)
+    {
+        Assert_True_Slow(++checkCount > 0);
+        AssertEval_Eq_Slow(++evaluatedCount, i + 1);
+        Assert_Code_Slow(++codeBlockCount;);
+    }
+    Engine::SetSlowAssertionSampleRate(1);
+
+    EXPECT_EQ(checkCount, 25);
+    EXPECT_EQ(evaluatedCount, 100);
+    EXPECT_EQ(codeBlockCount, 25);
+}
+#endif // ADHOC_SLOW_ASSERTIONS_ON
+
 #if ADHOC_ASSERTIONS_ON
 TEST(AssertionTest, ExpressionsEvaluateOnlyOnce)
 {
@@ -392,6 +511,33 @@ TEST(AssertionTest, EvalAssertionExpressionsEvaluateWhenOff)
 }
 #endif // !ADHOC_ASSERTIONS_ON
 
+#if !ADHOC_SLOW_ASSERTIONS_ON
+// Never defined, so linking fails if a slow assertion that's off still references its expression
+int NeverDefinedFunction();
+
+TEST(AssertionTest, SlowAssertionsCompileAwayWhenOff)
+{
+    #define SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(assertion) assertion;
+
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Assert_True_Slow(NeverDefinedFunction() == 1));
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Assert_False_Slow(NeverDefinedFunction() == 0));
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Assert_Eq_Slow(NeverDefinedFunction(), 1));
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Assert_Lt_Slow(NeverDefinedFunction(), 2));
+
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Expect_True_Slow(NeverDefinedFunction() == 1));
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Expect_False_Slow(NeverDefinedFunction() == 0));
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Expect_Ne_Slow(NeverDefinedFunction(), 0));
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Expect_Ge_Slow(NeverDefinedFunction(), 0));
+
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(AssertF_Le_Slow(NeverDefinedFunction(), 2, "{}", 1));
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(ExpectF_Gt_Slow(NeverDefinedFunction(), 0, "{}", 1));
+
+    SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE(Assert_Code_Slow(NeverDefinedFunction();));
+
+    #undef SLOW_ASSERTIONS_COMPILE_AWAY_WHEN_OFF_CASE
+}
+#endif // !ADHOC_SLOW_ASSERTIONS_ON
+
 TEST(AssertionTest, AssertCodeBlocksWork)
 {
     auto codeBlockHasRun = false;
@@ -0,0 +1,166 @@
+#include <Engine/Core/Console.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Console = Engine::Console;
+using Console::LogLevel;
+
+namespace Core
+{
+
+// These only report timings; they don't assert on them since the numbers depend entirely on the machine running them
+
+static constexpr int benchmarkMessagesPerThread = 2000;
+
+static void SlowSink(LogLevel, std::string_view)
+{
+    // Roughly the cost of writing a line to a terminal
+    const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(2);
+    while (std::chrono::steady_clock::now() < end)
+    {}
+}
+
+static double MeasureProducerNanosecondsPerCall(int threadCount)
+{
+    auto threadNanoseconds = std::vector<double>(threadCount);
+    auto threads           = std::vector<std::thread>();
+
+    for (auto i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(
+            [i, &threadNanoseconds]
+            {
+                const auto start = std::chrono::steady_clock::now();
+                for (auto j = 0; j < benchmarkMessagesPerThread; ++j)
+                    Console::LogWarning("Benchmark message {} from thread {}", j, i);
+                const auto end = std::chrono::steady_clock::now();
+
+                threadNanoseconds[i] = std::chrono::duration<double, std::nano>(end - start).count();
+            });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    auto totalNanoseconds = 0.0;
+    for (const auto nanoseconds : threadNanoseconds)
+        totalNanoseconds += nanoseconds;
+
+    return totalNanoseconds / (threadCount * benchmarkMessagesPerThread);
+}
+
+TEST(ConsoleBenchmark, ProducerLatencySyncVsAsync)
+{
+    auto logStream = Console::LogStream(LogLevel::Log, SlowSink);
+
+    for (const auto threadCount : {1, 4, 16})
+    {
+        const auto syncNanoseconds = MeasureProducerNanosecondsPerCall(threadCount);
+
+        Console::EnableAsyncLogging();
+        const auto asyncNanoseconds = MeasureProducerNanosecondsPerCall(threadCount);
+        Console::DisableAsyncLogging();
+
+        fmt::print("[ Console  ] {:>2} thread(s): sync {:>8.1f} ns/call, async {:>8.1f} ns/call\n",
+                   threadCount,
+                   syncNanoseconds,
+                   asyncNanoseconds);
+    }
+}
+
+TEST(ConsoleBenchmark, UnacceptedLogLevelCost)
+{
+    constexpr int iterations = 10000000;
+
+    auto logStream = Console::LogStream(LogLevel::Warning, [](LogLevel, std::string_view) {});
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+        Console::LogTrace("Benchmark message {} with a {} argument", i, "string");
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto nanosecondsPerCall = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    fmt::print("[ Console  ] LogTrace() with no Trace listener: {:.2f} ns/call\n", nanosecondsPerCall);
+}
+
+static double MeasureLogTraceNanosecondsPerCall(int iterations)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+        Console::LogTrace("Benchmark message {} with value {} from {}", i, 0.5 * i, "the benchmark");
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+TEST(ConsoleBenchmark, DeferredVsImmediateFormatting)
+{
+    if constexpr (ADHOC_MIN_LOG_LEVEL < ADHOC_LOG_LEVEL_TRACE)
+        GTEST_SKIP() << "LogTrace() is compiled out in this configuration";
+
+    constexpr int iterations = 200000;
+
+    auto logStream = Console::LogStream(LogLevel::Trace, [](LogLevel, std::string_view) {});
+
+    const auto immediateNanoseconds = MeasureLogTraceNanosecondsPerCall(iterations);
+
+    // A long drain interval keeps the drain thread out of the measurement, and the warm-up pass faults in the buffer
+    Console::EnableDeferredLogging({.threadBufferSize = 16 * 1024 * 1024, .drainInterval = std::chrono::seconds(10)});
+    MeasureLogTraceNanosecondsPerCall(iterations);
+    Console::Flush();
+
+    const auto deferredNanoseconds = MeasureLogTraceNanosecondsPerCall(iterations);
+
+    const auto flushStart = std::chrono::steady_clock::now();
+    Console::Flush();
+    const auto flushEnd = std::chrono::steady_clock::now();
+    Console::DisableDeferredLogging();
+
+    fmt::print("[ Console  ] immediate {:.1f} ns/call ({:.1f}M/s), deferred {:.1f} ns/call ({:.1f}M/s), "
+               "then {:.1f} ms to flush\n",
+               immediateNanoseconds,
+               1000.0 / immediateNanoseconds,
+               deferredNanoseconds,
+               1000.0 / deferredNanoseconds,
+               std::chrono::duration<double, std::milli>(flushEnd - flushStart).count());
+}
+
+TEST(ConsoleBenchmark, DispatchCostPerListener)
+{
+    constexpr int iterations = 100000;
+
+    const auto message = std::string("Benchmark message");
+    auto receivedCount = 0;
+
+    auto logStreams = std::vector<std::unique_ptr<Console::LogStream>>();
+    for (const auto listenerCount : {0, 1, 4, 16, 64})
+    {
+        while (static_cast<int>(logStreams.size()) < listenerCount)
+        {
+            logStreams.push_back(std::make_unique<Console::LogStream>(
+                LogLevel::Log, [&receivedCount](LogLevel, std::string_view) { ++receivedCount; }));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (auto i = 0; i < iterations; ++i)
+            Console::Internal::LogImplementation(LogLevel::Log, message);
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto nanosecondsPerCall = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+        fmt::print("[ Console  ] {:>2} listener(s): {:>8.1f} ns/call, {:>6.1f} ns/listener\n",
+                   listenerCount,
+                   nanosecondsPerCall,
+                   listenerCount > 0 ? nanosecondsPerCall / listenerCount : 0.0);
+    }
+
+    EXPECT_GT(receivedCount, 0);
+}
+
+} // namespace Core
@@ -1,9 +1,17 @@
+#include "../AllocationCounter.h"
+
 #include <Engine/Core/Console.h>
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <filesystem>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace Console = Engine::Console;
 using Console::LogLevel;
@@ -11,6 +19,26 @@ using Console::LogLevel;
 namespace Core
 {
 
+struct FormatCounter
+{
+    int* formatCount;
+};
+
+} // namespace Core
+
+template <>
+struct fmt::formatter<::Core::FormatCounter> : formatter<string_view>
+{
+    auto format(const ::Core::FormatCounter& counter, format_context& ctx) const -> format_context::iterator
+    {
+        ++*counter.formatCount;
+        return formatter<string_view>::format("counted", ctx);
+    }
+};
+
+namespace Core
+{
+
 class ConsoleTest : public testing::Test
 {
 protected:
@@ -104,6 +132,9 @@ TEST_F(ConsoleTest, LogStreamsReceiveWarningLogsCorrectly)
 
 TEST_F(ConsoleTest, LogStreamsReceiveBasicLogsCorrectly)
 {
+    if constexpr (ADHOC_MIN_LOG_LEVEL < ADHOC_LOG_LEVEL_LOG)
+        GTEST_SKIP() << "Log() is compiled out in this configuration";
+
     Console::Log("Test");
 
     EXPECT_EQ(fatalStreamReceivedMessage, "");
@@ -116,6 +147,9 @@ TEST_F(ConsoleTest, LogStreamsReceiveBasicLogsCorrectly)
 
 TEST_F(ConsoleTest, LogStreamsReceiveTraceLogsCorrectly)
 {
+    if constexpr (ADHOC_MIN_LOG_LEVEL < ADHOC_LOG_LEVEL_TRACE)
+        GTEST_SKIP() << "LogTrace() is compiled out in this configuration";
+
     Console::LogTrace("Test");
 
     EXPECT_EQ(fatalStreamReceivedMessage, "");
@@ -167,6 +201,7 @@ TEST_F(ConsoleTest, LogStreamsReceiveLogLevels)
     EXPECT_EQ(basicStreamReceivedLogLevel, LogLevel::Warning);
     EXPECT_EQ(traceStreamReceivedLogLevel, LogLevel::Warning);
 
+#if ADHOC_MIN_LOG_LEVEL >= ADHOC_LOG_LEVEL_LOG
     Console::Log("Test");
 
     EXPECT_EQ(fatalStreamReceivedLogLevel, LogLevel::Fatal);
@@ -175,7 +210,9 @@ TEST_F(ConsoleTest, LogStreamsReceiveLogLevels)
     EXPECT_EQ(defaultStreamReceivedLogLevel, LogLevel::Log);
     EXPECT_EQ(basicStreamReceivedLogLevel, LogLevel::Log);
     EXPECT_EQ(traceStreamReceivedLogLevel, LogLevel::Log);
+#endif
 
+#if ADHOC_MIN_LOG_LEVEL >= ADHOC_LOG_LEVEL_TRACE
     Console::LogTrace("Test");
 
     EXPECT_EQ(fatalStreamReceivedLogLevel, LogLevel::Fatal);
@@ -184,6 +221,369 @@ TEST_F(ConsoleTest, LogStreamsReceiveLogLevels)
     EXPECT_EQ(defaultStreamReceivedLogLevel, LogLevel::Log);
     EXPECT_EQ(basicStreamReceivedLogLevel, LogLevel::Log);
     EXPECT_EQ(traceStreamReceivedLogLevel, LogLevel::Trace);
+#endif
+}
+
+TEST(ConsoleLevelTest, UnacceptedLogLevelsSkipFormatting)
+{
+    auto formatCount = 0;
+
+    {
+        auto warningLogStream = Console::LogStream(LogLevel::Warning, [](LogLevel, const std::string&) {});
+
+        Console::Log("{}", FormatCounter{&formatCount});
+        Console::LogTrace("{}", FormatCounter{&formatCount});
+        EXPECT_EQ(formatCount, 0);
+
+        Console::LogWarning("{}", FormatCounter{&formatCount});
+        EXPECT_EQ(formatCount, 1);
+    }
+
+    Console::LogError("{}", FormatCounter{&formatCount});
+    EXPECT_EQ(formatCount, 1);
+
+    auto traceLogStream = Console::LogStream(LogLevel::Trace, [](LogLevel, const std::string&) {});
+    Console::LogTrace("{}", FormatCounter{&formatCount});
+    EXPECT_EQ(formatCount, ADHOC_MIN_LOG_LEVEL >= ADHOC_LOG_LEVEL_TRACE ? 2 : 1);
+}
+
+TEST(ConsoleAllocationTest, ShortMessagesDontAllocate)
+{
+    auto isMessageReceived = false;
+    auto logStream         = Console::LogStream(LogLevel::Warning,
+                                        [&](LogLevel, std::string_view logMessage)
+                                        { isMessageReceived = logMessage == "A short message with 3 formatted arguments"; });
+
+    const auto allocationCountBefore = Testing::GetThreadAllocationCount();
+    Console::LogWarning("A short message with {} {} arguments", 3, "formatted");
+    const auto allocationCountAfter = Testing::GetThreadAllocationCount();
+
+    EXPECT_EQ(allocationCountAfter - allocationCountBefore, 0u);
+    EXPECT_TRUE(isMessageReceived);
+}
+
+TEST(ConsoleAllocationTest, LongMessagesDontAllocate)
+{
+    const auto argument = std::string(2000, 'x');
+
+    auto receivedSize = size_t(0);
+    auto logStream    = Console::LogStream(LogLevel::Warning,
+                                        [&](LogLevel, std::string_view logMessage) { receivedSize = logMessage.size(); });
+
+    // Longer than the formatting buffer's inline storage, so the rest of it comes from the thread's scratch arena
+    const auto allocationCountBefore = Testing::GetThreadAllocationCount();
+    Console::LogWarning("Long: {}", argument);
+    const auto allocationCountAfter = Testing::GetThreadAllocationCount();
+
+    EXPECT_EQ(allocationCountAfter - allocationCountBefore, 0u);
+    EXPECT_EQ(receivedSize, argument.size() + 6);
+}
+
+TEST(ConsoleAllocationTest, LegacyCallbacksStillReceiveMessages)
+{
+    auto receivedMessage = std::string();
+    auto logStream       = Console::LogStream(LogLevel::Warning,
+                                        [&](LogLevel, const std::string& logMessage) { receivedMessage = logMessage; });
+
+    Console::LogWarning("Legacy {}", 1);
+
+    EXPECT_EQ(receivedMessage, "Legacy 1");
+}
+
+TEST_F(ConsoleTest, AsyncLogStreamsReceiveLogsAfterFlush)
+{
+    Console::EnableAsyncLogging();
+    EXPECT_TRUE(Console::IsAsyncLoggingEnabled());
+
+    Console::LogWarning("Test");
+    Console::Flush();
+
+    EXPECT_EQ(fatalStreamReceivedMessage, "");
+    EXPECT_EQ(errorStreamReceivedMessage, "");
+    EXPECT_EQ(warningStreamReceivedMessage, "Test");
+    EXPECT_EQ(defaultStreamReceivedMessage, "Test");
+    EXPECT_EQ(basicStreamReceivedMessage, "Test");
+    EXPECT_EQ(traceStreamReceivedMessage, "Test");
+
+    Console::DisableAsyncLogging();
+    EXPECT_FALSE(Console::IsAsyncLoggingEnabled());
+}
+
+TEST(ConsoleAsyncTest, AsyncLoggingPreservesOrderFromEachThread)
+{
+    constexpr int threadCount       = 4;
+    constexpr int messagesPerThread = 1000;
+
+    auto lastReceived = std::vector<int>(threadCount, -1);
+    auto isInOrder    = true;
+
+    auto logStream = Console::LogStream(LogLevel::Log,
+                                        [&](LogLevel, const std::string& logMessage)
+                                        {
+                                            auto stream       = std::istringstream(logMessage);
+                                            auto threadIndex  = 0;
+                                            auto messageIndex = 0;
+                                            stream >> threadIndex >> messageIndex;
+
+                                            isInOrder                 = isInOrder && messageIndex > lastReceived[threadIndex];
+                                            lastReceived[threadIndex] = messageIndex;
+                                        });
+
+    Console::EnableAsyncLogging({.queueCapacity = 64});
+
+    auto threads = std::vector<std::thread>();
+    for (auto i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(
+            [i]
+            {
+                for (auto j = 0; j < messagesPerThread; ++j)
+                    Console::LogWarning("{} {}", i, j);
+            });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    Console::DisableAsyncLogging();
+
+    EXPECT_TRUE(isInOrder);
+    for (auto i = 0; i < threadCount; ++i)
+        EXPECT_EQ(lastReceived[i], messagesPerThread - 1);
+}
+
+TEST(ConsoleRegistryTest, LoggingIsSafeWhileLogStreamsChurn)
+{
+    constexpr int threadCount       = 8;
+    constexpr int messagesPerThread = 5000;
+
+    auto persistentReceivedCount = std::atomic<int>(0);
+    auto persistentLogStream     = Console::LogStream(LogLevel::Log,
+                                                  [&](LogLevel, const std::string&) { persistentReceivedCount.fetch_add(1); });
+
+    auto threads = std::vector<std::thread>();
+    for (auto i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(
+            [i]
+            {
+                for (auto j = 0; j < messagesPerThread; ++j)
+                    Console::LogWarning("{} {}", i, j);
+            });
+    }
+
+    // Each churned stream writes into state that dies with it, so a callback outliving its LogStream would be caught
+    // by the sanitizers (and usually by the assertion below)
+    auto churnedStreamCount = 0;
+    do
+    {
+        auto churnedReceivedCount = std::make_unique<std::atomic<int>>(0);
+        auto isStreamAlive        = std::make_unique<std::atomic<bool>>(true);
+
+        {
+            auto churnedLogStream = Console::LogStream(LogLevel::Trace,
+                                                       [&churnedReceivedCount, &isStreamAlive](LogLevel, const std::string&)
+                                                       {
+                                                           EXPECT_TRUE(isStreamAlive->load());
+                                                           churnedReceivedCount->fetch_add(1);
+                                                       });
+            std::this_thread::yield();
+        }
+
+        isStreamAlive->store(false);
+        ++churnedStreamCount;
+    } while (persistentReceivedCount.load() < threadCount * messagesPerThread);
+
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(persistentReceivedCount.load(), threadCount * messagesPerThread);
+    EXPECT_GT(churnedStreamCount, 0);
+}
+
+TEST(ConsoleDeferredTest, DeferredLogsAreFormattedOnFlush)
+{
+    if constexpr (ADHOC_MIN_LOG_LEVEL < ADHOC_LOG_LEVEL_TRACE)
+        GTEST_SKIP() << "LogTrace() is compiled out in this configuration";
+
+    auto receivedMessages = std::vector<std::string>();
+    auto logStream        = Console::LogStream(LogLevel::Trace,
+                                        [&](LogLevel, std::string_view logMessage)
+                                        { receivedMessages.emplace_back(logMessage); });
+
+    Console::EnableDeferredLogging();
+    EXPECT_TRUE(Console::IsDeferredLoggingEnabled());
+
+    {
+        // Strings are captured by value, so they don't need to outlive the call
+        const auto temporaryString = std::string("temporary");
+        Console::LogTrace("{} {} {:.2f} {} {} {}", -42, 7u, 1.5f, 'c', true, temporaryString);
+    }
+    Console::Log("{:>6}|{}", "right", static_cast<const void*>(nullptr));
+    Console::Flush();
+
+    ASSERT_EQ(receivedMessages.size(), 2u);
+    EXPECT_EQ(receivedMessages[0], "-42 7 1.50 c true temporary");
+    EXPECT_EQ(receivedMessages[1], " right|0x0");
+
+    Console::DisableDeferredLogging();
+    EXPECT_FALSE(Console::IsDeferredLoggingEnabled());
+}
+
+TEST(ConsoleDeferredTest, DirectMessagesDontOvertakeDeferredOnes)
+{
+    if constexpr (ADHOC_MIN_LOG_LEVEL < ADHOC_LOG_LEVEL_LOG)
+        GTEST_SKIP() << "Log() is compiled out in this configuration";
+
+    auto receivedMessages = std::vector<std::string>();
+    auto logStream        = Console::LogStream(LogLevel::Log,
+                                        [&](LogLevel, std::string_view logMessage)
+                                        { receivedMessages.emplace_back(logMessage); });
+
+    // The drain thread never wakes up on its own, so only logging directly can deliver the deferred records early
+    Console::EnableDeferredLogging({.threadBufferSize = 1024, .drainInterval = std::chrono::hours(1)});
+
+    Console::Log("Message {}", 0);
+    Console::LogWarning("Message {}", 1);
+
+    // More than the buffer holds, so the later ones are formatted straight away
+    for (auto i = 2; i < 100; ++i)
+        Console::Log("Message {}", i);
+
+    Console::Flush();
+    Console::DisableDeferredLogging();
+
+    ASSERT_EQ(receivedMessages.size(), 100u);
+    for (auto i = 0; i < 100; ++i)
+        EXPECT_EQ(receivedMessages[i], fmt::format("Message {}", i));
+}
+
+TEST(ConsoleDeferredTest, BinaryLogCanBeDecoded)
+{
+    if constexpr (ADHOC_MIN_LOG_LEVEL < ADHOC_LOG_LEVEL_TRACE)
+        GTEST_SKIP() << "LogTrace() is compiled out in this configuration";
+
+    const auto binaryLogPath = std::filesystem::temp_directory_path() / "EngineTests_BinaryLogCanBeDecoded.adhoclog";
+
+    // Nothing listens to the text, so the records are only ever formatted by the decoder
+    Console::EnableDeferredLogging({.binaryLogPath = binaryLogPath});
+    for (auto i = 0; i < 3; ++i)
+        Console::LogTrace("Record {} of {}", i, "three");
+    Console::DisableDeferredLogging();
+
+    auto decodedLevels   = std::vector<LogLevel>();
+    auto decodedMessages = std::vector<std::string>();
+    EXPECT_TRUE(Console::DecodeBinaryLog(binaryLogPath,
+                                         [&](LogLevel logLevel, std::string_view logMessage)
+                                         {
+                                             decodedLevels.push_back(logLevel);
+                                             decodedMessages.emplace_back(logMessage);
+                                         }));
+
+    ASSERT_EQ(decodedMessages.size(), 3u);
+    EXPECT_EQ(decodedMessages[0], "Record 0 of three");
+    EXPECT_EQ(decodedMessages[2], "Record 2 of three");
+    EXPECT_EQ(decodedLevels[1], LogLevel::Trace);
+
+    std::filesystem::remove(binaryLogPath);
+}
+
+TEST(ConsoleDeferredTest, DisablingKeepsRecordsThatAreBeingWritten)
+{
+    if constexpr (ADHOC_MIN_LOG_LEVEL < ADHOC_LOG_LEVEL_TRACE)
+        GTEST_SKIP() << "LogTrace() is compiled out in this configuration";
+
+    constexpr int threadCount       = 4;
+    constexpr int messagesPerThread = 20000;
+
+    auto receivedCount = std::atomic<int>(0);
+    auto logStream =
+        Console::LogStream(LogLevel::Trace, [&](LogLevel, std::string_view) { receivedCount.fetch_add(1); });
+
+    auto runningThreadCount = std::atomic<int>(threadCount);
+    auto threads            = std::vector<std::thread>();
+    for (auto i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(
+            [&, i]
+            {
+                for (auto message = 0; message < messagesPerThread; ++message)
+                    Console::LogTrace("{} {}", i, message);
+                runningThreadCount.fetch_sub(1);
+            });
+    }
+
+    // Every record is either drained before the logger goes away, or logged directly once it has
+    while (runningThreadCount.load() > 0)
+    {
+        Console::EnableDeferredLogging({.threadBufferSize = 1024 * 1024});
+        std::this_thread::yield();
+        Console::DisableDeferredLogging();
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(receivedCount.load(), threadCount * messagesPerThread);
+}
+
+TEST(ConsoleDeferredTest, FormatStringsOutliveTheirModule)
+{
+    auto receivedMessages = std::vector<std::string>();
+    auto logStream        = Console::LogStream(LogLevel::Log,
+                                        [&](LogLevel, std::string_view logMessage)
+                                        { receivedMessages.emplace_back(logMessage); });
+
+    Console::EnableDeferredLogging();
+
+    // Stands in for a module's read-only data, which the next module loaded can reuse for different format strings
+    auto moduleFormatString = std::string("Before reload {}");
+    EXPECT_TRUE(Console::Internal::LogDeferred(LogLevel::Log, moduleFormatString, 1));
+
+    moduleFormatString.replace(0, 6, "After ");
+    Console::ForgetFormatStringAddresses();
+    EXPECT_TRUE(Console::Internal::LogDeferred(LogLevel::Log, moduleFormatString, 2));
+
+    Console::Flush();
+    Console::DisableDeferredLogging();
+
+    ASSERT_EQ(receivedMessages.size(), 2u);
+    EXPECT_EQ(receivedMessages[0], "Before reload 1");
+    EXPECT_EQ(receivedMessages[1], "After  reload 2");
+}
+
+TEST(ConsoleAsyncTest, DroppedMessagesAreReported)
+{
+    for (const auto overflowPolicy : {Console::LogOverflowPolicy::DropNewest, Console::LogOverflowPolicy::DropOldest})
+    {
+        auto isSinkBlocked   = std::atomic<bool>(true);
+        auto receivedCount   = 0;
+        auto droppedWarnings = 0;
+
+        auto logStream = Console::LogStream(LogLevel::Log,
+                                            [&](LogLevel logLevel, const std::string& logMessage)
+                                            {
+                                                while (isSinkBlocked.load())
+                                                    std::this_thread::yield();
+
+                                                if (logLevel == LogLevel::Warning)
+                                                    ++droppedWarnings;
+                                                else
+                                                    ++receivedCount;
+                                            });
+
+        Console::EnableAsyncLogging({.queueCapacity = 4, .overflowPolicy = overflowPolicy});
+
+        for (auto i = 0; i < 32; ++i)
+            Console::LogError("Test {}", i);
+
+        isSinkBlocked = false;
+        Console::Flush();
+
+        EXPECT_LE(receivedCount, 5);
+        EXPECT_GE(droppedWarnings, 1);
+
+        Console::DisableAsyncLogging();
+    }
 }
 
 } // namespace Core
@@ -0,0 +1,93 @@
+#include <Engine/Core/DynamicLibrary.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+
+namespace Core
+{
+
+// These only report timings; they don't assert on them since the numbers depend entirely on the machine running them
+
+// The C runtime is a shared library on every platform, so calling into it crosses a module boundary the same way a
+// call from the Editor into the Engine does
+#if ADHOC_WINDOWS
+static constexpr auto runtimeLibraryName = "ucrtbase.dll";
+#elif ADHOC_MACOS
+static constexpr auto runtimeLibraryName = "/usr/lib/libSystem.B.dylib";
+#elif ADHOC_LINUX
+static constexpr auto runtimeLibraryName = "libc.so.6";
+#endif
+
+static constexpr int benchmarkIterations = 10000000;
+
+template <typename F>
+static double MeasureNanosecondsPerIteration(int iterations, F&& iteration)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+        iteration(i);
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+TEST(DynamicLibraryBenchmark, CallOverhead)
+{
+    auto library = DynamicLibrary(runtimeLibraryName);
+    ASSERT_TRUE(library.IsValid());
+
+    auto* const rawAbs     = library.GetFunctionPtr<long(long)>("labs");
+    const auto functionAbs = library.GetFunction<long(long)>("labs");
+    ASSERT_NE(rawAbs, nullptr);
+
+    // Summed so the calls can't be dropped, and fed the loop index so they can't be hoisted out of it
+    auto sum = long(0);
+
+    const auto functionNanoseconds =
+        MeasureNanosecondsPerIteration(benchmarkIterations, [&](int i) { sum += functionAbs(-i); });
+    const auto rawNanoseconds =
+        MeasureNanosecondsPerIteration(benchmarkIterations, [&](int i) { sum += rawAbs(-i); });
+
+    EXPECT_GT(sum, 0);
+    fmt::print("[ DynLib   ] call through std::function: {:>6.2f} ns, through raw pointer: {:>6.2f} ns\n",
+               functionNanoseconds,
+               rawNanoseconds);
+}
+
+TEST(DynamicLibraryBenchmark, LookupCost)
+{
+    static constexpr int lookupIterations = 100000;
+
+    auto library = DynamicLibrary(runtimeLibraryName);
+    ASSERT_TRUE(library.IsValid());
+
+    auto found = 0;
+
+    // Reloading empties the symbol cache, so every lookup after it goes through the library's export table
+    auto reloadedLibrary = DynamicLibrary();
+    const auto reload    = [&](int) { reloadedLibrary = library; };
+
+    const auto reloadAndLookUp = [&](int)
+    {
+        reloadedLibrary = library;
+        found += reloadedLibrary.GetFunctionPtr<long(long)>("labs") != nullptr;
+    };
+    const auto reloadNanoseconds   = MeasureNanosecondsPerIteration(lookupIterations / 100, reload);
+    const auto uncachedNanoseconds = MeasureNanosecondsPerIteration(lookupIterations / 100, reloadAndLookUp);
+
+    const auto cachedNanoseconds = MeasureNanosecondsPerIteration(
+        lookupIterations, [&](int) { found += library.GetFunctionPtr<long(long)>("labs") != nullptr; });
+    const auto functionNanoseconds = MeasureNanosecondsPerIteration(
+        lookupIterations, [&](int) { found += static_cast<bool>(library.GetFunction<long(long)>("labs")); });
+
+    EXPECT_EQ(found, lookupIterations / 100 + 2 * lookupIterations);
+    fmt::print("[ DynLib   ] lookup: {:>6.2f} ns uncached, {:>6.2f} ns cached, {:>6.2f} ns as a std::function\n",
+               uncachedNanoseconds - reloadNanoseconds,
+               cachedNanoseconds,
+               functionNanoseconds);
+}
+
+} // namespace Core
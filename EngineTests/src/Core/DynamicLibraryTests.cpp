@@ -0,0 +1,30 @@
+#include <Engine/Core/DynamicLibrary.h>
+
+#include <gtest/gtest.h>
+
+namespace Core
+{
+
+#if ADHOC_WINDOWS
+static constexpr auto runtimeLibraryName = "ucrtbase.dll";
+#elif ADHOC_MACOS
+static constexpr auto runtimeLibraryName = "/usr/lib/libSystem.B.dylib";
+#elif ADHOC_LINUX
+static constexpr auto runtimeLibraryName = "libc.so.6";
+#endif
+
+TEST(DynamicLibraryTest, LoadingAgainReplacesTheLoadedLibrary)
+{
+    auto library = DynamicLibrary(runtimeLibraryName);
+    ASSERT_TRUE(library.IsValid());
+    ASSERT_NE(library.GetFunctionPtr<long(long)>("labs"), nullptr);
+
+    library.Load("LibraryThatDoesNotExist");
+    EXPECT_FALSE(library.IsValid());
+
+    library.Load(runtimeLibraryName);
+    ASSERT_TRUE(library.IsValid());
+    EXPECT_NE(library.GetFunctionPtr<long(long)>("labs"), nullptr);
+}
+
+} // namespace Core
@@ -0,0 +1,167 @@
+#include <Engine/Core/Fiber.h>
+#include <Engine/Core/MiscMacros.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace Core
+{
+
+struct PingPongState
+{
+    Fiber threadFiber;
+    Fiber fiber;
+    std::vector<int> steps;
+};
+
+static void RunPingPongFiber(void* data)
+{
+    auto& state = *static_cast<PingPongState*>(data);
+    for (auto i = 0; i < 3; ++i)
+    {
+        state.steps.push_back(i * 2 + 1);
+        state.threadFiber.SwitchFrom(state.fiber);
+    }
+
+    state.steps.push_back(-1);
+    while (true)
+        state.threadFiber.SwitchFrom(state.fiber);
+}
+
+TEST(FiberTest, SwitchesBackAndForth)
+{
+    auto state = PingPongState();
+    ASSERT_TRUE(state.fiber.Create(RunPingPongFiber, &state, 64 * 1024));
+    ASSERT_TRUE(state.threadFiber.ConvertCurrentThread());
+    EXPECT_TRUE(state.fiber.IsValid());
+    EXPECT_GE(state.fiber.GetStackSize(), size_t(64 * 1024));
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        state.steps.push_back(i * 2);
+        state.fiber.SwitchFrom(state.threadFiber);
+    }
+
+    state.threadFiber.ConvertBackToThread();
+    EXPECT_EQ(state.steps, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, -1}));
+}
+
+TEST(FiberTest, CanBeCreatedAgain)
+{
+    auto state = PingPongState();
+    ASSERT_TRUE(state.fiber.Create(RunPingPongFiber, &state, 64 * 1024));
+    ASSERT_TRUE(state.fiber.Create(RunPingPongFiber, &state, 128 * 1024));
+    EXPECT_GE(state.fiber.GetStackSize(), size_t(128 * 1024));
+
+    // Starts from the beginning again on the new stack
+    ASSERT_TRUE(state.threadFiber.ConvertCurrentThread());
+    state.fiber.SwitchFrom(state.threadFiber);
+    state.threadFiber.ConvertBackToThread();
+    EXPECT_EQ(state.steps, (std::vector<int>{1}));
+}
+
+struct MigratingState
+{
+    Fiber fiber;
+    Fiber* returnFiber = nullptr;
+    std::thread::id firstThreadId;
+    std::thread::id secondThreadId;
+};
+
+/// pthread_self() is declared const, so the compiler may reuse one call's result across a switch to another thread.
+static NOINLINE std::thread::id GetThreadId()
+{
+    return std::this_thread::get_id();
+}
+
+static void RunMigratingFiber(void* data)
+{
+    auto& state         = *static_cast<MigratingState*>(data);
+    state.firstThreadId = GetThreadId();
+    state.returnFiber->SwitchFrom(state.fiber);
+
+    state.secondThreadId = GetThreadId();
+    while (true)
+        state.returnFiber->SwitchFrom(state.fiber);
+}
+
+TEST(FiberTest, ResumesOnAnotherThread)
+{
+    auto state = MigratingState();
+    ASSERT_TRUE(state.fiber.Create(RunMigratingFiber, &state));
+
+    const auto SwitchToFiber = [&]
+    {
+        auto threadFiber = Fiber();
+        threadFiber.ConvertCurrentThread();
+        state.returnFiber = &threadFiber;
+        state.fiber.SwitchFrom(threadFiber);
+        threadFiber.ConvertBackToThread();
+    };
+
+    // The first thread stays alive until the second is done, so that they can't have the same ID
+    auto isFirstSwitchDone  = std::atomic<bool>(false);
+    auto isSecondThreadDone = std::atomic<bool>(false);
+    auto firstThread        = std::thread(
+        [&]
+        {
+            SwitchToFiber();
+            isFirstSwitchDone.store(true);
+            while (!isSecondThreadDone.load())
+                std::this_thread::yield();
+        });
+    while (!isFirstSwitchDone.load())
+        std::this_thread::yield();
+
+    std::thread(SwitchToFiber).join();
+    isSecondThreadDone.store(true);
+
+    EXPECT_EQ(state.firstThreadId, firstThread.get_id());
+    firstThread.join();
+
+    EXPECT_NE(state.secondThreadId, std::thread::id());
+    EXPECT_NE(state.firstThreadId, state.secondThreadId);
+}
+
+static NOINLINE uint32_t UseStack(uint32_t depth)
+{
+    volatile char buffer[4096];
+    std::memset(const_cast<char*>(buffer), static_cast<int>(depth), sizeof(buffer));
+    return depth == 0 ? buffer[0] : UseStack(depth - 1) + buffer[depth % sizeof(buffer)];
+}
+
+struct OverflowState
+{
+    Fiber threadFiber;
+    Fiber fiber;
+    uint32_t depth = 0;
+};
+
+static void RunOverflowingFiber(void* data)
+{
+    auto& state = *static_cast<OverflowState*>(data);
+    state.depth = UseStack(state.depth);
+    while (true)
+        state.threadFiber.SwitchFrom(state.fiber);
+}
+
+static void OverflowFiberStack()
+{
+    auto state  = OverflowState();
+    state.depth = 64;
+    state.fiber.Create(RunOverflowingFiber, &state, 64 * 1024);
+    state.threadFiber.ConvertCurrentThread();
+    state.fiber.SwitchFrom(state.threadFiber);
+}
+
+TEST(FiberDeathTest, OverflowHitsTheGuardPage)
+{
+    EXPECT_DEATH(OverflowFiberStack(), "");
+}
+
+} // namespace Core
@@ -0,0 +1,102 @@
+#include <Engine/Core/FrameAllocator.h>
+#include <Engine/Core/Jobs.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Core
+{
+
+// These only report timings; they don't assert on them since the numbers depend entirely on the machine running them
+
+static constexpr int frameCount         = 20;
+static constexpr size_t objectsPerFrame = 100'000;
+
+/// A typical small per-frame object, e.g. a draw command.
+struct FrameObject
+{
+    float transform[12];
+    uint32_t meshIndex;
+    uint32_t materialIndex;
+};
+
+template <typename F>
+static double MeasureMillisecondsPerFrame(F&& runFrame)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto frame = 0; frame < frameCount; ++frame)
+        runFrame(frame);
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / frameCount;
+}
+
+TEST(FrameAllocatorBenchmark, SmallObjectsPerFrame)
+{
+    auto frameAllocator = Engine::FrameAllocator();
+    auto objects        = std::vector<FrameObject*>(objectsPerFrame);
+
+    const auto frameAllocatorMilliseconds = MeasureMillisecondsPerFrame(
+        [&](int frame)
+        {
+            frameAllocator.BeginFrame();
+            for (size_t i = 0; i < objectsPerFrame; ++i)
+                objects[i] = frameAllocator.New<FrameObject>(FrameObject{.meshIndex = static_cast<uint32_t>(frame)});
+        });
+
+    // The global allocator, which is mimalloc wherever the Engine overrides it
+    auto heapObjects            = std::vector<std::unique_ptr<FrameObject>>(objectsPerFrame);
+    const auto heapMilliseconds = MeasureMillisecondsPerFrame(
+        [&](int frame)
+        {
+            for (size_t i = 0; i < objectsPerFrame; ++i)
+                heapObjects[i] =
+                    std::make_unique<FrameObject>(FrameObject{.meshIndex = static_cast<uint32_t>(frame)});
+        });
+
+    const auto stats = frameAllocator.GetStats();
+    fmt::print("[ Frame    ] {} objects per frame: {:>6.2f} ms from the frame allocator, {:>6.2f} ms from the heap, "
+               "{} KiB high-water mark\n",
+               objectsPerFrame,
+               frameAllocatorMilliseconds,
+               heapMilliseconds,
+               stats.highWaterMark / 1024);
+}
+
+TEST(FrameAllocatorBenchmark, SmallObjectsPerFrameFromJobs)
+{
+    auto frameAllocator = Engine::FrameAllocator();
+    auto objects        = std::vector<FrameObject*>(objectsPerFrame);
+
+    Engine::Jobs::Initialize();
+    const auto milliseconds = MeasureMillisecondsPerFrame(
+        [&](int frame)
+        {
+            frameAllocator.BeginFrame();
+            Engine::Jobs::ParallelFor(objectsPerFrame,
+                                      4096,
+                                      [&](size_t begin, size_t end)
+                                      {
+                                          for (auto i = begin; i < end; ++i)
+                                          {
+                                              objects[i] = frameAllocator.New<FrameObject>(
+                                                  FrameObject{.meshIndex = static_cast<uint32_t>(frame)});
+                                          }
+                                      });
+        });
+    const auto workerThreadCount = Engine::Jobs::GetWorkerThreadCount();
+    Engine::Jobs::Shutdown();
+
+    fmt::print("[ Frame    ] {} objects per frame: {:>6.2f} ms from the frame allocator on {} workers and the main "
+               "thread\n",
+               objectsPerFrame,
+               milliseconds,
+               workerThreadCount);
+}
+
+} // namespace Core
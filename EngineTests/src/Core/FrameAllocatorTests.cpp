@@ -0,0 +1,169 @@
+#include <Engine/Core/Console.h>
+#include <Engine/Core/FrameAllocator.h>
+#include <Engine/Core/Jobs.h>
+#include <Engine/Core/VirtualMemory.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace Core
+{
+
+using Engine::FrameAllocator;
+
+TEST(VirtualMemoryTest, CommitsAndDecommitsInPlace)
+{
+    auto memory = VirtualMemory();
+    ASSERT_TRUE(memory.Reserve(16 * 1024 * 1024));
+    EXPECT_GE(memory.GetReservedSize(), size_t(16 * 1024 * 1024));
+    EXPECT_EQ(memory.GetCommittedSize(), 0u);
+
+    auto* data = memory.GetData();
+    ASSERT_TRUE(memory.Commit(100));
+    EXPECT_GE(memory.GetCommittedSize(), 100u);
+    EXPECT_EQ(static_cast<int>(data[99]), 0);
+    std::memset(data, 0xAB, 100);
+
+    // Growing keeps what was already committed where it was
+    ASSERT_TRUE(memory.Commit(4 * 1024 * 1024));
+    EXPECT_EQ(memory.GetData(), data);
+    EXPECT_EQ(static_cast<int>(data[0]), 0xAB);
+    data[4 * 1024 * 1024 - 1] = std::byte(1);
+
+    memory.Decommit(0);
+    EXPECT_EQ(memory.GetCommittedSize(), 0u);
+
+    // Recommitted memory starts out zeroed again
+    ASSERT_TRUE(memory.Commit(100));
+    EXPECT_EQ(static_cast<int>(data[0]), 0);
+
+    EXPECT_FALSE(memory.Commit(memory.GetReservedSize() + 1));
+}
+
+TEST(FrameAllocatorTest, AllocatesAligned)
+{
+    auto frameAllocator = FrameAllocator(16 * 1024 * 1024);
+    ASSERT_TRUE(frameAllocator.IsValid());
+    frameAllocator.BeginFrame();
+
+    frameAllocator.Allocate(1, 1);
+    for (const size_t alignment : {1, 2, 8, 16, 64, 4096})
+    {
+        auto* memory = frameAllocator.Allocate(3, alignment);
+        ASSERT_NE(memory, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % alignment, 0u) << "alignment " << alignment;
+    }
+
+    struct Point
+    {
+        float x;
+        float y;
+    };
+    auto* point = frameAllocator.New<Point>(1.0f, 2.0f);
+    ASSERT_NE(point, nullptr);
+    EXPECT_EQ(point->y, 2.0f);
+
+    // Bigger than a thread's block
+    auto values = frameAllocator.AllocateArray<uint32_t>(FrameAllocator::threadBlockSize);
+    ASSERT_EQ(values.size(), FrameAllocator::threadBlockSize);
+    std::fill(values.begin(), values.end(), 7u);
+}
+
+TEST(FrameAllocatorTest, KeepsMemoryForFramesInFlight)
+{
+    auto frameAllocator = FrameAllocator(16 * 1024 * 1024);
+
+    auto frameMemory = std::vector<int*>();
+    for (uint32_t frame = 0; frame < FrameAllocator::framesInFlight + 1; ++frame)
+    {
+        frameAllocator.BeginFrame();
+        frameMemory.push_back(frameAllocator.New<int>(static_cast<int>(frame)));
+    }
+
+    // The previous frame's memory is still intact, while the oldest frame's range has come around again
+    EXPECT_EQ(*frameMemory[FrameAllocator::framesInFlight - 1], static_cast<int>(FrameAllocator::framesInFlight - 1));
+    EXPECT_NE(frameMemory[0], frameMemory[1]);
+    EXPECT_EQ(frameMemory[0], frameMemory[FrameAllocator::framesInFlight]);
+}
+
+TEST(FrameAllocatorTest, ReportsHighWaterMarks)
+{
+    auto frameAllocator = FrameAllocator(16 * 1024 * 1024);
+
+    frameAllocator.BeginFrame();
+    frameAllocator.Allocate(3 * FrameAllocator::threadBlockSize);
+
+    frameAllocator.BeginFrame();
+    frameAllocator.Allocate(100);
+
+    frameAllocator.BeginFrame();
+    const auto stats = frameAllocator.GetStats();
+    EXPECT_EQ(stats.previousFrameBytesUsed, FrameAllocator::threadBlockSize);
+    EXPECT_GE(stats.highWaterMark, 3 * FrameAllocator::threadBlockSize);
+    EXPECT_LT(stats.highWaterMark, 4 * FrameAllocator::threadBlockSize);
+    EXPECT_GE(stats.committedBytes, stats.highWaterMark);
+    EXPECT_GE(stats.reservedBytes, size_t(2 * 16 * 1024 * 1024));
+}
+
+TEST(FrameAllocatorTest, FailsOnceTheFrameIsFull)
+{
+    auto frameAllocator = FrameAllocator(1024 * 1024);
+    frameAllocator.BeginFrame();
+
+    EXPECT_NE(frameAllocator.Allocate(512 * 1024), nullptr);
+    EXPECT_EQ(frameAllocator.Allocate(1024 * 1024), nullptr);
+}
+
+TEST(FrameAllocatorTest, ReportsRunningOutOnceAFrame)
+{
+    auto errorCount = 0;
+    auto logStream  = Engine::Console::LogStream(Engine::Console::LogLevel::Error,
+                                                [&](Engine::Console::LogLevel, std::string_view) { ++errorCount; });
+
+    auto frameAllocator = FrameAllocator(1024 * 1024);
+    for (auto frame = 0; frame < 2; ++frame)
+    {
+        frameAllocator.BeginFrame();
+        for (auto i = 0; i < 4; ++i)
+            EXPECT_EQ(frameAllocator.Allocate(2 * 1024 * 1024), nullptr);
+    }
+
+    Engine::Console::Flush();
+    EXPECT_EQ(errorCount, 2);
+}
+
+TEST(FrameAllocatorTest, AllocatesFromJobsWithoutOverlapping)
+{
+    static constexpr size_t allocationCount = 20000;
+    static constexpr size_t allocationSize  = 48;
+
+    auto frameAllocator = FrameAllocator(64 * 1024 * 1024);
+    frameAllocator.BeginFrame();
+
+    auto allocations = std::vector<std::byte*>(allocationCount);
+
+    Engine::Jobs::Initialize(3);
+    Engine::Jobs::ParallelFor(allocationCount,
+                              100,
+                              [&](size_t begin, size_t end)
+                              {
+                                  for (auto i = begin; i < end; ++i)
+                                  {
+                                      allocations[i] =
+                                          static_cast<std::byte*>(frameAllocator.Allocate(allocationSize, 16));
+                                      std::memset(allocations[i], static_cast<int>(i & 0xFF), allocationSize);
+                                  }
+                              });
+    Engine::Jobs::Shutdown();
+
+    std::sort(allocations.begin(), allocations.end());
+    for (size_t i = 1; i < allocationCount; ++i)
+        ASSERT_GE(allocations[i], allocations[i - 1] + allocationSize) << "allocation " << i;
+}
+
+} // namespace Core
@@ -0,0 +1,51 @@
+#include <Engine/Core/FrameScheduler.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace Core
+{
+
+using namespace std::chrono_literals;
+
+using Clock = Engine::FrameScheduler::Clock;
+
+// These only report timings; they don't assert on them since the numbers depend entirely on the machine running them
+
+/// Sleep until sleepTime from now, the given way, and report how late it woke up.
+template <typename F>
+static void ReportWakeUpLateness(std::string_view name, F&& sleepUntil)
+{
+    static constexpr int sleepIterations = 100;
+    static constexpr auto sleepTime      = 2ms;
+
+    auto latenesses = std::vector<double>();
+    for (auto i = 0; i < sleepIterations; ++i)
+    {
+        const auto deadline = Clock::now() + sleepTime;
+        sleepUntil(deadline);
+        latenesses.push_back(std::chrono::duration<double, std::micro>(Clock::now() - deadline).count());
+    }
+
+    std::sort(latenesses.begin(), latenesses.end());
+    fmt::print("[ Frame    ] {:<14} woke up late by {:>8.1f} us median, {:>8.1f} us p99\n",
+               name,
+               latenesses[latenesses.size() / 2],
+               latenesses[latenesses.size() * 99 / 100]);
+}
+
+TEST(FrameSchedulerBenchmark, WakeUpLateness)
+{
+    ReportWakeUpLateness("sleep_until", [](Clock::time_point deadline) { std::this_thread::sleep_until(deadline); });
+
+    auto frameScheduler = Engine::FrameScheduler();
+    ReportWakeUpLateness("hybrid sleep",
+                         [&](Clock::time_point deadline) { frameScheduler.PreciseSleepUntil(deadline); });
+}
+
+} // namespace Core
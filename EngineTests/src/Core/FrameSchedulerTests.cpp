@@ -0,0 +1,122 @@
+#include <Engine/Core/FrameScheduler.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace Core
+{
+
+using namespace std::chrono_literals;
+
+using Clock = Engine::FrameScheduler::Clock;
+
+TEST(FrameSchedulerTest, StepsSimulationAtFixedTimestep)
+{
+    auto frameScheduler = Engine::FrameScheduler();
+    frameScheduler.SetPacingMode(Engine::FramePacingMode::Uncapped);
+    frameScheduler.SetFixedTimestep(10ms);
+
+    auto frameTime = Clock::now();
+    frameScheduler.RecordFrameStart(frameTime);
+    while (frameScheduler.StepSimulation()) {}
+
+    // 25 ms is two whole steps, with half a step left over
+    frameTime += 25ms;
+    frameScheduler.RecordFrameStart(frameTime);
+
+    auto stepCount = 0;
+    while (frameScheduler.StepSimulation())
+        ++stepCount;
+
+    EXPECT_EQ(stepCount, 2);
+    EXPECT_DOUBLE_EQ(frameScheduler.GetInterpolationAlpha(), 0.5);
+
+    // The leftover carries over into the next frame
+    frameTime += 5ms;
+    frameScheduler.RecordFrameStart(frameTime);
+    EXPECT_TRUE(frameScheduler.StepSimulation());
+    EXPECT_FALSE(frameScheduler.StepSimulation());
+}
+
+TEST(FrameSchedulerTest, LimitsCatchUpSteps)
+{
+    auto frameScheduler = Engine::FrameScheduler();
+    frameScheduler.SetPacingMode(Engine::FramePacingMode::Uncapped);
+    frameScheduler.SetFixedTimestep(10ms);
+
+    auto frameTime = Clock::now();
+    frameScheduler.RecordFrameStart(frameTime);
+    while (frameScheduler.StepSimulation()) {}
+
+    frameTime += 1s;
+    frameScheduler.RecordFrameStart(frameTime);
+
+    auto stepCount = 0u;
+    while (frameScheduler.StepSimulation())
+        ++stepCount;
+
+    EXPECT_EQ(stepCount, Engine::FrameScheduler::maxFixedStepsPerFrame);
+
+    // Waking up from an idle wait simulates a single step at most
+    frameScheduler.SetPacingMode(Engine::FramePacingMode::BlockingIdle);
+    frameTime += 1s;
+    frameScheduler.RecordFrameStart(frameTime);
+
+    stepCount = 0;
+    while (frameScheduler.StepSimulation())
+        ++stepCount;
+
+    EXPECT_EQ(stepCount, 1u);
+}
+
+TEST(FrameSchedulerTest, ReportsFrameTimeStats)
+{
+    auto frameScheduler = Engine::FrameScheduler();
+
+    // 99 frames of 10 ms and one of 50 ms
+    auto frameTime = Clock::now();
+    frameScheduler.RecordFrameStart(frameTime);
+    for (auto frame = 0; frame < 100; ++frame)
+    {
+        frameTime += frame == 50 ? 50ms : 10ms;
+        frameScheduler.RecordFrameStart(frameTime);
+    }
+
+    const auto stats = frameScheduler.GetTimingStats();
+    EXPECT_DOUBLE_EQ(stats.minFrameMilliseconds, 10.0);
+    EXPECT_DOUBLE_EQ(stats.maxFrameMilliseconds, 50.0);
+    EXPECT_DOUBLE_EQ(stats.averageFrameMilliseconds, 10.4);
+    EXPECT_DOUBLE_EQ(stats.p99FrameMilliseconds, 10.0);
+    EXPECT_EQ(stats.frameCount, 101u);
+}
+
+TEST(FrameSchedulerTest, PacesFixedRateFrames)
+{
+    static constexpr auto frameCount = 20;
+
+    auto frameScheduler = Engine::FrameScheduler();
+    frameScheduler.SetPacingMode(Engine::FramePacingMode::FixedRate);
+    frameScheduler.SetTargetFrameRate(500.0);
+
+    frameScheduler.BeginFrame();
+    const auto startTime = Clock::now();
+    for (auto frame = 0; frame < frameCount; ++frame)
+        frameScheduler.BeginFrame();
+
+    // Frames are due at fixed times, so however late any one of them starts, they can't run ahead of the schedule
+    EXPECT_GE(Clock::now() - startTime, (frameCount - 1) * frameScheduler.GetTargetFrameTime());
+}
+
+TEST(FrameSchedulerTest, PreciseSleepNeverWakesEarly)
+{
+    auto frameScheduler = Engine::FrameScheduler();
+    for (auto i = 0; i < 10; ++i)
+    {
+        const auto deadline = Clock::now() + 2500us;
+        frameScheduler.PreciseSleepUntil(deadline);
+        EXPECT_GE(Clock::now(), deadline);
+    }
+}
+
+} // namespace Core
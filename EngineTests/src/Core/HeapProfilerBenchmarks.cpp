@@ -0,0 +1,93 @@
+#include <Engine/Core/HeapProfiler.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Core
+{
+
+// These only report timings; they don't assert on them since the numbers depend entirely on the machine running them
+
+/// Something like a frame's worth of editor work: building up strings, containers and a map of them, with some work on
+/// what's in them between allocations.
+static size_t RunAllocatingWorkload(uint32_t seed)
+{
+    auto items = std::map<std::string, std::vector<uint32_t>>();
+    auto state = seed | 1u;
+    for (auto i = 0; i < 2000; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        auto& values = items[fmt::format("Item {}", state % 500)];
+        for (uint32_t j = 0; j < state % 64; ++j)
+            values.push_back(state + j);
+        std::sort(values.begin(), values.end());
+    }
+
+    auto total = size_t(0);
+    for (const auto& [name, values] : items)
+        total += name.size() + values.size();
+    return total;
+}
+
+template <typename F>
+static double MeasureMilliseconds(int iterationCount, F&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterationCount; ++i)
+        function(i);
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+TEST(HeapProfilerBenchmark, Overhead)
+{
+    static constexpr int roundCount     = 10;
+    static constexpr int iterationCount = 20;
+
+    auto sink           = size_t(0);
+    const auto workload = [&](int i) { sink += RunAllocatingWorkload(static_cast<uint32_t>(i)); };
+
+    // Warms up the heap, so that neither run pays for growing it
+    MeasureMilliseconds(iterationCount, workload);
+
+    // Alternates between the two and keeps the fastest round of each, to leave out whatever else the machine was doing
+    const auto tag           = Engine::HeapProfiler::RegisterTag("Benchmark");
+    auto stoppedMilliseconds = std::numeric_limits<double>::max();
+    auto runningMilliseconds = std::numeric_limits<double>::max();
+    auto callSiteCount       = size_t(0);
+    for (auto round = 0; round < roundCount; ++round)
+    {
+        stoppedMilliseconds = std::min(stoppedMilliseconds, MeasureMilliseconds(iterationCount, workload));
+
+        Engine::HeapProfiler::Start();
+        {
+            auto tagScope       = Engine::HeapProfiler::TagScope(tag);
+            runningMilliseconds = std::min(runningMilliseconds, MeasureMilliseconds(iterationCount, workload));
+        }
+        callSiteCount = Engine::HeapProfiler::TakeSnapshot().callSites.size();
+        Engine::HeapProfiler::Stop();
+    }
+
+    fmt::print("[ Heap     ] Allocating workload: {:>7.2f} ms stopped, {:>7.2f} ms running ({:+.1f}%), sampling 1 in {} "
+               "allocations at {} call sites\n",
+               stoppedMilliseconds,
+               runningMilliseconds,
+               100.0 * (runningMilliseconds / stoppedMilliseconds - 1.0),
+               Engine::HeapProfiler::HeapProfilerOptions().stackSampleInterval,
+               callSiteCount);
+    EXPECT_GT(sink, 0u);
+}
+
+} // namespace Core
@@ -0,0 +1,205 @@
+#include <Engine/Core/BacktraceSymbolHandler.h>
+#include <Engine/Core/HeapProfiler.h>
+#include <Engine/Core/MiscMacros.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace HeapProfiler = Engine::HeapProfiler;
+
+namespace Core
+{
+
+/// Stops the profiler however the test ends, so that the rest of the tests run without it.
+class HeapProfilerTest : public testing::Test
+{
+protected:
+    ~HeapProfilerTest() override { HeapProfiler::Stop(); }
+};
+
+static HeapProfiler::HeapUsage GetTagUsage(const HeapProfiler::HeapSnapshot& snapshot, HeapProfiler::TagId tag)
+{
+    const auto found = std::find_if(
+        snapshot.tags.begin(), snapshot.tags.end(), [&](const auto& tagUsage) { return tagUsage.tag == tag; });
+    return found != snapshot.tags.end() ? found->usage : HeapProfiler::HeapUsage();
+}
+
+TEST_F(HeapProfilerTest, RegistersTagsByName)
+{
+    const auto tag = HeapProfiler::RegisterTag("Registered tag");
+    EXPECT_NE(tag, HeapProfiler::untaggedTag);
+    EXPECT_EQ(HeapProfiler::RegisterTag("Registered tag"), tag);
+    EXPECT_NE(HeapProfiler::RegisterTag("Other registered tag"), tag);
+    EXPECT_STREQ(HeapProfiler::GetTagName(tag), "Registered tag");
+}
+
+TEST_F(HeapProfilerTest, CountsLiveAndPeakBytesByTag)
+{
+    const auto outerTag = HeapProfiler::RegisterTag("Outer tag");
+    const auto innerTag = HeapProfiler::RegisterTag("Inner tag");
+
+    auto blocks = std::vector<std::unique_ptr<char[]>>();
+    blocks.reserve(15);
+
+    HeapProfiler::Start();
+    {
+        auto outerScope = HeapProfiler::TagScope(outerTag);
+        for (auto i = 0; i < 10; ++i)
+            blocks.push_back(std::make_unique<char[]>(100));
+
+        {
+            auto innerScope = HeapProfiler::TagScope(innerTag);
+            for (auto i = 0; i < 5; ++i)
+                blocks.push_back(std::make_unique<char[]>(1000));
+        }
+    }
+
+    auto snapshot = HeapProfiler::TakeSnapshot();
+    EXPECT_EQ(GetTagUsage(snapshot, outerTag).liveBytes, 1000);
+    EXPECT_EQ(GetTagUsage(snapshot, outerTag).liveCount, 10);
+    EXPECT_EQ(GetTagUsage(snapshot, innerTag).liveBytes, 5000);
+    EXPECT_EQ(GetTagUsage(snapshot, innerTag).liveCount, 5);
+
+    // Sorted by live bytes
+    ASSERT_GE(snapshot.tags.size(), 2u);
+    for (size_t i = 1; i < snapshot.tags.size(); ++i)
+        EXPECT_GE(snapshot.tags[i - 1].usage.liveBytes, snapshot.tags[i].usage.liveBytes);
+
+    blocks.resize(5);
+    snapshot = HeapProfiler::TakeSnapshot();
+    EXPECT_EQ(GetTagUsage(snapshot, outerTag).liveBytes, 500);
+    EXPECT_EQ(GetTagUsage(snapshot, outerTag).peakBytes, 1000);
+    EXPECT_EQ(GetTagUsage(snapshot, innerTag).liveBytes, 0);
+    EXPECT_EQ(GetTagUsage(snapshot, innerTag).peakBytes, 5000);
+}
+
+TEST_F(HeapProfilerTest, IgnoresBlocksFromBeforeItStarted)
+{
+    const auto tag = HeapProfiler::RegisterTag("Earlier tag");
+
+    HeapProfiler::Start();
+    auto tagScope     = HeapProfiler::TagScope(tag);
+    auto earlierBlock = std::make_unique<uint64_t>(1);
+
+    // Restarting forgets it, and doesn't count it going away either
+    HeapProfiler::Start();
+    auto block = std::make_unique<uint64_t>(2);
+    earlierBlock.reset();
+
+    const auto usage = GetTagUsage(HeapProfiler::TakeSnapshot(), tag);
+    EXPECT_EQ(usage.liveCount, 1);
+    EXPECT_EQ(usage.liveBytes, static_cast<int64_t>(sizeof(uint64_t)));
+}
+
+TEST_F(HeapProfilerTest, AllocatesAligned)
+{
+    for (const size_t alignment : {1, 8, 16, 64, 4096})
+    {
+        void* memory = HeapProfiler::Allocate(10, alignment);
+        ASSERT_NE(memory, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % alignment, 0u) << "alignment " << alignment;
+        HeapProfiler::Free(memory);
+    }
+
+    struct alignas(128) OverAligned
+    {
+        int value;
+    };
+    auto overAligned = std::make_unique<OverAligned>();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(overAligned.get()) % 128, 0u);
+}
+
+struct LeakedObject
+{
+    std::array<uint64_t, 8> payload;
+};
+
+/// Allocates four objects and frees three of them, keeping the other one in leakedObjects.
+NOINLINE static void RunLeakyWorkload(std::vector<std::unique_ptr<LeakedObject>>& leakedObjects)
+{
+    auto objects = std::array<std::unique_ptr<LeakedObject>, 4>();
+    for (auto& object : objects)
+        object = std::make_unique<LeakedObject>();
+
+    leakedObjects.push_back(std::move(objects[2]));
+}
+
+TEST_F(HeapProfilerTest, DiffsFindLeakingCallSites)
+{
+    static constexpr size_t iterationCount = 1000;
+
+    auto symbolHandler = Engine::BacktraceSymbolHandler();
+    const auto tag     = HeapProfiler::RegisterTag("Leaky workload");
+
+    auto leakedObjects = std::vector<std::unique_ptr<LeakedObject>>();
+    leakedObjects.reserve(2 * iterationCount);
+
+    HeapProfiler::Start({.stackSampleInterval = 1});
+    {
+        // Warms up, so that whatever the workload allocates once isn't part of the diff
+        auto tagScope = HeapProfiler::TagScope(tag);
+        RunLeakyWorkload(leakedObjects);
+    }
+
+    const auto before = HeapProfiler::TakeSnapshot();
+    {
+        auto tagScope = HeapProfiler::TagScope(tag);
+        for (size_t i = 0; i < iterationCount; ++i)
+            RunLeakyWorkload(leakedObjects);
+    }
+    const auto after = HeapProfiler::TakeSnapshot();
+
+    const auto diff = HeapProfiler::DiffSnapshots(before, after);
+    EXPECT_EQ(GetTagUsage(diff, tag).liveCount, static_cast<int64_t>(iterationCount));
+    EXPECT_EQ(GetTagUsage(diff, tag).liveBytes, static_cast<int64_t>(iterationCount * sizeof(LeakedObject)));
+
+    // Every object comes from the same call site, which only grew by the leaked ones
+    ASSERT_FALSE(diff.callSites.empty());
+    const auto& leakingCallSite = diff.callSites.front();
+    EXPECT_EQ(leakingCallSite.tag, tag);
+    EXPECT_EQ(leakingCallSite.usage.liveCount, static_cast<int64_t>(iterationCount));
+
+    const auto text = HeapProfiler::FormatSnapshot(diff);
+    EXPECT_NE(text.find("Leaky workload"), std::string::npos) << text;
+    EXPECT_NE(text.find("LeakedObject"), std::string::npos) << text;
+
+    // Freeing them shows up as the call site shrinking again
+    leakedObjects.clear();
+    const auto freedDiff = HeapProfiler::DiffSnapshots(after, HeapProfiler::TakeSnapshot());
+    EXPECT_EQ(GetTagUsage(freedDiff, tag).liveCount, -static_cast<int64_t>(iterationCount + 1));
+}
+
+TEST_F(HeapProfilerTest, ScalesUpSampledCallSites)
+{
+    static constexpr uint32_t sampleInterval = 16;
+    static constexpr size_t objectCount      = 100 * sampleInterval;
+
+    auto objects = std::vector<std::unique_ptr<LeakedObject>>();
+    objects.reserve(objectCount);
+
+    HeapProfiler::Start({.stackSampleInterval = sampleInterval});
+    const auto tag = HeapProfiler::RegisterTag("Sampled");
+    {
+        auto tagScope = HeapProfiler::TagScope(tag);
+        for (size_t i = 0; i < objectCount; ++i)
+            objects.push_back(std::make_unique<LeakedObject>());
+    }
+
+    const auto snapshot = HeapProfiler::TakeSnapshot();
+    EXPECT_EQ(snapshot.stackSampleInterval, sampleInterval);
+
+    const auto callSite = std::find_if(snapshot.callSites.begin(),
+                                       snapshot.callSites.end(),
+                                       [&](const auto& callSiteUsage) { return callSiteUsage.tag == tag; });
+    ASSERT_NE(callSite, snapshot.callSites.end());
+    EXPECT_EQ(callSite->usage.liveCount, static_cast<int64_t>(objectCount));
+    EXPECT_EQ(callSite->usage.liveBytes, static_cast<int64_t>(objectCount * sizeof(LeakedObject)));
+}
+
+} // namespace Core
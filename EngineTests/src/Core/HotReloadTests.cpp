@@ -0,0 +1,161 @@
+#include <Engine/Core/FileWatcher.h>
+#include <Engine/Core/HotReload.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace Core
+{
+
+struct TestSubsystemState
+{
+    int counter  = 0;
+    float scale  = 1.0f;
+    bool enabled = false;
+};
+
+static TestSubsystemState testSubsystemState;
+
+static void SaveTestSubsystem(std::vector<std::byte>& data)
+{
+    Engine::WriteReloadValue(data, testSubsystemState);
+}
+
+static bool RestoreTestSubsystem(std::span<const std::byte> data)
+{
+    return Engine::ReadReloadValue(data, testSubsystemState);
+}
+
+static constexpr auto testHook = Engine::ReloadHook{.name    = "TestSubsystem",
+                                                    .version = 1,
+                                                    .save    = SaveTestSubsystem,
+                                                    .restore = RestoreTestSubsystem};
+
+TEST(HotReloadTest, HandsStateToTheReloadedModule)
+{
+    testSubsystemState = TestSubsystemState{.counter = 42, .scale = 0.5f, .enabled = true};
+
+    auto state = Engine::ReloadState();
+    {
+        const auto oldModuleHook = Engine::ScopedReloadHook(testHook);
+        state                    = Engine::SaveReloadState();
+    }
+
+    // The reloaded module starts over from its defaults, then gets its state back once it has registered its hook
+    testSubsystemState = TestSubsystemState();
+    EXPECT_EQ(Engine::RestoreReloadState(state), 0u);
+    EXPECT_EQ(testSubsystemState.counter, 0);
+
+    const auto newModuleHook = Engine::ScopedReloadHook(testHook);
+    EXPECT_EQ(Engine::RestoreReloadState(state), 1u);
+    EXPECT_EQ(testSubsystemState.counter, 42);
+    EXPECT_EQ(testSubsystemState.scale, 0.5f);
+    EXPECT_TRUE(testSubsystemState.enabled);
+}
+
+TEST(HotReloadTest, DropsStateSavedByAnotherVersion)
+{
+    testSubsystemState = TestSubsystemState{.counter = 42};
+
+    auto state = Engine::ReloadState();
+    {
+        const auto oldModuleHook = Engine::ScopedReloadHook(testHook);
+        state                    = Engine::SaveReloadState();
+    }
+
+    testSubsystemState = TestSubsystemState();
+
+    auto changedHook         = testHook;
+    changedHook.version      = 2;
+    const auto newModuleHook = Engine::ScopedReloadHook(changedHook);
+    EXPECT_EQ(Engine::RestoreReloadState(state), 0u);
+    EXPECT_EQ(testSubsystemState.counter, 0);
+}
+
+TEST(HotReloadTest, RejectsTruncatedState)
+{
+    const auto hook = Engine::ScopedReloadHook(testHook);
+
+    auto state = Engine::SaveReloadState();
+    ASSERT_EQ(state.size(), 1u);
+    state[0].data.resize(state[0].data.size() / 2);
+
+    EXPECT_EQ(Engine::RestoreReloadState(state), 0u);
+}
+
+TEST(HotReloadTest, ReloadRequestsCanComeFromAnyThread)
+{
+    Engine::ClearReloadRequest();
+    EXPECT_FALSE(Engine::IsReloadRequested());
+
+    auto requestingThread = std::thread(Engine::RequestReload);
+    requestingThread.join();
+    EXPECT_TRUE(Engine::IsReloadRequested());
+
+    Engine::ClearReloadRequest();
+    EXPECT_FALSE(Engine::IsReloadRequested());
+}
+
+static void WriteFile(const fs::path& path, std::string_view contents)
+{
+    auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+    file << contents;
+}
+
+template <typename F>
+static bool WaitFor(F&& condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+TEST(FileWatcherTest, ReportsRewrittenAndReplacedFiles)
+{
+    const auto directory = fs::temp_directory_path() / "AdHocFileWatcherTest";
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+
+    const auto watchedPath = directory / "Watched.bin";
+    WriteFile(watchedPath, "first build");
+
+    auto changeCount = std::atomic<int>(0);
+    auto watcher     = FileWatcher();
+    ASSERT_TRUE(watcher.Start(watchedPath, [&] { ++changeCount; }));
+    ASSERT_TRUE(watcher.IsValid());
+
+    // Other files in the same directory don't count
+    WriteFile(directory / "Unrelated.bin", "unrelated");
+    std::this_thread::sleep_for(BaseFileWatcher::settleTime * 3);
+    EXPECT_EQ(changeCount.load(), 0);
+
+    // Rewritten in place, e.g. by an incremental link. Bursts of writes settle into one change.
+    for (auto i = 0; i < 3; ++i)
+        WriteFile(watchedPath, "second build, written in several parts");
+    EXPECT_TRUE(WaitFor([&] { return changeCount.load() == 1; }));
+
+    // Written elsewhere and renamed over it, like most linkers do
+    WriteFile(directory / "Watched.tmp", "third build, which is a different size");
+    fs::rename(directory / "Watched.tmp", watchedPath);
+    EXPECT_TRUE(WaitFor([&] { return changeCount.load() == 2; }));
+
+    watcher.Stop();
+    EXPECT_FALSE(watcher.IsValid());
+
+    fs::remove_all(directory);
+}
+
+} // namespace Core
@@ -0,0 +1,193 @@
+#include <Engine/Core/Fiber.h>
+#include <Engine/Core/Jobs.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace Jobs = Engine::Jobs;
+
+namespace Core
+{
+
+// These only report timings; they don't assert on them since the numbers depend entirely on the machine running them
+
+template <typename F>
+static double MeasureMilliseconds(F&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+TEST(JobsBenchmark, ParallelFor)
+{
+    static constexpr size_t elementCount = 10'000'000;
+    static constexpr size_t batchSize    = 16 * 1024;
+
+    auto values = std::vector<float>(elementCount, 2.0f);
+
+    const auto Transform = [&](size_t begin, size_t end)
+    {
+        for (auto i = begin; i < end; ++i)
+            values[i] = std::sqrt(values[i] * 1.5f + 1.0f);
+    };
+
+    const auto serialMilliseconds = MeasureMilliseconds([&] { Transform(0, elementCount); });
+
+    Jobs::Initialize();
+    const auto parallelMilliseconds =
+        MeasureMilliseconds([&] { Jobs::ParallelFor(elementCount, batchSize, Transform); });
+    const auto workerThreadCount = Jobs::GetWorkerThreadCount();
+    Jobs::Shutdown();
+
+    fmt::print("[ Jobs     ] {} elements: {:>8.2f} ms serial, {:>8.2f} ms on {} workers and the main thread\n",
+               elementCount,
+               serialMilliseconds,
+               parallelMilliseconds,
+               workerThreadCount);
+}
+
+TEST(JobsBenchmark, FanOutFanIn)
+{
+    static constexpr int graphCount  = 1000;
+    static constexpr int fanOutCount = 64;
+
+    static std::atomic<int> finishedCount = 0;
+    const auto leafJob    = Jobs::JobDeclaration{.function = [](void*) { finishedCount.fetch_add(1); }};
+    auto leafDeclarations = std::vector<Jobs::JobDeclaration>(fanOutCount, leafJob);
+
+    Jobs::Initialize();
+    const auto milliseconds = MeasureMilliseconds(
+        [&]
+        {
+            for (auto graph = 0; graph < graphCount; ++graph)
+            {
+                auto leafCounter = Jobs::JobCounter();
+                auto joinCounter = Jobs::JobCounter();
+                Jobs::Run(leafDeclarations, &leafCounter);
+                Jobs::RunAfter(leafCounter, std::span(&leafJob, 1), &joinCounter);
+                Jobs::WaitFor(joinCounter);
+            }
+        });
+    Jobs::Shutdown();
+
+    EXPECT_EQ(finishedCount.load(), graphCount * (fanOutCount + 1));
+    fmt::print("[ Jobs     ] fan-out of {} and fan-in: {:>8.2f} us per graph, {:>6.0f} ns per job\n",
+               fanOutCount,
+               milliseconds * 1000.0 / graphCount,
+               milliseconds * 1e6 / (graphCount * (fanOutCount + 1)));
+}
+
+struct SwitchState
+{
+    Fiber threadFiber;
+    Fiber fiber;
+};
+
+static void RunSwitchFiber(void* data)
+{
+    auto& state = *static_cast<SwitchState*>(data);
+    while (true)
+        state.threadFiber.SwitchFrom(state.fiber);
+}
+
+TEST(JobsBenchmark, FiberSwitch)
+{
+    static constexpr int switchCount = 1'000'000;
+
+    auto state = SwitchState();
+    state.fiber.Create(RunSwitchFiber, &state);
+    state.threadFiber.ConvertCurrentThread();
+
+    const auto milliseconds = MeasureMilliseconds(
+        [&]
+        {
+            for (auto i = 0; i < switchCount; ++i)
+                state.fiber.SwitchFrom(state.threadFiber);
+        });
+    state.threadFiber.ConvertBackToThread();
+
+    // Each iteration switches there and back
+    fmt::print("[ Jobs     ] fiber switch: {:>6.1f} ns\n", milliseconds * 1e6 / (switchCount * 2));
+}
+
+struct WaitChainLink
+{
+    int depth;
+};
+
+static void RunWaitChainLink(void* data)
+{
+    const auto& link = *static_cast<WaitChainLink*>(data);
+    if (link.depth == 0)
+        return;
+
+    auto nextLink = WaitChainLink{.depth = link.depth - 1};
+    auto counter  = Jobs::JobCounter();
+    Jobs::Run(Jobs::JobDeclaration{.function = RunWaitChainLink, .data = &nextLink}, &counter);
+    Jobs::WaitFor(counter);
+}
+
+TEST(JobsBenchmark, WaitChain)
+{
+    static constexpr int chainCount = 64;
+    static constexpr int chainDepth = 64;
+
+    auto chains       = std::vector<WaitChainLink>(chainCount, {.depth = chainDepth});
+    auto declarations = std::vector<Jobs::JobDeclaration>();
+    for (auto& chain : chains)
+        declarations.push_back({.function = RunWaitChainLink, .data = &chain});
+
+    const auto MeasureChains = [&](const Jobs::JobSystemOptions& options)
+    {
+        Jobs::Initialize(options);
+        const auto milliseconds = MeasureMilliseconds(
+            [&]
+            {
+                auto counter = Jobs::JobCounter();
+                Jobs::Run(declarations, &counter);
+                Jobs::WaitFor(counter);
+            });
+        Jobs::Shutdown();
+        return milliseconds;
+    };
+
+    const auto helpingMilliseconds = MeasureChains(Jobs::JobSystemOptions());
+    const auto fiberMilliseconds   = MeasureChains(
+        Jobs::JobSystemOptions{.runJobsOnFibers = true, .fiberCount = chainCount * (chainDepth + 1)});
+
+    // The same chains with a thread blocking on each link instead
+    const std::function<void(int)> RunThreadLink = [&](int depth)
+    {
+        if (depth > 0)
+            std::thread(RunThreadLink, depth - 1).join();
+    };
+    const auto threadMilliseconds = MeasureMilliseconds(
+        [&]
+        {
+            auto threads = std::vector<std::thread>();
+            for (auto i = 0; i < chainCount; ++i)
+                threads.emplace_back(RunThreadLink, chainDepth);
+            for (auto& thread : threads)
+                thread.join();
+        });
+
+    fmt::print("[ Jobs     ] {} chains of {} waits: {:>8.2f} ms helping, {:>8.2f} ms on fibers, {:>8.2f} ms on "
+               "blocking threads\n",
+               chainCount,
+               chainDepth,
+               helpingMilliseconds,
+               fiberMilliseconds,
+               threadMilliseconds);
+}
+
+} // namespace Core
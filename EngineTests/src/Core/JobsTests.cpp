@@ -0,0 +1,300 @@
+#include <Engine/Core/Assertions.h>
+#include <Engine/Core/Console.h>
+#include <Engine/Core/Jobs.h>
+#include <Engine/Core/WorkStealingDeque.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Failing expects from the jobs below shouldn't stop the tests
+#undef DEBUG_BREAK
+#define DEBUG_BREAK()
+
+namespace Console = Engine::Console;
+namespace Jobs    = Engine::Jobs;
+
+namespace Core
+{
+
+TEST(WorkStealingDequeTest, PopsNewestAndStealsOldest)
+{
+    auto deque = Engine::WorkStealingDeque<int>(4);
+    for (auto i = 0; i < 10; ++i)
+        deque.Push(i);
+
+    EXPECT_EQ(deque.Pop(), 9);
+    EXPECT_EQ(deque.Steal(), 0);
+    EXPECT_EQ(deque.Pop(), 8);
+    EXPECT_EQ(deque.Steal(), 1);
+
+    auto remaining = 0;
+    while (deque.Pop())
+        ++remaining;
+
+    EXPECT_EQ(remaining, 6);
+    EXPECT_TRUE(deque.IsEmpty());
+    EXPECT_FALSE(deque.Steal());
+}
+
+TEST(WorkStealingDequeTest, TakesEveryItemExactlyOnce)
+{
+    static constexpr int itemCount  = 200000;
+    static constexpr int thiefCount = 3;
+
+    auto deque     = Engine::WorkStealingDeque<int>(16);
+    auto takeCount = std::vector<std::atomic<int>>(itemCount);
+    auto isDone    = std::atomic<bool>(false);
+
+    auto thieves = std::vector<std::thread>();
+    for (auto i = 0; i < thiefCount; ++i)
+    {
+        thieves.emplace_back(
+            [&]
+            {
+                while (!isDone.load(std::memory_order_acquire))
+                {
+                    if (const auto item = deque.Steal())
+                        takeCount[*item].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+    }
+
+    // The owner pops some of its own items as it goes, racing the thieves for the last one
+    for (auto i = 0; i < itemCount; ++i)
+    {
+        deque.Push(i);
+        if (i % 3 == 0)
+        {
+            if (const auto item = deque.Pop())
+                takeCount[*item].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    while (const auto item = deque.Pop())
+        takeCount[*item].fetch_add(1, std::memory_order_relaxed);
+
+    isDone.store(true, std::memory_order_release);
+    for (auto& thief : thieves)
+        thief.join();
+
+    for (auto i = 0; i < itemCount; ++i)
+        ASSERT_EQ(takeCount[i].load(), 1) << "item " << i;
+}
+
+class JobsTest : public testing::Test
+{
+protected:
+    void SetUp() override { Jobs::Initialize(4); }
+    void TearDown() override { Jobs::Shutdown(); }
+};
+
+TEST_F(JobsTest, ParallelForCoversEveryIndex)
+{
+    static constexpr size_t count = 100000;
+
+    auto visitCount = std::vector<int>(count);
+    Jobs::ParallelFor(count,
+                      1000,
+                      [&](size_t begin, size_t end)
+                      {
+                          for (auto i = begin; i < end; ++i)
+                              ++visitCount[i];
+                      });
+
+    EXPECT_EQ(std::count(visitCount.begin(), visitCount.end(), 1), static_cast<ptrdiff_t>(count));
+}
+
+struct FanOutState
+{
+    std::vector<int> values;
+    std::atomic<int> finishedCount = 0;
+    int sum                        = 0;
+    bool wasJoinedAfterFanOut      = false;
+};
+
+struct FanOutJob
+{
+    FanOutState* state;
+    int index;
+};
+
+static void RunFanOutJob(void* data)
+{
+    const auto& job              = *static_cast<FanOutJob*>(data);
+    job.state->values[job.index] = job.index + 1;
+    job.state->finishedCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void RunJoinJob(void* data)
+{
+    auto& state                = *static_cast<FanOutState*>(data);
+    state.wasJoinedAfterFanOut = state.finishedCount.load() == static_cast<int>(state.values.size());
+    state.sum                  = std::accumulate(state.values.begin(), state.values.end(), 0);
+}
+
+TEST_F(JobsTest, RunsDependentJobsAfterTheirDependencies)
+{
+    static constexpr int fanOutCount = 64;
+
+    auto state   = FanOutState();
+    state.values = std::vector<int>(fanOutCount);
+
+    auto fanOutJobs   = std::vector<FanOutJob>(fanOutCount);
+    auto declarations = std::vector<Jobs::JobDeclaration>(fanOutCount);
+    for (auto i = 0; i < fanOutCount; ++i)
+    {
+        fanOutJobs[i]   = {.state = &state, .index = i};
+        declarations[i] = {.function = RunFanOutJob, .data = &fanOutJobs[i]};
+    }
+
+    const auto joinJob = Jobs::JobDeclaration{.function = RunJoinJob, .data = &state};
+
+    auto fanOutCounter = Jobs::JobCounter();
+    auto joinCounter   = Jobs::JobCounter();
+    Jobs::Run(declarations, &fanOutCounter);
+    Jobs::RunAfter(fanOutCounter, std::span(&joinJob, 1), &joinCounter);
+    Jobs::WaitFor(joinCounter);
+
+    EXPECT_TRUE(fanOutCounter.IsDone());
+    EXPECT_TRUE(state.wasJoinedAfterFanOut);
+    EXPECT_EQ(state.sum, fanOutCount * (fanOutCount + 1) / 2);
+}
+
+TEST_F(JobsTest, RunsJobsQueuedFromOtherThreads)
+{
+    auto ranCount = std::atomic<int>(0);
+    auto counter  = Jobs::JobCounter();
+
+    const auto job = Jobs::JobDeclaration{
+        .function = [](void* data) { static_cast<std::atomic<int>*>(data)->fetch_add(1); }, .data = &ranCount};
+
+    std::thread([&] { Jobs::Run(job, &counter); }).join();
+    Jobs::WaitFor(counter);
+
+    EXPECT_EQ(ranCount.load(), 1);
+}
+
+TEST_F(JobsTest, LogsAndAssertsFromWorkers)
+{
+    auto logMutex  = std::mutex();
+    auto errorLogs = std::vector<std::string>();
+
+    auto errorStream = Console::LogStream(Console::LogLevel::Error,
+                                          [&](const Console::LogLevel, const std::string& message)
+                                          {
+                                              const auto lock = std::lock_guard(logMutex);
+                                              errorLogs.push_back(message);
+                                          });
+
+    // Enough jobs that the workers steal some of them, with only the first one failing
+    auto jobIndex = std::atomic<int>(0);
+    Jobs::ParallelFor(64,
+                      1,
+                      [&](size_t, size_t)
+                      {
+                          std::this_thread::sleep_for(std::chrono::microseconds(100));
+                          const auto index = jobIndex.fetch_add(1);
+                          Expect_Ne(index, 0);
+                      });
+
+    const auto lock = std::lock_guard(logMutex);
+    ASSERT_EQ(errorLogs.size(), 1u);
+    EXPECT_NE(errorLogs.front().find("index"), std::string::npos);
+}
+
+struct WaitChainJob
+{
+    uint32_t depth;
+    std::atomic<uint32_t>* deepestDepth;
+};
+
+/// Queues the next link of the chain and waits for it, so every link but the last is waiting at once.
+static void RunWaitChainJob(void* data)
+{
+    const auto& job = *static_cast<WaitChainJob*>(data);
+
+    auto deepestDepth = job.deepestDepth->load();
+    while (deepestDepth < job.depth && !job.deepestDepth->compare_exchange_weak(deepestDepth, job.depth))
+    {
+    }
+
+    if (job.depth == 0)
+        return;
+
+    auto nextJob     = WaitChainJob{.depth = job.depth - 1, .deepestDepth = job.deepestDepth};
+    auto nextCounter = Jobs::JobCounter();
+    Jobs::Run(Jobs::JobDeclaration{.function = RunWaitChainJob, .data = &nextJob}, &nextCounter);
+    Jobs::WaitFor(nextCounter);
+}
+
+class JobsOnFibersTest : public testing::TestWithParam<uint32_t>
+{
+protected:
+    void SetUp() override
+    {
+        Jobs::Initialize(
+            Jobs::JobSystemOptions{.workerThreadCount = 3, .runJobsOnFibers = true, .fiberCount = GetParam()});
+    }
+    void TearDown() override { Jobs::Shutdown(); }
+};
+
+TEST_P(JobsOnFibersTest, ParksWaitingJobs)
+{
+    static constexpr uint32_t chainCount = 8;
+    static constexpr uint32_t chainDepth = 32;
+
+    auto deepestDepth = std::atomic<uint32_t>(0);
+    auto chains       = std::vector<WaitChainJob>(chainCount, {.depth = chainDepth, .deepestDepth = &deepestDepth});
+    auto declarations = std::vector<Jobs::JobDeclaration>();
+    for (auto& chain : chains)
+        declarations.push_back({.function = RunWaitChainJob, .data = &chain});
+
+    auto counter = Jobs::JobCounter();
+    Jobs::Run(declarations, &counter);
+    Jobs::WaitFor(counter);
+
+    EXPECT_EQ(deepestDepth.load(), chainDepth);
+}
+
+TEST_P(JobsOnFibersTest, RunsJobsQueuedFromOtherThreads)
+{
+    auto deepestDepth = std::atomic<uint32_t>(0);
+    auto chain        = WaitChainJob{.depth = 16, .deepestDepth = &deepestDepth};
+
+    std::thread(
+        [&]
+        {
+            auto counter = Jobs::JobCounter();
+            Jobs::Run(Jobs::JobDeclaration{.function = RunWaitChainJob, .data = &chain}, &counter);
+            Jobs::WaitFor(counter);
+        })
+        .join();
+
+    EXPECT_EQ(deepestDepth.load(), 16u);
+}
+
+// With plenty of fibers, and with too few for every waiting job, which then wait on their thread's own stack
+INSTANTIATE_TEST_SUITE_P(FiberCounts, JobsOnFibersTest, testing::Values(512u, 4u));
+
+TEST(JobsWithoutWorkersTest, RunsJobsInline)
+{
+    ASSERT_FALSE(Jobs::IsInitialized());
+
+    auto ranCount  = 0;
+    auto counter   = Jobs::JobCounter();
+    const auto job =
+        Jobs::JobDeclaration{.function = [](void* data) { ++*static_cast<int*>(data); }, .data = &ranCount};
+
+    Jobs::Run(job, &counter);
+    EXPECT_EQ(ranCount, 1);
+    EXPECT_TRUE(counter.IsDone());
+}
+
+} // namespace Core
@@ -0,0 +1,193 @@
+#include <Engine/Core/Console.h>
+#include <Engine/Core/LogFileSink.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if !ADHOC_WINDOWS
+    #include <signal.h>
+    #include <unistd.h>
+#endif
+
+namespace Console = Engine::Console;
+using Console::LogLevel;
+
+namespace fs = std::filesystem;
+
+namespace Core
+{
+
+static fs::path MakeEmptyDirectory(std::string_view name)
+{
+    const auto directory = fs::temp_directory_path() / name;
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+    return directory;
+}
+
+static std::vector<fs::path> GetSegmentPaths(const fs::path& directory)
+{
+    auto segmentPaths = std::vector<fs::path>(fs::directory_iterator(directory), fs::directory_iterator());
+    std::sort(segmentPaths.begin(), segmentPaths.end());
+    return segmentPaths;
+}
+
+static std::vector<std::string> ReadLines(const fs::path& path)
+{
+    auto file  = std::ifstream(path, std::ios::binary);
+    auto lines = std::vector<std::string>();
+    for (auto line = std::string(); std::getline(file, line);)
+        lines.push_back(line);
+    return lines;
+}
+
+TEST(LogFileSinkTest, WritesLinesToTheSegment)
+{
+    const auto directory = MakeEmptyDirectory("EngineTests_LogFileSink_WritesLines");
+
+    auto segmentPath = fs::path();
+    {
+        auto sink = Console::LogFileSink(LogLevel::Warning, {.directory = directory});
+        ASSERT_TRUE(sink.IsValid());
+        segmentPath = sink.GetSegmentPath();
+
+        Console::LogWarning("First {}", 1);
+        Console::LogError("Second {}", std::string(1, '\0'));
+    }
+
+    // Closing the segment trims the preallocated space off
+    EXPECT_EQ(ReadLines(segmentPath), std::vector<std::string>({"[Warning] First 1", "[Error] Second  "}));
+    EXPECT_EQ(fs::file_size(segmentPath), std::string_view("[Warning] First 1\n[Error] Second  \n").size());
+
+    fs::remove_all(directory);
+}
+
+TEST(LogFileSinkTest, RotatesWhenTheSegmentIsFull)
+{
+    const auto directory = MakeEmptyDirectory("EngineTests_LogFileSink_RotatesWhenFull");
+
+    {
+        auto sink = Console::LogFileSink(LogLevel::Warning,
+                                         {.directory = directory, .segmentSize = 1024, .maxSegmentCount = 3});
+        for (auto i = 0; i < 200; ++i)
+            Console::LogWarning("Rotation test line {}", i);
+    }
+
+    const auto segmentPaths = GetSegmentPaths(directory);
+    ASSERT_EQ(segmentPaths.size(), 3u);
+
+    // Only the newest segments are kept, and lines are never split across them
+    auto lines = std::vector<std::string>();
+    for (const auto& segmentPath : segmentPaths)
+    {
+        EXPECT_LE(fs::file_size(segmentPath), 1024u);
+
+        const auto segmentLines = ReadLines(segmentPath);
+        lines.insert(lines.end(), segmentLines.begin(), segmentLines.end());
+    }
+
+    ASSERT_FALSE(lines.empty());
+    const auto firstLine = 200 - static_cast<int>(lines.size());
+    for (auto i = 0; i < static_cast<int>(lines.size()); ++i)
+        EXPECT_EQ(lines[i], fmt::format("[Warning] Rotation test line {}", firstLine + i));
+
+    fs::remove_all(directory);
+}
+
+TEST(LogFileSinkTest, RotatesAfterTheInterval)
+{
+    const auto directory = MakeEmptyDirectory("EngineTests_LogFileSink_RotatesAfterInterval");
+
+    {
+        auto sink = Console::LogFileSink(LogLevel::Warning,
+                                         {.directory = directory, .rotationInterval = std::chrono::milliseconds(1)});
+        Console::LogWarning("Before");
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        Console::LogWarning("After");
+    }
+
+    const auto segmentPaths = GetSegmentPaths(directory);
+    ASSERT_EQ(segmentPaths.size(), 2u);
+    EXPECT_EQ(ReadLines(segmentPaths[0]), std::vector<std::string>({"[Warning] Before"}));
+    EXPECT_EQ(ReadLines(segmentPaths[1]), std::vector<std::string>({"[Warning] After"}));
+
+    fs::remove_all(directory);
+}
+
+TEST(LogFileSinkDeathTest, FatalLogsArePersisted)
+{
+    const auto directory = MakeEmptyDirectory("EngineTests_LogFileSink_FatalLogs");
+
+    EXPECT_DEATH(
+        {
+            auto sink = Console::LogFileSink(LogLevel::Warning, {.directory = directory});
+            Console::LogWarning("About to crash");
+            Console::LogFatal("Crashing with code {}", 42);
+        },
+        "");
+
+    // The process died without closing the segment, so it's still at its preallocated size
+    const auto segmentPaths = GetSegmentPaths(directory);
+    ASSERT_EQ(segmentPaths.size(), 1u);
+    EXPECT_EQ(fs::file_size(segmentPaths[0]), Console::LogFileOptions().segmentSize);
+
+    EXPECT_TRUE(Console::RecoverLogFile(segmentPaths[0]));
+    EXPECT_EQ(ReadLines(segmentPaths[0]),
+              std::vector<std::string>({"[Warning] About to crash", "[Fatal] Crashing with code 42"}));
+
+    fs::remove_all(directory);
+}
+
+#if !ADHOC_WINDOWS
+TEST(LogFileSinkDeathTest, LogIsRecoverableAfterBeingKilledMidWrite)
+{
+    const auto directory = MakeEmptyDirectory("EngineTests_LogFileSink_KilledMidWrite");
+    const auto options   = Console::LogFileOptions{.directory = directory, .maxSegmentCount = 0};
+
+    EXPECT_EXIT(
+        {
+            auto sink = Console::LogFileSink(LogLevel::Warning, options);
+
+            auto killer = std::thread(
+                []
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    kill(getpid(), SIGKILL);
+                });
+
+            for (auto i = 0;; ++i)
+                Console::LogWarning("Line {} written before being killed", i);
+        },
+        testing::KilledBySignal(SIGKILL),
+        "");
+
+    // Starting a new sink recovers the segment that was being written to
+    {
+        auto sink = Console::LogFileSink(LogLevel::Warning, options);
+    }
+
+    auto lines = std::vector<std::string>();
+    for (const auto& segmentPath : GetSegmentPaths(directory))
+    {
+        const auto segmentLines = ReadLines(segmentPath);
+        lines.insert(lines.end(), segmentLines.begin(), segmentLines.end());
+    }
+
+    ASSERT_FALSE(lines.empty());
+    for (auto i = 0; i < static_cast<int>(lines.size()); ++i)
+        ASSERT_EQ(lines[i], fmt::format("[Warning] Line {} written before being killed", i));
+
+    fs::remove_all(directory);
+}
+#endif
+
+} // namespace Core
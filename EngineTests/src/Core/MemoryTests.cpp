@@ -0,0 +1,340 @@
+#include <Engine/Core/Console.h>
+#include <Engine/Core/Jobs.h>
+#include <Engine/Core/Memory.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Console = Engine::Console;
+namespace Jobs    = Engine::Jobs;
+namespace Memory  = Engine::Memory;
+using Console::LogLevel;
+using Memory::Heap;
+using Memory::HeapOptions;
+
+namespace Core
+{
+
+TEST(HeapTest, AllocatesAligned)
+{
+    auto heap = Heap();
+
+    for (const size_t alignment : {1, 2, 8, 16, 64, 4096})
+    {
+        auto* memory = heap.Allocate(3, alignment);
+        ASSERT_NE(memory, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % alignment, 0u) << "alignment " << alignment;
+        heap.Free(memory);
+    }
+
+    struct Point
+    {
+        float x;
+        float y;
+    };
+    auto* point = heap.New<Point>(1.0f, 2.0f);
+    ASSERT_NE(point, nullptr);
+    EXPECT_EQ(point->y, 2.0f);
+    heap.Delete(point);
+
+    EXPECT_EQ(heap.GetStats().liveCount, 0u);
+}
+
+TEST(HeapTest, CountsLiveAndFrameBytes)
+{
+    auto heap = Heap(HeapOptions{.name = "Counted heap"});
+
+    auto blocks = std::vector<void*>();
+    for (auto i = 0; i < 10; ++i)
+        blocks.push_back(heap.Allocate(100));
+
+    auto stats = heap.GetStats();
+    EXPECT_STREQ(stats.name, "Counted heap");
+    EXPECT_EQ(stats.liveCount, 10u);
+    EXPECT_GE(stats.liveBytes, 1000u);
+    EXPECT_EQ(stats.peakBytes, stats.liveBytes);
+    EXPECT_EQ(stats.frameAllocationCount, 10u);
+    EXPECT_EQ(stats.frameAllocatedBytes, stats.liveBytes);
+
+    heap.BeginFrame();
+    for (auto i = 0; i < 5; ++i)
+        heap.Free(blocks[i]);
+
+    const auto peakBytes = stats.peakBytes;
+    stats                = heap.GetStats();
+    EXPECT_EQ(stats.liveCount, 5u);
+    EXPECT_EQ(stats.peakBytes, peakBytes);
+    EXPECT_EQ(stats.frameAllocationCount, 0u);
+    EXPECT_EQ(stats.frameFreedBytes, peakBytes - stats.liveBytes);
+
+    for (auto i = 5; i < 10; ++i)
+        heap.Free(blocks[i]);
+    EXPECT_EQ(heap.GetStats().liveBytes, 0u);
+}
+
+TEST(HeapTest, WarnsEachTimeItGoesOverItsSoftBudget)
+{
+    auto warnings  = std::vector<std::string>();
+    auto logStream = Console::LogStream(LogLevel::Warning,
+                                        [&](LogLevel logLevel, std::string logMessage)
+                                        {
+                                            if (logLevel == LogLevel::Warning)
+                                                warnings.push_back(std::move(logMessage));
+                                        });
+
+    auto heap = Heap(HeapOptions{.name = "Soft heap", .budget = {.softLimitBytes = 1000}});
+
+    auto* first = heap.Allocate(600);
+    EXPECT_TRUE(warnings.empty());
+
+    // Goes over, then stays over without being reported again
+    auto* second = heap.Allocate(600);
+    auto* third  = heap.Allocate(600);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(third, nullptr);
+    ASSERT_EQ(warnings.size(), 1u);
+    EXPECT_NE(warnings[0].find("Soft heap"), std::string::npos) << warnings[0];
+
+    // Back under, and over again
+    heap.Free(second);
+    heap.Free(third);
+    heap.Free(heap.Allocate(600));
+    EXPECT_EQ(warnings.size(), 2u);
+
+    heap.Free(first);
+}
+
+TEST(HeapTest, RefusesAllocationsOverItsHardBudget)
+{
+    auto events = std::vector<Memory::BudgetExceededEvent>();
+    auto heap   = Heap(HeapOptions{
+          .name             = "Hard heap",
+          .budget           = {.hardLimitBytes = 4096},
+          .onBudgetExceeded = [&](const Memory::BudgetExceededEvent& event) { events.push_back(event); },
+    });
+
+    auto blocks = std::vector<void*>();
+    while (auto* block = heap.Allocate(1000))
+        blocks.push_back(block);
+    EXPECT_EQ(heap.Allocate(1000), nullptr);
+
+    EXPECT_GE(blocks.size(), 1u);
+    EXPECT_LE(blocks.size(), 4u);
+    EXPECT_LE(heap.GetStats().liveBytes, 4096u);
+    EXPECT_EQ(heap.GetStats().frameRejectedCount, 2u);
+
+    // Only the first refusal each frame is reported
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_STREQ(events[0].heapName, "Hard heap");
+    EXPECT_EQ(events[0].limit, Memory::BudgetLimit::Hard);
+    EXPECT_EQ(events[0].limitBytes, 4096u);
+    EXPECT_EQ(events[0].requestedBytes, 1000u);
+
+    heap.BeginFrame();
+    EXPECT_EQ(heap.Allocate(1000), nullptr);
+    EXPECT_EQ(events.size(), 2u);
+
+    // Containers see it as running out of memory
+    auto values = Memory::HeapVector<uint8_t>(Memory::HeapAllocator<uint8_t>(heap));
+    EXPECT_THROW(values.resize(4096), std::bad_alloc);
+
+    // Raising the budget lets it grow again
+    heap.SetBudget({.hardLimitBytes = 64 * 1024});
+    values.resize(4096);
+    EXPECT_EQ(values.size(), 4096u);
+
+    for (auto* block : blocks)
+        heap.Free(block);
+}
+
+TEST(HeapTest, DestroysEverythingAtOnce)
+{
+    auto heap = Heap(HeapOptions{.budget = {.hardLimitBytes = 1024 * 1024}});
+
+    for (auto i = 0; i < 10000; ++i)
+        ASSERT_NE(heap.Allocate(64), nullptr);
+    EXPECT_EQ(heap.GetStats().liveCount, 10000u);
+
+    heap.DestroyAll();
+    auto stats = heap.GetStats();
+    EXPECT_EQ(stats.liveCount, 0u);
+    EXPECT_EQ(stats.liveBytes, 0u);
+    EXPECT_EQ(stats.frameFreedBytes, stats.frameAllocatedBytes);
+
+    // The whole budget is available again, and what's left when the heap is destroyed goes with it
+    for (auto i = 0; i < 10000; ++i)
+        ASSERT_NE(heap.Allocate(64), nullptr);
+    EXPECT_EQ(heap.GetStats().liveCount, 10000u);
+}
+
+TEST(HeapTest, StartsOverInHeapsCreatedWhereOthersWere)
+{
+    // More heaps than can exist at once, so each thread's part of a destroyed heap is left where a new heap looks
+    for (auto i = 0; i < 200; ++i)
+    {
+        auto heap = Heap();
+        ASSERT_NE(heap.Allocate(32), nullptr);
+        EXPECT_EQ(heap.GetStats().liveCount, 1u);
+    }
+}
+
+TEST(HeapTest, FreesFromOtherThreads)
+{
+    static constexpr size_t blockCount = 10000;
+
+    auto heap   = Heap();
+    auto blocks = std::vector<void*>();
+    for (size_t i = 0; i < blockCount; ++i)
+        blocks.push_back(heap.Allocate(32));
+
+    auto threads = std::vector<std::thread>();
+    for (size_t thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back(
+            [&, thread]
+            {
+                for (auto i = thread; i < blockCount; i += 4)
+                    heap.Free(blocks[i]);
+            });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(heap.GetStats().liveCount, 0u);
+    EXPECT_EQ(heap.GetStats().liveBytes, 0u);
+}
+
+TEST(HeapTest, AllocatesFromOtherThreadsWithinItsHardBudget)
+{
+    static constexpr size_t blockSize  = 64;
+    static constexpr size_t blockLimit = 1000;
+
+    auto heap = Heap(HeapOptions{
+        .budget           = {.hardLimitBytes = blockSize * blockLimit},
+        .onBudgetExceeded = [](const Memory::BudgetExceededEvent&) {},
+    });
+
+    auto allocatedCount = std::atomic<size_t>(0);
+    auto threads        = std::vector<std::thread>();
+    for (auto thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                while (heap.Allocate(blockSize))
+                    allocatedCount.fetch_add(1);
+            });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Between them they use up the whole budget, and not a byte more
+    const auto stats = heap.GetStats();
+    EXPECT_EQ(allocatedCount.load(), blockLimit);
+    EXPECT_EQ(stats.liveCount, blockLimit);
+    EXPECT_EQ(stats.liveBytes, blockSize * blockLimit);
+    EXPECT_EQ(stats.peakBytes, blockSize * blockLimit);
+    EXPECT_EQ(stats.frameRejectedCount, 4u);
+}
+
+TEST(HeapScopeTest, RoutesDefaultConstructedAllocators)
+{
+    auto outerHeap = Heap();
+    auto innerHeap = Heap();
+    EXPECT_EQ(Memory::GetCurrentHeap(), nullptr);
+
+    {
+        auto outerScope = Memory::HeapScope(outerHeap);
+        auto outer      = Memory::HeapVector<int>(100, 1);
+        EXPECT_EQ(outer.get_allocator().GetHeap(), &outerHeap);
+
+        {
+            auto innerScope = Memory::HeapScope(innerHeap);
+            auto inner      = Memory::HeapVector<int>(100, 2);
+            EXPECT_EQ(Memory::GetCurrentHeap(), &innerHeap);
+            EXPECT_EQ(innerHeap.GetStats().liveCount, 1u);
+        }
+
+        EXPECT_EQ(Memory::GetCurrentHeap(), &outerHeap);
+        EXPECT_EQ(outerHeap.GetStats().liveCount, 1u);
+        EXPECT_EQ(innerHeap.GetStats().liveCount, 0u);
+    }
+
+    // Outside of any scope, they fall back to operator new
+    EXPECT_EQ(Memory::GetCurrentHeap(), nullptr);
+    auto values = Memory::HeapVector<int>(100, 3);
+    EXPECT_EQ(values.get_allocator().GetHeap(), nullptr);
+    EXPECT_EQ(outerHeap.GetStats().liveCount, 0u);
+}
+
+TEST(MemoryTest, CreatesSubsystemHeaps)
+{
+    auto options = Memory::MemoryOptions();
+    options.budgets[static_cast<size_t>(Memory::Subsystem::Assets)] = {.softLimitBytes = 1024 * 1024};
+
+    Memory::Initialize(options);
+    ASSERT_TRUE(Memory::IsInitialized());
+
+    auto& assetHeap = Memory::GetSubsystemHeap(Memory::Subsystem::Assets);
+    EXPECT_STREQ(assetHeap.GetName(), "Assets");
+    EXPECT_EQ(assetHeap.GetStats().budget.softLimitBytes, size_t(1024 * 1024));
+
+    Memory::BeginFrame();
+    for (auto i = 0; i < 10; ++i)
+        assetHeap.Allocate(100);
+
+    auto stats = std::vector<Memory::HeapStats>();
+    Memory::GetHeapStats(stats);
+    for (size_t subsystem = 0; subsystem < static_cast<size_t>(Memory::Subsystem::Count); ++subsystem)
+    {
+        const auto* name = Memory::GetSubsystemName(static_cast<Memory::Subsystem>(subsystem));
+        EXPECT_TRUE(std::ranges::any_of(stats, [&](const auto& heapStats) { return heapStats.name == name; })) << name;
+    }
+    const auto assetStats = std::ranges::find(stats, assetHeap.GetName(), &Memory::HeapStats::name);
+    ASSERT_NE(assetStats, stats.end());
+    EXPECT_EQ(assetStats->frameAllocationCount, 10u);
+
+    // Takes what's still allocated with it
+    Memory::Shutdown();
+    EXPECT_FALSE(Memory::IsInitialized());
+    Memory::GetHeapStats(stats);
+    EXPECT_EQ(std::ranges::find(stats, Memory::GetSubsystemName(Memory::Subsystem::Assets), &Memory::HeapStats::name),
+              stats.end());
+}
+
+TEST(MemoryTest, AllocatesJobsFromTheJobsHeap)
+{
+    Memory::Initialize();
+    Jobs::Initialize(2);
+
+    const auto& jobsHeap = Memory::GetSubsystemHeap(Memory::Subsystem::Jobs);
+    EXPECT_EQ(jobsHeap.GetStats().liveCount, 0u);
+
+    auto ranCount     = std::atomic<int>(0);
+    auto declarations = std::vector<Jobs::JobDeclaration>(
+        100,
+        Jobs::JobDeclaration{.function = [](void* data) { static_cast<std::atomic<int>*>(data)->fetch_add(1); },
+                             .data     = &ranCount});
+    auto counter = Jobs::JobCounter();
+    Jobs::Run(declarations, &counter);
+    Jobs::WaitFor(counter);
+    EXPECT_EQ(ranCount.load(), 100);
+
+    // The job pool's slabs
+    const auto stats = jobsHeap.GetStats();
+    EXPECT_GE(stats.liveCount, 1u);
+    EXPECT_GE(stats.liveBytes, 100 * sizeof(void*));
+
+    Jobs::Shutdown();
+    EXPECT_EQ(jobsHeap.GetStats().liveCount, 0u);
+    Memory::Shutdown();
+}
+
+} // namespace Core
@@ -0,0 +1,195 @@
+#include <Engine/Core/BacktraceSymbolHandler.h>
+#include <Engine/Core/Console.h>
+#include <Engine/Core/PoolAllocator.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Console = Engine::Console;
+using Console::LogLevel;
+using Engine::Pool;
+using Engine::PoolOptions;
+using Engine::SlabAllocator;
+
+namespace Core
+{
+
+struct alignas(32) AlignedObject
+{
+    int value;
+    std::string name;
+
+    AlignedObject(int value, std::string name) : value(value), name(std::move(name)) {}
+};
+
+class PoolAllocatorTest : public testing::TestWithParam<bool>
+{
+protected:
+    PoolOptions GetOptions(const char* name = "Test pool") const
+    {
+        return {.name = name, .slabSize = 4096, .useThreadCaches = GetParam(), .threadCacheBatchSize = 8};
+    }
+};
+
+TEST_P(PoolAllocatorTest, ConstructsAlignedObjects)
+{
+    auto pool = Pool<AlignedObject>(GetOptions());
+    EXPECT_EQ(pool.GetAllocator().HasThreadCaches(), GetParam());
+    EXPECT_EQ(pool.GetAllocator().GetElementStride() % alignof(AlignedObject), 0u);
+
+    auto objects = std::vector<AlignedObject*>();
+    for (auto i = 0; i < 1000; ++i)
+    {
+        auto* object = pool.New(i, std::to_string(i));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(object) % alignof(AlignedObject), 0u);
+        objects.push_back(object);
+    }
+    EXPECT_EQ(pool.GetLiveCount(), 1000u);
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(objects[i]->value, i);
+        EXPECT_EQ(objects[i]->name, std::to_string(i));
+    }
+
+    // None of them overlap
+    std::sort(objects.begin(), objects.end());
+    for (size_t i = 1; i < objects.size(); ++i)
+        ASSERT_GE(reinterpret_cast<std::byte*>(objects[i]), reinterpret_cast<std::byte*>(objects[i - 1] + 1));
+
+    for (auto* object : objects)
+        pool.Delete(object);
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+}
+
+TEST_P(PoolAllocatorTest, ReusesFreedObjects)
+{
+    auto allocator = SlabAllocator(24, 8, GetOptions());
+
+    auto elements = std::vector<void*>();
+    for (auto i = 0; i < 1000; ++i)
+        elements.push_back(allocator.Allocate());
+    const auto slabCount = allocator.GetSlabCount();
+    EXPECT_GT(slabCount, 1u);
+
+    // The last object freed is the next one allocated
+    allocator.Free(elements.back());
+    EXPECT_EQ(allocator.Allocate(), elements.back());
+
+    // Freeing and allocating the same number again only reuses what's already there
+    for (auto* element : elements)
+        allocator.Free(element);
+    for (auto& element : elements)
+        element = allocator.Allocate();
+    EXPECT_EQ(allocator.GetSlabCount(), slabCount);
+    EXPECT_EQ(allocator.GetLiveCount(), elements.size());
+
+    for (auto* element : elements)
+        allocator.Free(element);
+}
+
+TEST_P(PoolAllocatorTest, FreesFromOtherThreads)
+{
+    static constexpr size_t objectCount = 10000;
+
+    auto pool    = Pool<uint64_t>(GetOptions());
+    auto objects = std::vector<uint64_t*>(objectCount);
+    for (size_t i = 0; i < objectCount; ++i)
+        objects[i] = pool.New(i);
+
+    // Each thread frees what another allocated, then allocates and frees some of its own
+    auto threads = std::vector<std::thread>();
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&, t]
+            {
+                for (auto i = t; i < objectCount; i += 4)
+                {
+                    EXPECT_EQ(*objects[i], i);
+                    pool.Delete(objects[i]);
+                }
+
+                for (auto i = 0; i < 100; ++i)
+                    pool.Delete(pool.New(i));
+            });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // The threads are gone, so whatever they had cached went back to the pool
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+}
+
+TEST_P(PoolAllocatorTest, ReportsLeaksWhenDestroyed)
+{
+    auto symbolHandler = Engine::BacktraceSymbolHandler();
+    auto errors    = std::vector<std::string>();
+    auto logStream = Console::LogStream(LogLevel::Error,
+                                        [&](LogLevel, std::string logMessage) { errors.push_back(std::move(logMessage)); });
+
+    {
+        auto pool = Pool<int>(GetOptions("Leaky pool"));
+        for (auto i = 0; i < 10; ++i)
+            pool.New(i);
+        for (auto i = 0; i < 5; ++i)
+            pool.Delete(pool.New(i));
+    }
+
+    ASSERT_FALSE(errors.empty());
+    EXPECT_NE(errors.front().find("Leaky pool leaked 10 objects"), std::string::npos) << errors.front();
+#if ADHOC_DEBUG
+    // Along with where some of them were allocated
+    ASSERT_GT(errors.size(), 1u);
+    EXPECT_NE(errors[1].find("ReportsLeaksWhenDestroyed"), std::string::npos) << errors[1];
+#endif
+
+    errors.clear();
+    {
+        auto pool = Pool<int>(GetOptions("Tidy pool"));
+        pool.Delete(pool.New(1));
+    }
+    EXPECT_TRUE(errors.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadCaches, PoolAllocatorTest, testing::Bool());
+
+TEST(PoolThreadCacheTest, RunsOutOfThreadCacheSlots)
+{
+    // Pools beyond the ones that got a slot still work, just without thread caches
+    auto pools = std::vector<std::unique_ptr<Pool<int>>>();
+    for (auto i = 0; i < 100; ++i)
+        pools.push_back(std::make_unique<Pool<int>>());
+
+    EXPECT_TRUE(pools.front()->GetAllocator().HasThreadCaches());
+    EXPECT_FALSE(pools.back()->GetAllocator().HasThreadCaches());
+
+    for (auto& pool : pools)
+        pool->Delete(pool->New(1));
+}
+
+TEST(PoolThreadCacheTest, ReusedSlotsStartWithEmptyCaches)
+{
+    auto objects = std::vector<int*>();
+    for (auto i = 0; i < 3; ++i)
+    {
+        // Likely to get the slot the previous pool had, whose cache on this thread still points into its freed slabs
+        auto pool = Pool<int>(PoolOptions{.threadCacheBatchSize = 4});
+        for (auto j = 0; j < 10; ++j)
+            objects.push_back(pool.New(j));
+        for (auto j = 0; j < 10; ++j)
+            EXPECT_EQ(*objects[j], j);
+        for (auto* object : objects)
+            pool.Delete(object);
+        objects.clear();
+        EXPECT_EQ(pool.GetLiveCount(), 0u);
+    }
+}
+
+} // namespace Core
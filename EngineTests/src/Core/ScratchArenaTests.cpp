@@ -0,0 +1,142 @@
+#include "../AllocationCounter.h"
+#include <Engine/Core/ScratchArena.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace Core
+{
+
+using Engine::ScratchAllocator;
+using Engine::ScratchScope;
+using Engine::ScratchVector;
+
+TEST(ScratchArenaTest, AllocatesAligned)
+{
+    auto scratch = ScratchScope();
+
+    scratch.Allocate(1);
+    for (const size_t alignment : {1, 2, 8, 16, 64, 4096})
+    {
+        auto* memory = scratch.Allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % alignment, 0u) << "alignment " << alignment;
+    }
+
+    EXPECT_EQ(scratch.GetHeapBytesUsed(), 0u);
+}
+
+TEST(ScratchArenaTest, ReleasesMemoryWhenTheScopeEnds)
+{
+    auto scratch   = ScratchScope();
+    auto* previous = scratch.Allocate(16);
+
+    void* innerMemory = nullptr;
+    {
+        auto innerScratch = ScratchScope();
+        innerMemory       = innerScratch.Allocate(1000);
+        EXPECT_GT(innerMemory, previous);
+        EXPECT_GE(innerScratch.GetArenaBytesUsed(), 1000u);
+    }
+
+    // The inner scope's memory is handed out again
+    EXPECT_EQ(scratch.Allocate(1000, 1), innerMemory);
+}
+
+TEST(ScratchArenaTest, FallsBackToTheHeapWhenFull)
+{
+    auto scratch = ScratchScope();
+
+    auto* fromArena = static_cast<char*>(scratch.Allocate(Engine::scratchArenaSize / 2));
+    auto* fromHeap  = static_cast<char*>(scratch.Allocate(Engine::scratchArenaSize, 64));
+    ASSERT_NE(fromHeap, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(fromHeap) % 64, 0u);
+    EXPECT_EQ(scratch.GetHeapBytesUsed(), Engine::scratchArenaSize);
+
+    // Both stay usable for as long as the scope is open
+    std::memset(fromArena, 1, Engine::scratchArenaSize / 2);
+    std::memset(fromHeap, 2, Engine::scratchArenaSize);
+    EXPECT_EQ(fromArena[0], 1);
+    EXPECT_EQ(fromHeap[Engine::scratchArenaSize - 1], 2);
+
+    // Smaller allocations still fit in what's left of the arena
+    scratch.Allocate(64);
+    EXPECT_EQ(scratch.GetHeapBytesUsed(), Engine::scratchArenaSize);
+}
+
+TEST(ScratchArenaTest, BacksStandardContainers)
+{
+    auto scratch = ScratchScope();
+    auto values  = ScratchVector<int>(ScratchAllocator<int>(scratch));
+    for (auto i = 0; i < 1000; ++i)
+        values.push_back(i);
+
+    EXPECT_EQ(values.size(), 1000u);
+    EXPECT_EQ(values[999], 999);
+    EXPECT_GE(scratch.GetArenaBytesUsed(), 1000 * sizeof(int));
+}
+
+TEST(ScratchArenaTest, DoesntUseTheGlobalAllocator)
+{
+    // The thread's arena is created on its first scope
+    {
+        auto scratch = ScratchScope();
+    }
+
+    const auto allocationCountBefore = Testing::GetThreadAllocationCount();
+    {
+        auto scratch = ScratchScope();
+        auto values  = ScratchVector<int>(ScratchAllocator<int>(scratch));
+        values.resize(4096);
+        scratch.AllocateArray<char>(512);
+    }
+    const auto allocationCountAfter = Testing::GetThreadAllocationCount();
+
+    EXPECT_EQ(allocationCountAfter - allocationCountBefore, 0u);
+}
+
+TEST(ScratchArenaTest, ThreadsHaveArenasOfTheirOwn)
+{
+    auto scratch      = ScratchScope();
+    auto* mainMemory  = scratch.AllocateArray<char>(256).data();
+    char* otherMemory = nullptr;
+
+    std::thread(
+        [&]
+        {
+            auto otherScratch = ScratchScope();
+            otherMemory       = otherScratch.AllocateArray<char>(256).data();
+        })
+        .join();
+
+    EXPECT_NE(otherMemory, nullptr);
+    EXPECT_TRUE(otherMemory + 256 <= mainMemory || mainMemory + 256 <= otherMemory);
+}
+
+#if ADHOC_DEBUG
+TEST(ScratchArenaTest, PoisonsMemoryInDebug)
+{
+    auto scratch = ScratchScope();
+
+    unsigned char* memory = nullptr;
+    {
+        auto innerScratch = ScratchScope();
+        memory            = static_cast<unsigned char*>(innerScratch.Allocate(64));
+        EXPECT_TRUE(std::all_of(memory,
+                                memory + 64,
+                                [](unsigned char value)
+                                { return value == static_cast<unsigned char>(Engine::scratchAllocatedPattern); }));
+        std::memset(memory, 0, 64);
+    }
+
+    EXPECT_TRUE(std::all_of(memory,
+                            memory + 64,
+                            [](unsigned char value)
+                            { return value == static_cast<unsigned char>(Engine::scratchReleasedPattern); }));
+}
+#endif
+
+} // namespace Core
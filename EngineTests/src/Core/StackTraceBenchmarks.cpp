@@ -0,0 +1,153 @@
+#include <Engine/Core/BacktraceSymbolHandler.h>
+#include <Engine/Core/MiscMacros.h>
+#include <Engine/Core/StackTrace.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Core
+{
+
+// These only report timings; they don't assert on them since the numbers depend entirely on the machine running them
+
+static constexpr int benchmarkDepth = 32;
+
+// Written after each recursive call so the calls can't become tail calls and drop their frames
+static volatile int recursionSink = 0;
+
+template <typename F>
+static double MeasureNanosecondsPerIteration(int iterations, F&& iteration)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+        iteration();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+/// Recurse until the stack is depth frames deeper, then run the benchmark from there.
+template <typename F>
+NOINLINE static double MeasureAtDepth(int depth, F&& benchmark)
+{
+    if (depth == 0)
+        return benchmark();
+
+    const auto result = MeasureAtDepth(depth - 1, benchmark);
+    recursionSink     = depth;
+    return result;
+}
+
+TEST(StackTraceBenchmark, CaptureCost)
+{
+    auto frameCount = uint32_t(0);
+
+    const auto captureNanoseconds = MeasureAtDepth(benchmarkDepth,
+                                                   [&]
+                                                   {
+                                                       return MeasureNanosecondsPerIteration(
+                                                           100000,
+                                                           [&]
+                                                           {
+                                                               const auto stackTrace = Engine::StackTrace::Capture();
+                                                               frameCount            = stackTrace.frameCount;
+                                                           });
+                                                   });
+
+    EXPECT_GE(frameCount, uint32_t(benchmarkDepth));
+    fmt::print("[ Backtrace ] StackTrace::Capture() of {} frames: {:>9.2f} ns\n", frameCount, captureNanoseconds);
+}
+
+TEST(StackTraceBenchmark, SymbolizeCost)
+{
+    auto symbolHandler = Engine::BacktraceSymbolHandler();
+    auto textLength    = size_t(0);
+
+    // GetBacktrace() used to symbolize from scratch on every call, which is what the first Symbolize() does
+    const auto capturedStackTrace = [&]
+    {
+        auto result = Engine::StackTrace();
+        MeasureAtDepth(benchmarkDepth,
+                       [&]
+                       {
+                           result = Engine::StackTrace::Capture();
+                           return 0.0;
+                       });
+        return result;
+    }();
+
+    const auto uncachedNanoseconds = MeasureNanosecondsPerIteration(
+        1, [&] { textLength = symbolHandler.Symbolize(capturedStackTrace).size(); });
+    const auto cachedNanoseconds = MeasureNanosecondsPerIteration(
+        1000, [&] { textLength = symbolHandler.Symbolize(capturedStackTrace).size(); });
+
+    EXPECT_GT(textLength, 0u);
+    fmt::print("[ Backtrace ] Symbolize() of {} frames: {:>9.2f} ns uncached, {:>9.2f} ns cached\n",
+               capturedStackTrace.frameCount,
+               uncachedNanoseconds,
+               cachedNanoseconds);
+}
+
+/// Recurse through a mix of functions, so the stacks differ in their frames as well as their depth.
+NOINLINE static void CaptureVariedStacks(int depth, int seed, std::vector<Engine::StackTrace>& stackTraces);
+
+NOINLINE static void CaptureVariedStacksThroughLambda(int depth, int seed, std::vector<Engine::StackTrace>& stackTraces)
+{
+    [&] NOINLINE { CaptureVariedStacks(depth, seed, stackTraces); }();
+    recursionSink = depth;
+}
+
+NOINLINE static void CaptureVariedStacks(int depth, int seed, std::vector<Engine::StackTrace>& stackTraces)
+{
+    if (depth == 0)
+    {
+        stackTraces.push_back(Engine::StackTrace::Capture());
+        return;
+    }
+
+    if ((seed >> depth) & 1)
+        CaptureVariedStacksThroughLambda(depth - 1, seed, stackTraces);
+    else
+        CaptureVariedStacks(depth - 1, seed, stackTraces);
+    recursionSink = depth;
+}
+
+TEST(StackTraceBenchmark, SymbolizeProfilingSession)
+{
+    // 10k samples with a few hundred distinct stacks between them, like a sampling profiler's output
+    auto stackTraces = std::vector<Engine::StackTrace>();
+    stackTraces.reserve(10000);
+    for (auto i = 0; i < 10000; ++i)
+        CaptureVariedStacks(8 + i % 8, i % 64, stackTraces);
+
+    auto symbolHandler = Engine::BacktraceSymbolHandler();
+
+    auto distinctStackTraces = std::vector<Engine::StackTrace>();
+    for (const auto& stackTrace : stackTraces)
+    {
+        if (std::find(distinctStackTraces.begin(), distinctStackTraces.end(), stackTrace) == distinctStackTraces.end())
+            distinctStackTraces.push_back(stackTrace);
+    }
+
+    auto texts = std::vector<std::string>();
+
+    // Only the first batch has to look anything up, since the symbol cache lasts for the whole process
+    const auto coldSeconds =
+        MeasureNanosecondsPerIteration(1, [&] { texts = symbolHandler.Symbolize(stackTraces); }) / 1e9;
+    const auto warmSeconds =
+        MeasureNanosecondsPerIteration(1, [&] { texts = symbolHandler.Symbolize(stackTraces); }) / 1e9;
+
+    ASSERT_EQ(texts.size(), stackTraces.size());
+    fmt::print("[ Backtrace ] Symbolize() of {} stacks ({} distinct): {:.3f} s cold, {:.3f} s cached\n",
+               stackTraces.size(),
+               distinctStackTraces.size(),
+               coldSeconds,
+               warmSeconds);
+}
+
+} // namespace Core
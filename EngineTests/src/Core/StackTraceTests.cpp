@@ -0,0 +1,145 @@
+#include <Engine/Core/BacktraceSymbolHandler.h>
+#include <Engine/Core/CrashHandler.h>
+#include <Engine/Core/MiscMacros.h>
+#include <Engine/Core/StackTrace.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace Core
+{
+
+// Written after each call below so they can't become tail calls and drop their frames
+static volatile int recursionSink = 0;
+
+// Not static, so the symbol is exported and can be named without debug info
+NOINLINE Engine::StackTrace CaptureFromNamedStackTraceTestFunction()
+{
+    auto stackTrace = Engine::StackTrace::Capture();
+    recursionSink   = 0;
+    return stackTrace;
+}
+
+NOINLINE static Engine::StackTrace CaptureAtDepth(int depth)
+{
+    if (depth == 0)
+        return Engine::StackTrace::Capture();
+
+    auto stackTrace = CaptureAtDepth(depth - 1);
+    recursionSink   = depth;
+    return stackTrace;
+}
+
+TEST(StackTraceTest, CapturesEveryFrame)
+{
+    const auto shallowTrace = CaptureAtDepth(0);
+    const auto deepTrace    = CaptureAtDepth(20);
+
+    ASSERT_GT(shallowTrace.frameCount, 0u);
+    EXPECT_GE(deepTrace.frameCount, std::min<uint32_t>(shallowTrace.frameCount + 20, Engine::StackTrace::maxFrames));
+
+    // The recursive frames all return to the same place
+    for (uint32_t i = 1; i <= 20 && i < deepTrace.frameCount; ++i)
+        EXPECT_EQ(deepTrace.frames[i], deepTrace.frames[1]);
+}
+
+TEST(StackTraceTest, SkipsFrames)
+{
+    const auto stackTrace        = CaptureAtDepth(5);
+    const auto skippedStackTrace = Engine::StackTrace::Capture(1);
+
+    ASSERT_GT(stackTrace.frameCount, 7u);
+    // The first trace has six CaptureAtDepth() frames and then this test, and the second starts at the test's caller
+    EXPECT_EQ(stackTrace.frameCount - 7, skippedStackTrace.frameCount);
+    EXPECT_EQ(stackTrace.frames[7], skippedStackTrace.frames[0]);
+}
+
+TEST(StackTraceTest, IdenticalStacksHashTheSame)
+{
+    Engine::StackTrace stackTraces[2];
+    for (auto& stackTrace : stackTraces)
+        stackTrace = CaptureAtDepth(3);
+
+    const auto otherStackTrace = CaptureAtDepth(4);
+
+    EXPECT_EQ(stackTraces[0], stackTraces[1]);
+    EXPECT_EQ(stackTraces[0].GetHash(), stackTraces[1].GetHash());
+    EXPECT_FALSE(stackTraces[0] == otherStackTrace);
+    EXPECT_NE(stackTraces[0].GetHash(), otherStackTrace.GetHash());
+}
+
+TEST(StackTraceTest, SymbolizesCapturedFrames)
+{
+    auto symbolHandler = Engine::BacktraceSymbolHandler();
+    EXPECT_EQ(Engine::BacktraceSymbolHandler::GetInstance(), &symbolHandler);
+
+    const auto stackTrace = CaptureFromNamedStackTraceTestFunction();
+    const auto text       = symbolHandler.Symbolize(stackTrace);
+
+    EXPECT_NE(text.find("CaptureFromNamedStackTraceTestFunction"), std::string::npos) << text;
+    EXPECT_EQ(std::count(text.begin(), text.end(), '\n'), stackTrace.frameCount);
+
+    // The second time around, every frame comes out of the cache
+    EXPECT_EQ(symbolHandler.Symbolize(stackTrace), text);
+}
+
+TEST(StackTraceTest, ResolvesFileAndLine)
+{
+#if ADHOC_RELEASE || ADHOC_MACOS || (ADHOC_LINUX && !ADHOC_HAS_LIBBACKTRACE)
+    GTEST_SKIP() << "No line information for this configuration";
+#endif
+
+    auto symbolHandler = Engine::BacktraceSymbolHandler();
+
+    const auto stackTrace = CaptureFromNamedStackTraceTestFunction();
+    ASSERT_GT(stackTrace.frameCount, 0u);
+
+    const auto& symbol = symbolHandler.ResolveSymbol(stackTrace.frames[0]);
+    EXPECT_NE(symbol.function.find("CaptureFromNamedStackTraceTestFunction"), std::string::npos);
+    EXPECT_NE(symbol.file.find("StackTraceTests.cpp"), std::string::npos);
+    EXPECT_GT(symbol.line, 0u);
+
+    // Cached entries are handed out by reference
+    EXPECT_EQ(&symbolHandler.ResolveSymbol(stackTrace.frames[0]), &symbol);
+}
+
+TEST(StackTraceTest, SymbolizesBatchesOfStackTraces)
+{
+    auto symbolHandler = Engine::BacktraceSymbolHandler();
+
+    auto stackTraces = std::vector<Engine::StackTrace>();
+    for (auto i = 0; i < 12; ++i)
+        stackTraces.push_back(CaptureAtDepth(i % 3));
+
+    const auto texts = symbolHandler.Symbolize(stackTraces);
+    ASSERT_EQ(texts.size(), stackTraces.size());
+
+    for (size_t i = 0; i < stackTraces.size(); ++i)
+    {
+        EXPECT_EQ(texts[i], symbolHandler.Symbolize(stackTraces[i]));
+        EXPECT_EQ(texts[i] == texts[i % 3], stackTraces[i] == stackTraces[i % 3]);
+    }
+}
+
+TEST(StackTraceDeathTest, CrashHandlerPrintsCrashingStack)
+{
+    EXPECT_DEATH(
+        {
+            Engine::InstallCrashHandler();
+            std::raise(SIGSEGV);
+        },
+        "Fatal (signal|error) SIGSEGV! Stack:\n.+\n");
+    EXPECT_DEATH(
+        {
+            Engine::InstallCrashHandler();
+            std::abort();
+        },
+        "Fatal (signal|error) SIGABRT! Stack:\n.+\n");
+}
+
+} // namespace Core
@@ -0,0 +1,127 @@
+#include <Engine/Core/BacktraceSymbolHandler.h>
+#include <Engine/Core/CrashHandler.h>
+#include <Engine/Core/PlatformData.h>
+#include <Engine/Core/StartupTrace.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace Core
+{
+
+static const Engine::StartupTraceEvent* FindEvent(const std::vector<Engine::StartupTraceEvent>& events,
+                                                  std::string_view name)
+{
+    const auto found =
+        std::find_if(events.begin(), events.end(), [&](const auto& event) { return event.name == name; });
+    return found != events.end() ? &*found : nullptr;
+}
+
+TEST(StartupTraceTest, RecordsNestedScopes)
+{
+    Engine::BeginStartupTrace();
+    {
+        STARTUP_TRACE_SCOPE("Outer");
+        STARTUP_TRACE_SCOPE("Inner");
+    }
+    Engine::EndStartupTrace();
+
+    // Scopes after the end of startup aren't recorded
+    {
+        STARTUP_TRACE_SCOPE("After startup");
+    }
+
+    const auto events = Engine::GetStartupTraceEvents();
+    ASSERT_EQ(events.size(), 2u);
+
+    const auto* outer = FindEvent(events, "Outer");
+    const auto* inner = FindEvent(events, "Inner");
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(inner, nullptr);
+
+    EXPECT_EQ(outer->depth, 0u);
+    EXPECT_EQ(inner->depth, 1u);
+    EXPECT_EQ(outer->threadIndex, 0u);
+    EXPECT_LE(outer->start, inner->start);
+    EXPECT_GE(outer->duration, inner->duration);
+}
+
+TEST(StartupTraceTest, LoadsSymbolsInTheBackground)
+{
+    Engine::BeginStartupTrace();
+    {
+        auto symbolHandler = Engine::BacktraceSymbolHandler();
+
+        // The first lookup waits for the symbols if they're still loading
+        const auto& symbol = symbolHandler.ResolveSymbol(Engine::StackTrace::Capture().frames[0]);
+        EXPECT_FALSE(symbol.module.empty());
+    }
+    Engine::EndStartupTrace();
+
+#if ADHOC_WINDOWS || ADHOC_LINUX
+    const auto events       = Engine::GetStartupTraceEvents();
+    const auto* loadSymbols = FindEvent(events, "Load symbols");
+    ASSERT_NE(loadSymbols, nullptr);
+    EXPECT_NE(loadSymbols->threadIndex, 0u);
+#endif
+}
+
+TEST(StartupTraceTest, WritesChromeTrace)
+{
+    const auto tracePath = fs::temp_directory_path() / "AdHocStartupTraceTest.json";
+
+    Engine::SetStartupTracePath(tracePath);
+    Engine::BeginStartupTrace();
+    {
+        STARTUP_TRACE_SCOPE("Traced \"step\"");
+    }
+    Engine::EndStartupTrace();
+    Engine::SetStartupTracePath(fs::path());
+
+    auto file        = std::ifstream(tracePath);
+    const auto trace = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    file.close();
+    fs::remove(tracePath);
+
+    EXPECT_TRUE(trace.starts_with("{\"traceEvents\":["));
+    EXPECT_NE(trace.find(R"("name":"Traced \"step\"","ph":"X")"), std::string::npos);
+}
+
+/// Regression test for the part of startup the Engine owns. The Editor adds window creation on top, which the
+/// Launcher's LauncherStartupIsWithinBudget test covers.
+TEST(StartupTraceTest, EngineStartupIsWithinBudget)
+{
+    Engine::BeginStartupTrace();
+
+    {
+        STARTUP_TRACE_SCOPE("Initialize platform data");
+        Engine::InitializePlatformData();
+    }
+
+    auto symbolHandler = std::optional<Engine::BacktraceSymbolHandler>();
+    {
+        STARTUP_TRACE_SCOPE("Start symbol handler");
+        symbolHandler.emplace();
+    }
+
+    {
+        STARTUP_TRACE_SCOPE("Install crash handler");
+        Engine::InstallCrashHandler();
+    }
+
+    const auto startupTime = Engine::EndStartupTrace();
+    Engine::UninstallCrashHandler();
+
+    EXPECT_LT(startupTime, Engine::startupBudget);
+}
+
+} // namespace Core
@@ -0,0 +1,75 @@
+#include <Engine/Core/DynamicLibrary.h>
+#include <Engine/Core/PlatformData.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+namespace Core
+{
+
+TEST(LinuxPlatformTest, LoadsFunctionsFromSharedLibraries)
+{
+    auto library = DynamicLibrary("libm.so.6");
+    ASSERT_TRUE(library.IsValid());
+
+    // The second lookup comes out of the symbol cache
+    const auto cosine = library.GetFunction<double(double)>("cos");
+    ASSERT_TRUE(cosine);
+    EXPECT_EQ(cosine(0.0), 1.0);
+    EXPECT_TRUE(library.GetFunction<double(double)>("cos"));
+
+    EXPECT_FALSE(library.GetFunction<double(double)>("NotARealFunction"));
+}
+
+TEST(LinuxPlatformTest, BindsTablesOfFunctions)
+{
+    struct MathFunctions
+    {
+        double (*cosine)(double)     = nullptr;
+        double (*squareRoot)(double) = nullptr;
+        double (*missing)(double)    = nullptr;
+    };
+
+    auto library = DynamicLibrary("libm.so.6");
+    ASSERT_TRUE(library.IsValid());
+
+    auto functions = MathFunctions();
+    EXPECT_TRUE(library.BindFunctions(
+        {DynamicLibrary::Bind("cos", functions.cosine), DynamicLibrary::Bind("sqrt", functions.squareRoot)}));
+    ASSERT_NE(functions.cosine, nullptr);
+    ASSERT_NE(functions.squareRoot, nullptr);
+    EXPECT_EQ(functions.cosine(0.0), 1.0);
+    EXPECT_EQ(functions.squareRoot(4.0), 2.0);
+
+    // Bound entry points are the same ones GetFunctionPtr() hands out
+    EXPECT_EQ(library.GetFunctionPtr<double(double)>("cos"), functions.cosine);
+
+    EXPECT_FALSE(library.BindFunctions({DynamicLibrary::Bind("sqrt", functions.squareRoot),
+                                        DynamicLibrary::Bind("NotARealFunction", functions.missing)}));
+    EXPECT_NE(functions.squareRoot, nullptr);
+    EXPECT_EQ(functions.missing, nullptr);
+}
+
+TEST(LinuxPlatformTest, TimestampCounterIsCalibrated)
+{
+    Engine::InitializePlatformData();
+
+    const auto& platformData = Engine::PlatformData::GetInstance();
+    ASSERT_GT(platformData.timestampCounterFrequency, 0u);
+
+    const auto startTicks       = Engine::ReadTimestampCounter();
+    const auto startNanoseconds = Engine::GetMonotonicRawNanoseconds();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const auto endTicks       = Engine::ReadTimestampCounter();
+    const auto endNanoseconds = Engine::GetMonotonicRawNanoseconds();
+
+    // Loose bounds, since the test machine may be busy or virtualized
+    const auto measuredSeconds = static_cast<double>(endTicks - startTicks) / platformData.timestampCounterFrequency;
+    const auto elapsedSeconds  = static_cast<double>(endNanoseconds - startNanoseconds) / 1e9;
+    EXPECT_GT(endNanoseconds, startNanoseconds);
+    EXPECT_NEAR(measuredSeconds, elapsedSeconds, elapsedSeconds * 0.5);
+}
+
+} // namespace Core
@@ -1,6 +1,4 @@
-#if ADHOC_EDITOR
-    #include <mimalloc-new-delete.h>
-#endif
-
 // On Windows, we override new/delete in addition to malloc/free for performance reasons.
 // https://microsoft.github.io/mimalloc/overrides.html, "Dynamic Override on Windows"
+// In EngineTests the overrides live in AllocationCounter.cpp, which counts allocations and then forwards to the
+// HeapProfiler, or to mimalloc in editor Release builds, to match the Engine library's overrides.
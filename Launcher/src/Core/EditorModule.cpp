@@ -0,0 +1,69 @@
+#include "EditorModule.h"
+
+#include <Engine/Core/BacktraceSymbolHandler.h>
+#include <Engine/Core/Console.h>
+
+#include <fmt/format.h>
+
+#include <system_error>
+
+namespace Console = Engine::Console;
+namespace fs      = std::filesystem;
+
+bool EditorModule::Load(const fs::path& libraryPath)
+{
+    Unload();
+
+    shadowPath = libraryPath.parent_path() / fmt::format("{}.hot{}{}",
+                                                         libraryPath.stem().string(),
+                                                         loadCount++,
+                                                         libraryPath.extension().string());
+
+    auto error = std::error_code();
+    fs::copy_file(libraryPath, shadowPath, fs::copy_options::overwrite_existing, error);
+    if (error)
+    {
+        Console::LogError("Failed to copy {} to {}! {}", libraryPath.string(), shadowPath.string(), error.message());
+        return false;
+    }
+
+    library.Load(shadowPath);
+    if (!library.IsValid())
+    {
+        Unload();
+        return false;
+    }
+
+    const auto allFound = library.BindFunctions({DynamicLibrary::Bind("AdHocEditorMain", entryPoints.editorMain),
+                                                 DynamicLibrary::Bind("AdHocGetMutableEditorState",
+                                                                      entryPoints.getMutableEditorState)});
+    if (!allFound)
+    {
+        Console::LogError("{} is missing some of the Editor's entry points!", libraryPath.string());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void EditorModule::Unload()
+{
+    if (library.IsValid())
+    {
+        library.Unload();
+
+        // Whatever gets loaded next may reuse the Editor's addresses
+        Engine::BacktraceSymbolHandler::ClearSymbolCache();
+        Console::ForgetFormatStringAddresses();
+    }
+
+    entryPoints = Editor::EditorEntryPoints();
+
+    if (!shadowPath.empty())
+    {
+        auto error = std::error_code();
+        fs::remove(shadowPath, error);
+        shadowPath.clear();
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Editor/Core/Internal/EditorEntryPoint.h>
+#include <Engine/Core/DynamicLibrary.h>
+
+#include <cstdint>
+#include <filesystem>
+
+/// The Editor library, loaded from a copy so that the build can replace the original while it's running, which is
+/// what lets it be hot reloaded.
+class EditorModule
+{
+public:
+    EditorModule() = default;
+    ~EditorModule() { Unload(); }
+
+    EditorModule(const EditorModule&)            = delete;
+    EditorModule& operator=(const EditorModule&) = delete;
+
+    bool IsValid() { return library.IsValid(); }
+
+    /// Copy the library at libraryPath, load the copy and bind its entry points.
+    bool Load(const std::filesystem::path& libraryPath);
+    void Unload();
+
+    const Editor::EditorEntryPoints& GetEntryPoints() const { return entryPoints; }
+
+private:
+    DynamicLibrary library;
+    Editor::EditorEntryPoints entryPoints;
+    std::filesystem::path shadowPath;
+    /// Each copy gets a new name, since a loader may hand back the library it already has for a path it has seen.
+    uint32_t loadCount = 0;
+};
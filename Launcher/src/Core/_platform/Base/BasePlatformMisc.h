@@ -7,4 +7,7 @@ namespace Platform
 
 std::filesystem::path GetLauncherPath();
 
+/// Whether there's a display to open the Editor's window on, which build machines and containers often lack.
+bool HasDisplay();
+
 }
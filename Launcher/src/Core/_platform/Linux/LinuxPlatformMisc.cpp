@@ -0,0 +1,35 @@
+#include "LinuxPlatformMisc.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+
+#if !ADHOC_LINUX
+static_assert(false);
+#endif
+
+namespace fs = std::filesystem;
+
+namespace Platform
+{
+
+fs::path GetLauncherPath()
+{
+    // The kernel keeps this link pointing at the resolved executable, so there's nothing left to canonicalize
+    auto error        = std::error_code();
+    auto launcherPath = fs::read_symlink("/proc/self/exe", error);
+    if (error)
+    {
+        std::cerr << "Failed to get path to launcher! " << error.message() << "\n";
+        return fs::path();
+    }
+    return launcherPath;
+}
+
+bool HasDisplay()
+{
+    return std::getenv("DISPLAY") || std::getenv("WAYLAND_DISPLAY");
+}
+
+} // namespace Platform
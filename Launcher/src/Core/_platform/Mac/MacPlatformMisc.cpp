@@ -36,4 +36,10 @@ fs::path GetLauncherPath()
     return realCPathToLauncher;
 }
 
+bool HasDisplay()
+{
+    // Every session has one, if only a virtual one
+    return true;
+}
+
 } // namespace Platform
@@ -25,4 +25,10 @@ fs::path GetLauncherPath()
     return cPathToLauncher;
 }
 
+bool HasDisplay()
+{
+    // Every session has one, if only a virtual one
+    return true;
+}
+
 } // namespace Platform
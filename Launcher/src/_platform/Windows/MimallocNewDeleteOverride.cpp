@@ -1,4 +1,9 @@
-#include <mimalloc-new-delete.h>
+#if ADHOC_RELEASE
+    #include <mimalloc-new-delete.h>
+#else
+    // Through the HeapProfiler instead, so that it can be started at any point and see every block
+    #include <Engine/Core/HeapProfilerNewDelete.h>
+#endif
 
 // On Windows, we override new/delete in addition to malloc/free for performance reasons.
 // https://microsoft.github.io/mimalloc/overrides.html, "Dynamic Override on Windows"
@@ -3,15 +3,59 @@
 #include <Editor/Core/Internal/EditorEntryPoint.h>
 #include <Engine/Core/Assertions.h>
 #include <Engine/Core/Console.h>
+#include <Engine/Core/StartupTrace.h>
 
 #include <fmt/format.h>
 
+#include "Core/PlatformMisc.h"
+
+#include <chrono>
+#include <cstring>
 #include <string>
+#include <string_view>
+
+#if ADHOC_HOT_RELOAD
+    #include "Core/EditorModule.h"
+
+    #include <Engine/Core/BacktraceSymbolHandler.h>
+    #include <Engine/Core/CrashHandler.h>
+    #include <Engine/Core/FileWatcher.h>
+    #include <Engine/Core/HotReload.h>
+    #include <Engine/Core/Jobs.h>
+    #include <Engine/Core/Memory.h>
+    #include <Engine/Core/PlatformData.h>
+
+    #include <atomic>
+    #include <filesystem>
+    #include <optional>
+    #include <system_error>
+    #include <thread>
+    #include <vector>
+#endif
 
 namespace Console = Engine::Console;
 using Console::LogLevel;
 
-static void OnEngineLogEvent(const LogLevel logLevel, const std::string& message)
+#if ADHOC_HOT_RELOAD
+namespace fs = std::filesystem;
+#endif
+
+// clang-format off
+#if ADHOC_DEBUG
+static constexpr auto compiledConfigMode = Editor::ConfigurationMode::Debug;
+#elif ADHOC_DEV
+static constexpr auto compiledConfigMode = Editor::ConfigurationMode::Dev;
+#elif ADHOC_RELEASE
+static constexpr auto compiledConfigMode = Editor::ConfigurationMode::Release;
+#else
+    #error "Unknown configuration"
+#endif
+// clang-format on
+
+/// What CTest takes as a skipped test, for --quit-after-startup runs that have nowhere to open a window.
+static constexpr int skippedTestExitCode = 77;
+
+static void OnEngineLogEvent(const LogLevel logLevel, std::string_view message)
 {
     switch (logLevel)
     {
@@ -24,27 +68,246 @@ static void OnEngineLogEvent(const LogLevel logLevel, const std::string& message
     }
 }
 
-int main(int argc, char* argv[])
+#if ADHOC_HOT_RELOAD
+/// When the file watcher last saw a new build of the Editor, in steady_clock ticks.
+static std::atomic<std::chrono::steady_clock::rep> editorRebuildTime = 0;
+
+static void OnEditorRebuilt()
 {
-    // TODO: Reload if mi-malloc isn't injected (Mac)
+    editorRebuildTime.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    Engine::RequestReload();
+}
 
-    auto mainLogStream = Console::LogStream(LogLevel::Trace, OnEngineLogEvent);
+/// Reloads that weren't set off by a rebuild are timed from when the Editor returned instead.
+static std::chrono::steady_clock::time_point TakeEditorRebuildTime()
+{
+    const auto rebuildTicks = editorRebuildTime.exchange(0, std::memory_order_relaxed);
+    if (rebuildTicks == 0)
+        return std::chrono::steady_clock::now();
 
-    Console::Log("Starting Ad Hoc Launcher...");
+    return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(rebuildTicks));
+}
+
+/// Times each phase of a hot reload, starting from when the new build was noticed.
+class ReloadTrace
+{
+public:
+    explicit ReloadTrace(std::chrono::steady_clock::time_point startTime)
+        : startTime(startTime), phaseStartTime(startTime)
+    {
+    }
+
+    void EndPhase(std::string_view name)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        phases.push_back({name, std::chrono::duration<double, std::milli>(now - phaseStartTime).count()});
+        phaseStartTime = now;
+    }
+
+    double GetTotalMilliseconds() const
+    {
+        return std::chrono::duration<double, std::milli>(phaseStartTime - startTime).count();
+    }
+
+    void Log() const
+    {
+        auto phaseTimes = std::string();
+        for (const auto& [name, milliseconds] : phases)
+            phaseTimes += fmt::format(", {} {:.1f} ms", name, milliseconds);
+
+        Console::Log("Reloaded the Editor in {:.1f} ms{}", GetTotalMilliseconds(), phaseTimes);
+    }
+
+private:
+    struct Phase
+    {
+        std::string_view name;
+        double milliseconds;
+    };
 
-    bool isDeveloperMode = false;
+    std::chrono::steady_clock::time_point startTime;
+    std::chrono::steady_clock::time_point phaseStartTime;
+    std::vector<Phase> phases;
+};
+
+/// Every configuration's Editor is named the way the Visual Studio and Xcode projects name it, so they can sit side by
+/// side.
+static std::string GetEditorLibraryFileName(Editor::ConfigurationMode configMode)
+{
+    auto suffix = std::string_view();
+    switch (configMode)
+    {
+    case Editor::ConfigurationMode::Debug: suffix = "D"; break;
+    case Editor::ConfigurationMode::Dev: suffix = "Dev"; break;
+    case Editor::ConfigurationMode::Release: break;
+    default: Assert_NoEntry();
+    }
 
     // clang-format off
-#if ADHOC_DEBUG
-    const auto compiledConfigMode = Editor::ConfigurationMode::Debug;
-#elif ADHOC_DEV
-    const auto compiledConfigMode = Editor::ConfigurationMode::Dev;
-#elif ADHOC_RELEASE
-    const auto compiledConfigMode = Editor::ConfigurationMode::Release;
-#else
-    Assert_NoEntry();
+#if ADHOC_WINDOWS
+    return fmt::format("Editor{}.dll", suffix);
+#elif ADHOC_MACOS
+    return fmt::format("libEditor{}.dylib", suffix);
+#elif ADHOC_LINUX
+    return fmt::format("libEditor{}.so", suffix);
 #endif
     // clang-format on
+}
+
+/// Look next to the Launcher, then in a sibling directory named after the configuration, which is where
+/// multi-configuration builds put the other configurations. Returns an empty path if there's no such build.
+static fs::path FindEditorLibrary(Editor::ConfigurationMode configMode)
+{
+    const auto launcherDirectory = Platform::GetLauncherPath().parent_path();
+    const auto fileName          = GetEditorLibraryFileName(configMode);
+
+    for (const auto& candidatePath : {launcherDirectory / fileName,
+                                      launcherDirectory.parent_path() / fmt::format("{}", configMode) / fileName})
+    {
+        auto error = std::error_code();
+        if (fs::is_regular_file(candidatePath, error))
+            return candidatePath;
+    }
+
+    return fs::path();
+}
+
+/// Run the Editor until it's closed, reloading it each time it's rebuilt. Returns how long the first one took to start.
+static std::chrono::nanoseconds RunEditorWithHotReload(int argc,
+                                                       char* argv[],
+                                                       bool isDeveloperMode,
+                                                       bool isQuitAfterStartupRequested,
+                                                       std::chrono::steady_clock::time_point launchTime)
+{
+    // The Engine outlives every Editor loaded into it, so this is done once here rather than by each of them
+    {
+        STARTUP_TRACE_SCOPE("Initialize platform data");
+        Engine::InitializePlatformData();
+    }
+
+    auto symbolHandler = std::optional<Engine::BacktraceSymbolHandler>();
+    {
+        STARTUP_TRACE_SCOPE("Start symbol handler");
+        symbolHandler.emplace();
+    }
+
+    {
+        STARTUP_TRACE_SCOPE("Install crash handler");
+        Engine::InstallCrashHandler();
+    }
+
+    // Before the job system, which allocates its jobs from the Jobs heap
+    {
+        STARTUP_TRACE_SCOPE("Create subsystem heaps");
+        Engine::Memory::Initialize();
+    }
+
+    {
+        STARTUP_TRACE_SCOPE("Start job system");
+        Engine::Jobs::Initialize();
+    }
+
+    const auto editorLibraryPath = FindEditorLibrary(compiledConfigMode);
+    if (editorLibraryPath.empty())
+        Console::LogFatal("No {} build of the Editor was found next to the Launcher!", compiledConfigMode);
+
+    auto editorModule = EditorModule();
+    {
+        STARTUP_TRACE_SCOPE("Load Editor library");
+        if (!editorModule.Load(editorLibraryPath))
+            Console::LogFatal("Failed to load the Editor from {}!", editorLibraryPath.string());
+    }
+
+    auto* editorState                        = editorModule.GetEntryPoints().getMutableEditorState();
+    editorState->currentConfigMode           = compiledConfigMode;
+    editorState->isDeveloperMode             = isDeveloperMode;
+    editorState->isQuitAfterStartupRequested = isQuitAfterStartupRequested;
+
+    // Only developers rebuild the Editor while it's running
+    auto editorWatcher = FileWatcher();
+    if (isDeveloperMode && editorWatcher.Start(editorLibraryPath, OnEditorRebuilt))
+        Console::Log("Watching {} for new builds to hot reload", editorLibraryPath.string());
+
+    // Everything after this is the Editor starting up, which takes the same time however it was loaded
+    const auto coldStartMilliseconds =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - launchTime).count();
+    Console::Log("Cold start of the {} Editor took {:.1f} ms from main()", compiledConfigMode, coldStartMilliseconds);
+
+    auto startupTime = std::chrono::nanoseconds();
+    while (true)
+    {
+        auto reloadOption = Editor::ReloadOption();
+        editorModule.GetEntryPoints().editorMain(argc, argv, &reloadOption);
+
+        // Only the first Editor loaded starts up, the rest are reloads
+        if (startupTime == std::chrono::nanoseconds())
+            startupTime = editorModule.GetEntryPoints().getMutableEditorState()->startupTime;
+
+        if (!reloadOption.isReloadRequested)
+            break;
+
+        auto trace = ReloadTrace(TakeEditorRebuildTime());
+        trace.EndPhase("Editor shutdown");
+
+        // Every Editor loaded runs on the Launcher's Engine, and the Engine's headers don't lay things out the same way
+        // in every configuration (Debug builds keep extra bookkeeping in PoolAllocator and ScratchArena, for one), so
+        // only Editors built in the Launcher's own configuration can be loaded into it
+        if (reloadOption.configToLoad != compiledConfigMode)
+        {
+            Console::LogWarning("The {} Editor can't run on the Launcher's {} Engine! Reloading the {} one.",
+                                reloadOption.configToLoad,
+                                compiledConfigMode,
+                                compiledConfigMode);
+        }
+
+        const auto reloadState = Engine::SaveReloadState();
+        trace.EndPhase("save state");
+
+        editorModule.Unload();
+        trace.EndPhase("unload");
+
+        Engine::ClearReloadRequest();
+        while (!editorModule.Load(editorLibraryPath))
+        {
+            Console::LogError("Failed to reload the Editor! Waiting for another build...");
+
+            while (!Engine::IsReloadRequested())
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            Engine::ClearReloadRequest();
+
+            trace = ReloadTrace(std::chrono::steady_clock::now());
+        }
+        trace.EndPhase("load");
+
+        const auto restoredCount = Engine::RestoreReloadState(reloadState);
+        editorModule.GetEntryPoints().getMutableEditorState()->currentConfigMode = compiledConfigMode;
+        trace.EndPhase("restore state");
+
+        trace.Log();
+        Console::Log("Restored {} of {} state sections", restoredCount, reloadState.size());
+    }
+
+    Engine::Jobs::Shutdown();
+    Engine::Memory::Shutdown();
+    Engine::UninstallCrashHandler();
+
+    return startupTime;
+}
+#endif
+
+int main(int argc, char* argv[])
+{
+    [[maybe_unused]] const auto launchTime = std::chrono::steady_clock::now();
+    Engine::BeginStartupTrace();
+
+    // TODO: Reload if mi-malloc isn't injected (Mac)
+
+    auto mainLogStream = Console::LogStream(LogLevel::Trace, OnEngineLogEvent);
+
+    Console::Log("Starting Ad Hoc Launcher...");
+
+    bool isDeveloperMode             = false;
+    bool isQuitAfterStartupRequested = false;
 
     auto selectedConfigMode = compiledConfigMode;
 
@@ -61,6 +324,10 @@ int main(int argc, char* argv[])
             selectedConfigMode = Editor::ConfigurationMode::Dev;
         else if (strcmp(argv[i], "--release") == 0)
             selectedConfigMode = Editor::ConfigurationMode::Release;
+        else if (strcmp(argv[i], "--quit-after-startup") == 0)
+            isQuitAfterStartupRequested = true;
+        else if (strcmp(argv[i], "--startup-trace") == 0 && i + 1 < argc)
+            Engine::SetStartupTracePath(argv[++i]);
     }
 
     if (compiledConfigMode != selectedConfigMode)
@@ -72,22 +339,46 @@ int main(int argc, char* argv[])
         }
         else
         {
+#if ADHOC_HOT_RELOAD
+            // TODO: Relaunch with the override mode's Launcher
+            Console::LogWarning("The {} Editor can't run on this Launcher's {} Engine! The override will be ignored.",
+                                selectedConfigMode,
+                                compiledConfigMode);
+#else
             // TODO: Relaunch in the override mode
+#endif
         }
-    }
 
-    auto& editorState = Editor::GetMutableEditorState();
+        selectedConfigMode = compiledConfigMode;
+    }
 
-    Console::Log("Configuration: {}", compiledConfigMode);
-    editorState.currentConfigMode = compiledConfigMode;
+    Console::Log("Configuration: {}", selectedConfigMode);
     Console::Log("Developer Mode: {}", isDeveloperMode);
-    editorState.isDeveloperMode = isDeveloperMode;
 
-    auto reloadFlags = Editor::EditorMain(argc, argv);
+    if (isQuitAfterStartupRequested && !Platform::HasDisplay())
+    {
+        Console::LogWarning("There's no display to start the Editor on! Skipping the startup run.");
+        return skippedTestExitCode;
+    }
+
+#if ADHOC_HOT_RELOAD
+    const auto startupTime =
+        RunEditorWithHotReload(argc, argv, isDeveloperMode, isQuitAfterStartupRequested, launchTime);
+#else
+    auto& editorState                       = Editor::GetMutableEditorState();
+    editorState.currentConfigMode           = compiledConfigMode;
+    editorState.isDeveloperMode             = isDeveloperMode;
+    editorState.isQuitAfterStartupRequested = isQuitAfterStartupRequested;
+
+    auto reloadFlags       = Editor::EditorMain(argc, argv);
+    const auto startupTime = editorState.startupTime;
+#endif
+
+    // EndStartupTrace() has already logged by how much
+    if (isQuitAfterStartupRequested && startupTime > Engine::startupBudget)
+        return EXIT_FAILURE;
 
     // TODO: Handle reload scenarios:
-    // - User mode switching
-    // - Developer mode reloading
     // - Fatal Error handling
 
     return EXIT_SUCCESS;
@@ -0,0 +1,31 @@
+#include <Engine/Core/Console.h>
+
+#include <fmt/format.h>
+
+#include <cstdlib>
+#include <string_view>
+
+namespace Console = Engine::Console;
+using Console::LogLevel;
+
+static void OnDecodedLogEvent(const LogLevel logLevel, std::string_view message)
+{
+    fmt::print("[{}] {}\n", logLevel, message);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fmt::print(stderr, "Usage: LogDecoder <binary log file>\n");
+        return EXIT_FAILURE;
+    }
+
+    if (!Console::DecodeBinaryLog(argv[1], OnDecodedLogEvent))
+    {
+        fmt::print(stderr, "{} couldn't be decoded, it's either not a binary log or it's truncated\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
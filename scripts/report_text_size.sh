@@ -0,0 +1,59 @@
+#!/bin/bash
+# Reports the size of the code (.text) sections in each object file of a build, to see how changes such as the
+# assertion macro expansions affect code size per translation unit.
+#
+# Usage: bash scripts/report_text_size.sh <object directory> [<object directory to compare against>]
+
+if [ -z "$1" ] || [ ! -d "$1" ]; then
+    echo "Usage: $0 <object directory> [<object directory to compare against>]"
+    exit 1
+fi
+
+text_size() {
+    local object_file="$1"
+
+    if size -A "$object_file" >/dev/null 2>&1; then
+        # GNU size lists every section, and inline functions each get their own .text.* section
+        size -A "$object_file" | awk '$1 ~ /^\.text/ { total += $2 } END { print total + 0 }'
+    else
+        # macOS size prints the __TEXT segment, which also counts read-only data
+        size "$object_file" | awk 'NR == 2 { print $1 }'
+    fi
+}
+
+after_dir="$1"
+before_dir="$2"
+
+total_after=0
+total_before=0
+
+if [ -n "$before_dir" ]; then
+    printf "%-60s %12s %12s %10s\n" "Object" "Before" "After" "Change"
+else
+    printf "%-60s %12s\n" "Object" "Text"
+fi
+
+for object_file in $(find "$after_dir" -name "*.o" | sort); do
+    object_name=$(basename "$object_file")
+    after=$(text_size "$object_file")
+    total_after=$((total_after + after))
+
+    if [ -n "$before_dir" ]; then
+        before_file="$before_dir/${object_file#"$after_dir"/}"
+        if [ -f "$before_file" ]; then
+            before=$(text_size "$before_file")
+            total_before=$((total_before + before))
+            printf "%-60s %12d %12d %+10d\n" "$object_name" "$before" "$after" $((after - before))
+        else
+            printf "%-60s %12s %12d %10s\n" "$object_name" "-" "$after" "-"
+        fi
+    else
+        printf "%-60s %12d\n" "$object_name" "$after"
+    fi
+done
+
+if [ -n "$before_dir" ]; then
+    printf "%-60s %12d %12d %+10d\n" "Total" "$total_before" "$total_after" $((total_after - total_before))
+else
+    printf "%-60s %12d\n" "Total" "$total_after"
+fi